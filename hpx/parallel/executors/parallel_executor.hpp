@@ -9,17 +9,22 @@
 #define HPX_PARALLEL_EXECUTORS_PARALLEL_EXECUTOR_MAY_13_2015_1057AM
 
 #include <hpx/config.hpp>
+#include <hpx/lcos/local/packaged_task.hpp>
 #include <hpx/parallel/config/inline_namespace.hpp>
 #include <hpx/parallel/executors/static_chunk_size.hpp>
 #include <hpx/parallel/executors/executor_traits.hpp>
 #include <hpx/runtime/launch_policy.hpp>
 #include <hpx/runtime/serialization/serialize.hpp>
 #include <hpx/runtime/threads/thread_executor.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
 #include <hpx/traits/is_executor.hpp>
 #include <hpx/util/deferred_call.hpp>
+#include <hpx/util/thread_description.hpp>
+#include <hpx/util/unique_function.hpp>
 
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v3)
 {
@@ -53,6 +58,40 @@ namespace hpx { namespace parallel { HPX_INLINE_NAMESPACE(v3)
         {
             return hpx::async(l_, std::forward<F>(f), std::forward<Ts>(ts)...);
         }
+
+        template <typename F, typename Shape, typename ... Ts>
+        std::vector<hpx::future<
+            typename detail::bulk_async_execute_result<F, Shape, Ts...>::type
+        > >
+        bulk_async_execute(F && f, Shape const& shape, Ts &&... ts) const
+        {
+            typedef typename
+                    detail::bulk_async_execute_result<F, Shape, Ts...>::type
+                result_type;
+            std::vector<hpx::future<result_type> > results;
+
+            // only plain asynchronous launches can be handed to the thread
+            // manager as a single batch
+            if (l_ != launch::async)
+            {
+                for (auto const& elem: shape)
+                    results.push_back(async_execute(f, elem, ts...));
+                return results;
+            }
+
+            std::vector<util::unique_function_nonser<void()> > tasks;
+            for (auto const& elem: shape)
+            {
+                lcos::local::packaged_task<result_type()> task(
+                    util::deferred_call(f, elem, ts...));
+                results.push_back(task.get_future());
+                tasks.push_back(std::move(task));
+            }
+
+            threads::register_thread_nullary_bulk(std::move(tasks),
+                util::thread_description(f));
+            return results;
+        }
         /// \endcond
 
     private:
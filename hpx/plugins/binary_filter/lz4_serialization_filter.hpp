@@ -0,0 +1,119 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_ACTION_LZ4_SERIALIZATION_FILTER_HPP)
+#define HPX_ACTION_LZ4_SERIALIZATION_FILTER_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+
+#include <hpx/runtime_fwd.hpp>
+#include <hpx/runtime/serialization/binary_filter.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace plugins { namespace compression
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// Compression statistics kept for each action using the LZ4 filter. The
+    /// filter stops compressing the messages of an action if its data turned
+    /// out to be incompressible and samples the data again after a while.
+    struct lz4_action_state
+    {
+        lz4_action_state()
+          : skip_(0), incompressible_(0)
+        {}
+
+        /// Return whether the next message of this action should be
+        /// compressed.
+        bool should_compress()
+        {
+            std::uint32_t skip = skip_.load(boost::memory_order_relaxed);
+            while (skip != 0)
+            {
+                if (skip_.compare_exchange_weak(skip, skip - 1,
+                        boost::memory_order_relaxed))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// number of messages to send uncompressed before sampling again
+        boost::atomic<std::uint32_t> skip_;
+
+        /// number of consecutive messages which did not compress well
+        boost::atomic<std::uint32_t> incompressible_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct HPX_LIBRARY_EXPORT lz4_serialization_filter
+      : public serialization::binary_filter
+    {
+        lz4_serialization_filter(bool compress = false,
+                serialization::binary_filter* next_filter = nullptr)
+          : current_(0), compress_(compress), state_(nullptr)
+        {}
+
+        void set_action_state(lz4_action_state* state)
+        {
+            state_ = state;
+        }
+
+        void load(void* dst, std::size_t dst_count);
+        void save(void const* src, std::size_t src_count);
+        bool flush(void* dst, std::size_t dst_count, std::size_t& written);
+
+        void set_max_length(std::size_t size);
+        std::size_t init_data(char const* buffer,
+            std::size_t size, std::size_t buffer_size);
+
+    private:
+        // serialization support
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        HPX_FORCEINLINE void serialize(Archive& ar, const unsigned int) {}
+
+        HPX_SERIALIZATION_POLYMORPHIC(lz4_serialization_filter);
+
+        std::vector<char> buffer_;
+        std::size_t current_;
+        bool compress_;
+        lz4_action_state* state_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Create a filter for a message of the action the given state belongs
+    /// to, returns nullptr if the message should not be compressed.
+    inline serialization::binary_filter* create_lz4_serialization_filter(
+        lz4_action_state& state)
+    {
+        if (!state.should_compress())
+            return nullptr;
+
+        serialization::binary_filter* filter = hpx::create_binary_filter(
+            "lz4_serialization_filter", true);
+        if (filter != nullptr)
+        {
+            static_cast<lz4_serialization_filter*>(filter)->
+                set_action_state(&state);
+        }
+        return filter;
+    }
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
+#endif
@@ -11,14 +11,15 @@
 #if defined(HPX_HAVE_PARCEL_COALESCING)
 
 #include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/parcelset/detail/batch_flush_control.hpp>
 #include <hpx/runtime/parcelset/policies/message_handler.hpp>
 #include <hpx/util/detail/count_num_args.hpp>
 #include <hpx/util/function.hpp>
 #include <hpx/util/histogram.hpp>
-#include <hpx/util/pool_timer.hpp>
 
 #include <hpx/plugins/parcel/message_buffer.hpp>
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -76,17 +77,28 @@ namespace hpx { namespace plugins { namespace parcel
             parcelset::policies::message_handler::flush_mode mode,
             bool stop_buffering, bool cancel_timer);
 
+        // adaptive mode: adjust the batch size after a flush
+        void adapt(parcelset::policies::message_handler::flush_mode mode,
+            std::size_t num_flushed, std::size_t queue_depth);
+
+        // adaptive mode: time to wait for the current batch to fill up
+        std::chrono::microseconds get_flush_interval(
+            std::chrono::microseconds interval) const;
+
     private:
         mutable mutex_type mtx_;
         parcelset::parcelport* pp_;
         std::size_t num_coalesced_parcels_;
         std::size_t interval_;
         detail::message_buffer buffer_;
-        util::pool_timer timer_;
-        bool stopped_;
-        bool allow_background_flush_;
+        parcelset::detail::batch_flush_control flush_control_;
         std::string action_name_;
 
+        // adaptive coalescing
+        bool adaptive_;
+        std::size_t adaptive_num_;
+        std::int64_t average_time_between_parcels_;
+
         // performance counter data
         std::int64_t num_parcels_;
         std::int64_t reset_num_parcels_;
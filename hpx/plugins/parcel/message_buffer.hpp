@@ -148,6 +148,8 @@ namespace hpx { namespace plugins { namespace parcel { namespace detail
 
         std::size_t capacity() const { return max_messages_; }
 
+        parcelset::locality const& destination() const { return dest_; }
+
     private:
         parcelset::locality dest_;
         std::vector<parcelset::parcel> messages_;
@@ -0,0 +1,165 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_CONNECTION_HANDLER_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_CONNECTION_HANDLER_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/receiver.hpp>
+#include <hpx/plugins/parcelport/shmem/shared_memory.hpp>
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/runtime/parcelset/parcelport_impl.hpp>
+#include <hpx/util_fwd.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace parcelset
+{
+    namespace policies { namespace shmem
+    {
+        class sender;
+        class HPX_EXPORT connection_handler;
+    }}
+
+    template <>
+    struct connection_handler_traits<policies::shmem::connection_handler>
+    {
+        typedef policies::shmem::sender connection_type;
+        typedef std::false_type send_early_parcel;
+        typedef std::true_type  do_background_work;
+        typedef std::true_type  use_connection_cache;
+
+        static const char * type()
+        {
+            return "shmem";
+        }
+
+        static const char * pool_name()
+        {
+            return "parcel-pool-shmem";
+        }
+
+        static const char * pool_name_postfix()
+        {
+            return "-shmem";
+        }
+    };
+
+    namespace policies { namespace shmem
+    {
+        parcelset::locality parcelport_address(util::runtime_configuration const& ini);
+
+        /// The shared memory parcelport connects localities running on the
+        /// same node. Every locality owns a POSIX shared memory segment
+        /// holding a fixed number of channels, each of which is a lock-free
+        /// single producer/single consumer ring buffer. A sending connection
+        /// claims one channel of the segment of its destination and streams
+        /// its messages through it. Large zero-copy chunks bypass the ring,
+        /// they are copied into a separate segment owned by the connection.
+        /// Incoming messages are picked up from the background work of the
+        /// worker threads.
+        class HPX_EXPORT connection_handler
+          : public parcelport_impl<connection_handler>
+        {
+            typedef parcelport_impl<connection_handler> base_type;
+
+            typedef std::shared_ptr<sender> sender_ptr;
+            typedef std::deque<sender_ptr> sender_list;
+
+        public:
+            static std::vector<std::string> runtime_configuration()
+            {
+                std::vector<std::string> lines;
+
+                return lines;
+            }
+
+            connection_handler(util::runtime_configuration const& ini,
+                util::function_nonser<void(std::size_t, char const*)>
+                  const& on_start_thread,
+                util::function_nonser<void()> const& on_stop_thread);
+
+            ~connection_handler();
+
+            /// Start the handling of connections.
+            bool do_run();
+
+            /// Stop the handling of connections.
+            void do_stop();
+
+            /// Return the name of this locality
+            std::string get_locality_name() const;
+
+            /// Only localities running on the same node can be reached, and
+            /// only once alternative parcelports are enabled
+            bool can_connect(parcelset::locality const& l,
+                bool use_alternative_parcelport);
+
+            std::shared_ptr<sender> create_connection(
+                parcelset::locality const& l, error_code& ec);
+
+            parcelset::locality agas_locality(util::runtime_configuration const& ini)
+                const;
+
+            parcelset::locality create_locality() const;
+
+            bool background_work(std::size_t num_thread);
+
+            /// Keep track of a connection which has not finished sending
+            void add_sender(sender_ptr const& s);
+
+        private:
+            bool send_messages();
+            bool receive_messages(std::size_t num_thread);
+            bool has_pending_senders();
+            void io_service_work();
+
+            /// Remember a destination which can't be reached through this
+            /// parcelport, its parcels are sent through the next parcelport
+            /// from now on.
+            void set_unreachable(std::string const& segment);
+            bool is_unreachable(std::string const& segment);
+
+            std::size_t num_channels_;
+            std::size_t ring_size_;
+            std::size_t bulk_threshold_;
+
+            boost::atomic<bool> stopped_;
+
+            /// The segment other localities send their messages to.
+            shared_memory segment_;
+            std::vector<std::unique_ptr<receiver<connection_handler> > >
+                receivers_;
+
+            /// Connections with messages still in flight
+            typedef lcos::local::spinlock mutex_type;
+            mutex_type senders_mtx_;
+            sender_list senders_;
+
+            /// Segments of destinations we failed to connect to
+            mutex_type unreachable_mtx_;
+            boost::atomic<bool> has_unreachable_;
+            std::set<std::string> unreachable_;
+        };
+    }}
+}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
+
+#endif
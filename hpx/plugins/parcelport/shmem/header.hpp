@@ -0,0 +1,58 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_HEADER_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_HEADER_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/plugins/parcelport/shmem/shared_memory.hpp>
+
+#include <boost/lockfree/detail/prefix.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Each message written to a channel starts with this header, followed by
+    // the transmission chunks, the main data buffer and all zero-copy chunks
+    // which are smaller than the bulk threshold. Zero-copy chunks of at least
+    // bulk_threshold_ bytes are not streamed through the ring, they are
+    // placed into the bulk segment of the sending connection instead (in
+    // order, each starting on a cache line boundary).
+    struct header
+    {
+        std::uint64_t seq_;
+        std::uint64_t size_;
+        std::uint64_t data_size_;
+        std::uint32_t num_chunks_first_;
+        std::uint32_t num_chunks_second_;
+        std::uint64_t bulk_threshold_;
+        std::uint64_t bulk_generation_;     // 0: no bulk data
+    };
+
+    inline std::size_t bulk_align(std::size_t size)
+    {
+        return (size + BOOST_LOCKFREE_CACHELINE_BYTES - 1) &
+            ~std::size_t(BOOST_LOCKFREE_CACHELINE_BYTES - 1);
+    }
+
+    // The bulk segment of a sending connection is named after the receiving
+    // segment, the channel and its generation (which changes whenever the
+    // sender has to grow the segment).
+    inline std::string bulk_segment_name(std::string const& segment,
+        std::size_t channel, std::uint64_t generation)
+    {
+        return segment + "." + std::to_string(channel) + "." +
+            std::to_string(generation);
+    }
+}}}}
+
+#endif
+
+#endif
@@ -0,0 +1,266 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_RECEIVER_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_RECEIVER_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/performance_counters/parcels/data_point.hpp>
+#include <hpx/plugins/parcelport/shmem/header.hpp>
+#include <hpx/plugins/parcelport/shmem/ring_buffer.hpp>
+#include <hpx/plugins/parcelport/shmem/shared_memory.hpp>
+#include <hpx/runtime/parcelset/decode_parcels.hpp>
+#include <hpx/runtime/parcelset/detail/receive_buffer_pool.hpp>
+#include <hpx/runtime/parcelset/parcel_buffer.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Receives the messages written to one channel of the segment of this
+    // locality.
+    template <typename Parcelport>
+    class receiver
+    {
+        enum connection_state
+        {
+            initialized
+          , rcvd_header
+          , rcvd_transmission_chunks
+          , rcvd_data
+        };
+
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+        typedef std::vector<char> data_type;
+        typedef parcel_buffer<data_type, data_type> buffer_type;
+        typedef buffer_type::transmission_chunk_type transmission_chunk_type;
+
+    public:
+        receiver(Parcelport& pp, std::string const& segment,
+                channel_header* hdr, std::size_t ring_size, std::size_t channel)
+          : state_(initialized)
+          , pp_(pp)
+          , segment_(segment)
+          , ring_(hdr, ring_size)
+          , channel_(channel)
+          , bulk_generation_(0)
+          , chunks_idx_(0)
+          , pos_(0)
+        {}
+
+        /// Receive as much as currently available, return true if any data
+        /// was taken from the ring.
+        bool receive(std::size_t num_thread = std::size_t(-1))
+        {
+            if (ring_.empty())
+                return false;
+
+            std::unique_lock<mutex_type> l(mtx_, std::try_to_lock);
+            if (!l.owns_lock())
+                return false;
+
+            std::uint64_t consumed = ring_.consumed();
+            while (!ring_.empty())
+            {
+                if (state_ == initialized)
+                {
+                    if (!read(&header_, sizeof(header_)))
+                        break;
+                    start_message();
+                    state_ = rcvd_header;
+                }
+
+                if (state_ == rcvd_header)
+                {
+                    std::vector<transmission_chunk_type>& chunks =
+                        buffer_.transmission_chunks_;
+                    if (!read(chunks.data(),
+                            chunks.size() * sizeof(transmission_chunk_type)))
+                    {
+                        break;
+                    }
+                    state_ = rcvd_transmission_chunks;
+                }
+
+                if (state_ == rcvd_transmission_chunks)
+                {
+                    if (!read(buffer_.data_.data(), buffer_.data_.size()))
+                        break;
+
+                    buffer_.chunks_.resize(
+                        static_cast<std::uint32_t>(buffer_.num_chunks_.first));
+                    chunks_idx_ = 0;
+                    state_ = rcvd_data;
+                }
+
+                if (state_ == rcvd_data)
+                {
+                    // read all zero-copy chunks which were streamed
+                    bool complete = true;
+                    while (chunks_idx_ < buffer_.chunks_.size())
+                    {
+                        std::size_t size = static_cast<std::size_t>(
+                            buffer_.transmission_chunks_[chunks_idx_].second);
+                        if (!is_bulk(size))
+                        {
+                            // the chunks start out empty, a chunk which is
+                            // split across several reads is continued in
+                            // the buffer fetched first
+                            data_type& c = buffer_.chunks_[chunks_idx_];
+                            if (c.size() != size)
+                            {
+                                c = parcelset::detail::receive_buffer_pool::
+                                    instance().get_buffer(size);
+                            }
+                            if (!read(c.data(), size))
+                            {
+                                complete = false;
+                                break;
+                            }
+                        }
+                        ++chunks_idx_;
+                    }
+                    if (!complete)
+                        break;
+
+                    finish_message(num_thread);
+                    state_ = initialized;
+                }
+            }
+
+            // only data taken from the ring counts as progress
+            return ring_.consumed() != consumed;
+        }
+
+        /// Return whether there is data in the ring which has not been
+        /// looked at yet.
+        bool has_data() const
+        {
+            return !ring_.empty();
+        }
+
+    private:
+        bool is_bulk(std::size_t size) const
+        {
+            return header_.bulk_generation_ != 0 &&
+                header_.bulk_threshold_ != 0 && size >= header_.bulk_threshold_;
+        }
+
+        bool read(void* data, std::size_t size)
+        {
+            pos_ += ring_.read_some(static_cast<char*>(data) + pos_, size - pos_);
+            if (pos_ != size)
+                return false;
+
+            pos_ = 0;
+            return true;
+        }
+
+        void start_message()
+        {
+            performance_counters::parcels::data_point& data =
+                buffer_.data_point_;
+            data.time_ = timer_.elapsed_nanoseconds();
+            data.bytes_ = static_cast<std::size_t>(header_.size_);
+
+            buffer_.size_ = header_.size_;
+            buffer_.data_size_ = header_.data_size_;
+            buffer_.num_chunks_ = buffer_type::count_chunks_type(
+                header_.num_chunks_first_, header_.num_chunks_second_);
+
+            buffer_.data_ = parcelset::detail::receive_buffer_pool::instance()
+                .get_buffer(static_cast<std::size_t>(header_.size_));
+            if (header_.num_chunks_first_ != 0)
+            {
+                buffer_.transmission_chunks_.resize(
+                    std::size_t(header_.num_chunks_first_) +
+                        header_.num_chunks_second_);
+            }
+        }
+
+        void finish_message(std::size_t num_thread)
+        {
+            if (header_.bulk_generation_ != 0)
+            {
+                copy_bulk_chunks();
+
+                // allow the sender to reuse its bulk segment
+                ring_.header()->acked_.store(header_.seq_,
+                    boost::memory_order_release);
+            }
+
+            buffer_.data_point_.time_ =
+                timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
+
+            decode_parcels(pp_, std::move(buffer_), num_thread);
+            buffer_ = buffer_type();
+        }
+
+        void copy_bulk_chunks()
+        {
+            if (!bulk_ || bulk_generation_ != header_.bulk_generation_)
+            {
+                bulk_generation_ = header_.bulk_generation_;
+                bulk_.open(bulk_segment_name(
+                    segment_, channel_, bulk_generation_));
+            }
+
+            parcelset::detail::receive_buffer_pool& pool =
+                parcelset::detail::receive_buffer_pool::instance();
+
+            char const* data = static_cast<char const*>(bulk_.data());
+            for (std::size_t i = 0; i != buffer_.chunks_.size(); ++i)
+            {
+                std::size_t size = static_cast<std::size_t>(
+                    buffer_.transmission_chunks_[i].second);
+                if (is_bulk(size))
+                {
+                    data_type& c = buffer_.chunks_[i];
+                    c = pool.get_buffer(size);
+                    std::memcpy(c.data(), data, size);
+                    data += bulk_align(size);
+                }
+            }
+        }
+
+        connection_state state_;
+        Parcelport& pp_;
+        std::string segment_;
+
+        ring_buffer ring_;
+        std::size_t channel_;
+
+        /// the bulk segment of the current sender of this channel
+        shared_memory bulk_;
+        std::uint64_t bulk_generation_;
+
+        header header_;
+        buffer_type buffer_;
+        std::size_t chunks_idx_;
+        std::size_t pos_;
+
+        /// Counters and timers for parcels received.
+        util::high_resolution_timer timer_;
+
+        mutex_type mtx_;
+    };
+}}}}
+
+#endif
+
+#endif
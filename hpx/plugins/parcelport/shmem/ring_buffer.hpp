@@ -0,0 +1,253 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_RING_BUFFER_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_RING_BUFFER_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/util/assert.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/lockfree/detail/prefix.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+// The control structures below are shared between processes, this requires
+// the atomics to be address free.
+#if BOOST_ATOMIC_INT64_LOCK_FREE != 2 || BOOST_ATOMIC_INT32_LOCK_FREE != 2
+#  error "The shared memory parcelport requires lock-free 32 and 64 bit atomics"
+#endif
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Layout of the segment a locality receives its messages through:
+    //
+    //      segment_header
+    //      channel_header, ring data (ring_size bytes)    (channel 0)
+    //      channel_header, ring data (ring_size bytes)    (channel 1)
+    //      ...
+    //
+    // Each channel is owned by exactly one sending connection, which makes
+    // every ring a single producer/single consumer queue. A sender flags its
+    // channel in the ready_ word of the segment header whenever it has
+    // written to the ring, this way the receiver has to look only at the
+    // channels which have new data.
+    struct segment_header
+    {
+        static std::uint64_t const magic = 0x6870782d73686d65ULL;   // hpx-shme
+
+        segment_header()
+          : magic_(0), num_channels_(0), ring_size_(0), ready_(0)
+        {}
+
+        std::uint64_t magic_;
+        std::uint64_t num_channels_;
+        std::uint64_t ring_size_;
+
+        // one bit for each channel with data not looked at by the receiver
+        boost::atomic<std::uint64_t> ready_;
+    };
+
+    static_assert(sizeof(segment_header) <= BOOST_LOCKFREE_CACHELINE_BYTES,
+        "the segment header has to fit into the first cache line of a segment");
+
+    // the channels with new data are flagged in a single word
+    std::size_t const max_channels = 64;
+
+    struct channel_header
+    {
+        channel_header()
+          : owner_(0), acked_(0), head_(0), tail_(0)
+        {}
+
+        // non-zero if the channel is used by a sender
+        boost::atomic<std::uint32_t> owner_;
+
+        // sequence number of the last message which was completely consumed,
+        // used by the sender to reuse its bulk segment
+        boost::atomic<std::uint64_t> acked_;
+        char pad0_[BOOST_LOCKFREE_CACHELINE_BYTES - sizeof(std::uint64_t) * 2];
+
+        // written by the sender only
+        boost::atomic<std::uint64_t> head_;
+        char pad1_[BOOST_LOCKFREE_CACHELINE_BYTES - sizeof(std::uint64_t)];
+
+        // written by the receiver only
+        boost::atomic<std::uint64_t> tail_;
+        char pad2_[BOOST_LOCKFREE_CACHELINE_BYTES - sizeof(std::uint64_t)];
+    };
+
+    inline std::size_t segment_size(std::size_t num_channels,
+        std::size_t ring_size)
+    {
+        return BOOST_LOCKFREE_CACHELINE_BYTES +
+            num_channels * (sizeof(channel_header) + ring_size);
+    }
+
+    inline channel_header* get_channel(void* segment, std::size_t ring_size,
+        std::size_t channel)
+    {
+        return reinterpret_cast<channel_header*>(
+            static_cast<char*>(segment) + BOOST_LOCKFREE_CACHELINE_BYTES +
+                channel * (sizeof(channel_header) + ring_size));
+    }
+
+    // Initialize a freshly created segment
+    inline void init_segment(void* segment, std::size_t num_channels,
+        std::size_t ring_size)
+    {
+        HPX_ASSERT(num_channels != 0 && num_channels <= max_channels);
+
+        for (std::size_t i = 0; i != num_channels; ++i)
+            new (get_channel(segment, ring_size, i)) channel_header();
+
+        segment_header* hdr = new (segment) segment_header();
+        hdr->num_channels_ = num_channels;
+        hdr->ring_size_ = ring_size;
+
+        boost::atomic_thread_fence(boost::memory_order_release);
+        hdr->magic_ = segment_header::magic;
+    }
+
+    // Claim a free channel of an initialized segment for a new sending
+    // connection, return std::size_t(-1) if all channels are in use.
+    inline std::size_t claim_channel(void* segment)
+    {
+        segment_header const* hdr = static_cast<segment_header const*>(segment);
+        std::size_t num_channels = static_cast<std::size_t>(hdr->num_channels_);
+        std::size_t ring_size = static_cast<std::size_t>(hdr->ring_size_);
+
+        for (std::size_t i = 0; i != num_channels; ++i)
+        {
+            channel_header* channel = get_channel(segment, ring_size, i);
+
+            std::uint32_t expected = 0;
+            if (channel->owner_.compare_exchange_strong(expected, 1,
+                    boost::memory_order_acquire))
+            {
+                return i;
+            }
+        }
+        return std::size_t(-1);
+    }
+
+    // Give a channel back, it may be claimed by another connection
+    // afterwards.
+    inline void release_channel(channel_header* channel)
+    {
+        channel->owner_.store(0, boost::memory_order_release);
+    }
+
+    // Tell the receiver that the given channel has new data, called after
+    // the head of its ring has been advanced.
+    inline void notify_channel(void* segment, std::size_t channel)
+    {
+        HPX_ASSERT(channel < max_channels);
+        static_cast<segment_header*>(segment)->ready_.fetch_or(
+            std::uint64_t(1) << channel, boost::memory_order_release);
+    }
+
+    // Return (and reset) the set of channels which have been notified since
+    // the last call.
+    inline std::uint64_t take_ready_channels(void* segment)
+    {
+        segment_header* hdr = static_cast<segment_header*>(segment);
+        if (hdr->ready_.load(boost::memory_order_relaxed) == 0)
+            return 0;
+        return hdr->ready_.exchange(0, boost::memory_order_acquire);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Lock-free single producer/single consumer byte ring living in shared
+    // memory. The head and tail positions grow monotonically, the size of the
+    // ring has to be a power of two.
+    class ring_buffer
+    {
+    public:
+        ring_buffer()
+          : hdr_(nullptr), data_(nullptr), size_(0)
+        {}
+
+        ring_buffer(channel_header* hdr, std::size_t size)
+          : hdr_(hdr), data_(reinterpret_cast<char*>(hdr + 1)), size_(size)
+        {
+            HPX_ASSERT(size != 0 && (size & (size - 1)) == 0);
+        }
+
+        channel_header* header() const { return hdr_; }
+
+        // the total number of bytes consumed from the ring so far
+        std::uint64_t consumed() const
+        {
+            return hdr_->tail_.load(boost::memory_order_relaxed);
+        }
+
+        // Copy as many bytes as currently fit into the ring, return the
+        // number of bytes written. Called by the producer only.
+        std::size_t write_some(void const* src, std::size_t len)
+        {
+            std::uint64_t head = hdr_->head_.load(boost::memory_order_relaxed);
+            std::uint64_t tail = hdr_->tail_.load(boost::memory_order_acquire);
+
+            std::size_t n = (std::min)(len, std::size_t(size_ - (head - tail)));
+            if (n == 0)
+                return 0;
+
+            std::size_t pos = std::size_t(head & (size_ - 1));
+            std::size_t first = (std::min)(n, size_ - pos);
+            std::memcpy(data_ + pos, src, first);
+            if (first != n)
+            {
+                std::memcpy(data_, static_cast<char const*>(src) + first,
+                    n - first);
+            }
+
+            hdr_->head_.store(head + n, boost::memory_order_release);
+            return n;
+        }
+
+        // Copy as many bytes as currently available from the ring, return
+        // the number of bytes read. Called by the consumer only.
+        std::size_t read_some(void* dst, std::size_t len)
+        {
+            std::uint64_t tail = hdr_->tail_.load(boost::memory_order_relaxed);
+            std::uint64_t head = hdr_->head_.load(boost::memory_order_acquire);
+
+            std::size_t n = (std::min)(len, std::size_t(head - tail));
+            if (n == 0)
+                return 0;
+
+            std::size_t pos = std::size_t(tail & (size_ - 1));
+            std::size_t first = (std::min)(n, size_ - pos);
+            std::memcpy(dst, data_ + pos, first);
+            if (first != n)
+                std::memcpy(static_cast<char*>(dst) + first, data_, n - first);
+
+            hdr_->tail_.store(tail + n, boost::memory_order_release);
+            return n;
+        }
+
+        bool empty() const
+        {
+            return hdr_->head_.load(boost::memory_order_acquire) ==
+                hdr_->tail_.load(boost::memory_order_relaxed);
+        }
+
+    private:
+        channel_header* hdr_;
+        char* data_;
+        std::size_t size_;
+    };
+}}}}
+
+#endif
+
+#endif
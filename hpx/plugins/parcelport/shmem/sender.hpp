@@ -0,0 +1,344 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_SENDER_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_SENDER_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/error_code.hpp>
+#include <hpx/performance_counters/parcels/gatherer.hpp>
+#include <hpx/plugins/parcelport/shmem/header.hpp>
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/ring_buffer.hpp>
+#include <hpx/plugins/parcelport/shmem/shared_memory.hpp>
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/runtime/parcelset/parcelport.hpp>
+#include <hpx/runtime/parcelset/parcelport_connection.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/unique_function.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    class connection_handler;
+    class sender;
+
+    void add_sender(connection_handler&, std::shared_ptr<sender> const&);
+
+    class sender
+      : public parcelset::parcelport_connection<sender, std::vector<char> >
+    {
+        enum connection_state
+        {
+            initialized
+          , sent_header
+          , sent_transmission_chunks
+          , sent_data
+          , sent_chunks
+        };
+
+        typedef parcel_buffer_type::transmission_chunk_type
+            transmission_chunk_type;
+
+    public:
+        /// Construct a sending connection writing to the given channel of
+        /// the (mapped) segment of the destination locality.
+        sender(connection_handler& handler, parcelset::locality const& there,
+                parcelset::parcelport* pp, shared_memory && segment,
+                std::size_t channel, std::size_t bulk_threshold)
+          : state_(initialized)
+          , connection_handler_(handler)
+          , there_(there)
+          , pp_(pp)
+          , segment_(std::move(segment))
+          , channel_(channel)
+          , bulk_threshold_(bulk_threshold)
+          , bulk_generation_(0)
+          , chunks_idx_(0)
+          , pos_(0)
+          , bytes_written_(0)
+        {
+            segment_header const* hdr =
+                static_cast<segment_header const*>(segment_.data());
+            ring_ = ring_buffer(
+                get_channel(segment_.data(), hdr->ring_size_, channel_),
+                hdr->ring_size_);
+        }
+
+        ~sender()
+        {
+            // remove the bulk segment first, the receiver might pick it up
+            // otherwise after the channel was given to another connection
+            bulk_.close();
+            release_channel(ring_.header());
+        }
+
+        parcelset::locality const& destination() const
+        {
+            return there_;
+        }
+
+        void verify(parcelset::locality const & parcel_locality_id) const
+        {
+            HPX_ASSERT(parcel_locality_id == there_);
+        }
+
+        template <typename Handler, typename ParcelPostprocess>
+        void async_write(Handler && handler,
+            ParcelPostprocess && parcel_postprocess)
+        {
+            HPX_ASSERT(!buffer_.data_.empty());
+
+            handler_ = std::forward<Handler>(handler);
+            buffer_.data_point_.time_ = util::high_resolution_clock::now();
+
+            error_code ec(lightweight);
+            prepare(ec);
+            if (ec)
+            {
+                handler_(ec);
+                buffer_.clear();
+                parcel_postprocess(ec, there_, shared_from_this());
+                return;
+            }
+
+            if (!send())
+            {
+                postprocess_handler_ =
+                    std::forward<ParcelPostprocess>(parcel_postprocess);
+                add_sender(connection_handler_, shared_from_this());
+            }
+            else
+            {
+                parcel_postprocess(ec, there_, shared_from_this());
+            }
+        }
+
+        /// Make progress on the current message, return true if it has been
+        /// completely handed over to the receiver.
+        bool send()
+        {
+            std::uint64_t bytes_written = bytes_written_;
+            bool result = send_message();
+
+            // wake up the receiver if anything was written to the ring
+            if (bytes_written_ != bytes_written)
+                notify_channel(segment_.data(), channel_);
+
+            return result;
+        }
+
+        /// The total number of bytes written to the ring by this connection
+        std::uint64_t bytes_written() const
+        {
+            return bytes_written_;
+        }
+
+        void postprocess(error_code const& ec)
+        {
+            postprocess_handler_(ec, there_, shared_from_this());
+        }
+
+    private:
+        bool send_message()
+        {
+            if (state_ == initialized)
+            {
+                if (!write(&header_, sizeof(header_)))
+                    return false;
+                state_ = sent_header;
+            }
+
+            if (state_ == sent_header)
+            {
+                std::vector<transmission_chunk_type>& chunks =
+                    buffer_.transmission_chunks_;
+                if (!write(chunks.data(),
+                        chunks.size() * sizeof(transmission_chunk_type)))
+                {
+                    return false;
+                }
+                state_ = sent_transmission_chunks;
+            }
+
+            if (state_ == sent_transmission_chunks)
+            {
+                if (!write(buffer_.data_.data(), buffer_.data_.size()))
+                    return false;
+                state_ = sent_data;
+            }
+
+            if (state_ == sent_data)
+            {
+                // stream all zero-copy chunks which are not in the bulk segment
+                while (chunks_idx_ < buffer_.chunks_.size())
+                {
+                    serialization::serialization_chunk& c =
+                        buffer_.chunks_[chunks_idx_];
+                    if (c.type_ == serialization::chunk_type_pointer &&
+                        !is_bulk(c.size_))
+                    {
+                        if (!write(c.data_.cpos_, c.size_))
+                            return false;
+                    }
+                    ++chunks_idx_;
+                }
+                state_ = sent_chunks;
+            }
+
+            // the bulk segment may be reused only after the receiver has
+            // copied the data out of it
+            if (header_.bulk_generation_ != 0 &&
+                ring_.header()->acked_.load(boost::memory_order_acquire) <
+                    header_.seq_)
+            {
+                return false;
+            }
+
+            return done();
+        }
+
+        bool is_bulk(std::size_t size) const
+        {
+            return bulk_threshold_ != 0 && size >= bulk_threshold_;
+        }
+
+        // Fill in the message header and copy all large zero-copy chunks
+        // into the bulk segment of this connection.
+        void prepare(error_code& ec)
+        {
+            state_ = initialized;
+            chunks_idx_ = 0;
+            pos_ = 0;
+
+            // the head of the ring grows with every message, which makes it
+            // a unique sequence number for the messages of this channel
+            std::uint64_t seq =
+                ring_.header()->head_.load(boost::memory_order_relaxed) + 1;
+
+            header_.seq_ = seq;
+            header_.size_ = buffer_.size_;
+            header_.data_size_ = buffer_.data_size_;
+            header_.num_chunks_first_ = buffer_.num_chunks_.first;
+            header_.num_chunks_second_ = buffer_.num_chunks_.second;
+            header_.bulk_threshold_ = bulk_threshold_;
+            header_.bulk_generation_ = 0;
+
+            std::size_t bulk_size = 0;
+            for (serialization::serialization_chunk const& c : buffer_.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type_pointer &&
+                    is_bulk(c.size_))
+                {
+                    bulk_size += bulk_align(c.size_);
+                }
+            }
+            if (bulk_size == 0)
+                return;
+
+            if (!bulk_ || bulk_.size() < bulk_size)
+            {
+                std::size_t size = bulk_.size() != 0 ? bulk_.size() : 4096;
+                while (size < bulk_size)
+                    size *= 2;
+
+                // the generation has to be unique for this channel, even
+                // across different sending connections
+                bulk_generation_ = seq;
+                bulk_.create(bulk_segment_name(
+                    segment_.name(), channel_, bulk_generation_), size, ec);
+                if (ec)
+                    return;
+            }
+
+            char* data = static_cast<char*>(bulk_.data());
+            for (serialization::serialization_chunk const& c : buffer_.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type_pointer &&
+                    is_bulk(c.size_))
+                {
+                    std::memcpy(data, c.data_.cpos_, c.size_);
+                    data += bulk_align(c.size_);
+                }
+            }
+            header_.bulk_generation_ = bulk_generation_;
+        }
+
+        bool write(void const* data, std::size_t size)
+        {
+            std::size_t n = ring_.write_some(
+                static_cast<char const*>(data) + pos_, size - pos_);
+            pos_ += n;
+            bytes_written_ += n;
+            if (pos_ != size)
+                return false;
+
+            pos_ = 0;
+            return true;
+        }
+
+        bool done()
+        {
+            error_code ec;
+            handler_(ec);
+            buffer_.data_point_.time_ =
+                util::high_resolution_clock::now() - buffer_.data_point_.time_;
+            pp_->add_sent_data(buffer_.data_point_);
+            buffer_.clear();
+
+            state_ = initialized;
+            return true;
+        }
+
+        connection_state state_;
+        connection_handler& connection_handler_;
+
+        /// the other (receiving) end of this connection
+        parcelset::locality there_;
+        parcelset::parcelport* pp_;
+
+        /// the segment of the receiving locality and our channel in it
+        shared_memory segment_;
+        std::size_t channel_;
+        ring_buffer ring_;
+
+        /// segment holding the large zero-copy chunks of the current message
+        std::size_t bulk_threshold_;
+        shared_memory bulk_;
+        std::uint64_t bulk_generation_;
+
+        header header_;
+        std::size_t chunks_idx_;
+        std::size_t pos_;
+        std::uint64_t bytes_written_;
+
+        util::unique_function_nonser<
+            void(
+                error_code const&
+            )
+        > handler_;
+        util::unique_function_nonser<
+            void(
+                error_code const&
+              , parcelset::locality const&
+              , std::shared_ptr<sender>
+            )
+        > postprocess_handler_;
+    };
+}}}}
+
+#endif
+
+#endif
@@ -0,0 +1,201 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_SHARED_MEMORY_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_SHARED_MEMORY_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/error_code.hpp>
+#include <hpx/throw_exception.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // A named POSIX shared memory segment mapped into the address space of
+    // this process. The creator of a segment removes its name on destruction,
+    // existing mappings stay valid until they are released by all processes.
+    class shared_memory
+    {
+        HPX_MOVABLE_ONLY(shared_memory);
+
+    public:
+        shared_memory()
+          : data_(nullptr), size_(0), owner_(false)
+        {}
+
+        shared_memory(shared_memory && rhs)
+          : name_(std::move(rhs.name_)), data_(rhs.data_), size_(rhs.size_),
+            owner_(rhs.owner_)
+        {
+            rhs.data_ = nullptr;
+            rhs.size_ = 0;
+            rhs.owner_ = false;
+        }
+
+        shared_memory& operator=(shared_memory && rhs)
+        {
+            if (this != &rhs)
+            {
+                close();
+                name_ = std::move(rhs.name_);
+                data_ = rhs.data_;
+                size_ = rhs.size_;
+                owner_ = rhs.owner_;
+                rhs.data_ = nullptr;
+                rhs.size_ = 0;
+                rhs.owner_ = false;
+            }
+            return *this;
+        }
+
+        ~shared_memory()
+        {
+            close();
+        }
+
+        // Create a new zero initialized segment, replacing any stale segment
+        // of the same name left behind by a crashed process.
+        void create(std::string const& name, std::size_t size,
+            error_code& ec = throws)
+        {
+            close();
+
+            ::shm_unlink(name.c_str());
+            int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+            if (fd == -1)
+            {
+                report_error("shmem::shared_memory::create", name, ec);
+                return;
+            }
+
+            if (::ftruncate(fd, static_cast<off_t>(size)) == -1)
+            {
+                int err = errno;
+                ::close(fd);
+                ::shm_unlink(name.c_str());
+                errno = err;
+                report_error("shmem::shared_memory::create", name, ec);
+                return;
+            }
+
+            name_ = name;
+            owner_ = true;
+            map(fd, size, "shmem::shared_memory::create", ec);
+        }
+
+        // Map an existing segment created by another process.
+        void open(std::string const& name, error_code& ec = throws)
+        {
+            close();
+
+            int fd = ::shm_open(name.c_str(), O_RDWR, 0600);
+            if (fd == -1)
+            {
+                report_error("shmem::shared_memory::open", name, ec);
+                return;
+            }
+
+            struct stat st;
+            if (::fstat(fd, &st) == -1)
+            {
+                int err = errno;
+                ::close(fd);
+                errno = err;
+                report_error("shmem::shared_memory::open", name, ec);
+                return;
+            }
+
+            name_ = name;
+            owner_ = false;
+            map(fd, static_cast<std::size_t>(st.st_size),
+                "shmem::shared_memory::open", ec);
+        }
+
+        // Remove the name of the segment, the mapping stays valid.
+        void unlink()
+        {
+            if (owner_)
+            {
+                ::shm_unlink(name_.c_str());
+                owner_ = false;
+            }
+        }
+
+        void close()
+        {
+            unlink();
+            if (data_ != nullptr)
+            {
+                ::munmap(data_, size_);
+                data_ = nullptr;
+                size_ = 0;
+            }
+            name_.clear();
+        }
+
+        void* data() const { return data_; }
+        std::size_t size() const { return size_; }
+        std::string const& name() const { return name_; }
+
+        explicit operator bool() const HPX_NOEXCEPT
+        {
+            return data_ != nullptr;
+        }
+
+    private:
+        void map(int fd, std::size_t size, char const* func, error_code& ec)
+        {
+            void* p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                MAP_SHARED, fd, 0);
+            int err = errno;
+            ::close(fd);
+
+            if (p == MAP_FAILED)
+            {
+                errno = err;
+                std::string name = name_;
+                unlink();
+                name_.clear();
+                report_error(func, name, ec);
+                return;
+            }
+
+            data_ = p;
+            size_ = size;
+
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+
+        static void report_error(char const* func, std::string const& name,
+            error_code& ec)
+        {
+            HPX_THROWS_IF(ec, network_error, func,
+                "shared memory segment '" + name + "': " +
+                    std::strerror(errno));
+        }
+
+        std::string name_;
+        void* data_;
+        std::size_t size_;
+        bool owner_;
+    };
+}}}}
+
+#endif
+
+#endif
@@ -20,6 +20,7 @@
 #include <hpx/performance_counters/parcels/data_point.hpp>
 #include <hpx/performance_counters/parcels/gatherer.hpp>
 #include <hpx/runtime/parcelset/decode_parcels.hpp>
+#include <hpx/runtime/parcelset/detail/receive_buffer_pool.hpp>
 #include <hpx/runtime/parcelset/parcelport_connection.hpp>
 #include <hpx/util/bind.hpp>
 #include <hpx/util/high_resolution_timer.hpp>
@@ -186,7 +187,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                             sizeof(transmission_chunk_type)));
 
                     // add main buffer holding data which was serialized normally
-                    buffer_.data_.resize(static_cast<std::size_t>(inbound_size));
+                    buffer_.data_ = parcelset::detail::receive_buffer_pool::instance()
+                        .get_buffer(static_cast<std::size_t>(inbound_size));
                     buffers.push_back(boost::asio::buffer(buffer_.data_));
 
                     // Start an asynchronous call to receive the data.
@@ -194,7 +196,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                 }
                 else {
                     // add main buffer holding data which was serialized normally
-                    buffer_.data_.resize(static_cast<std::size_t>(inbound_size));
+                    buffer_.data_ = parcelset::detail::receive_buffer_pool::instance()
+                        .get_buffer(static_cast<std::size_t>(inbound_size));
                     buffers.push_back(boost::asio::buffer(buffer_.data_));
 
                     // Start an asynchronous call to receive the data.
@@ -244,11 +247,14 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                     static_cast<std::size_t>(
                         static_cast<std::uint32_t>(buffer_.num_chunks_.first));
 
+                parcelset::detail::receive_buffer_pool& pool =
+                    parcelset::detail::receive_buffer_pool::instance();
+
                 buffer_.chunks_.resize(num_zero_copy_chunks);
                 for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
                 {
                     std::size_t chunk_size = buffer_.transmission_chunks_[i].second;
-                    buffer_.chunks_[i].resize(chunk_size);
+                    buffer_.chunks_[i] = pool.get_buffer(chunk_size);
                     buffers.push_back(
                         boost::asio::buffer(buffer_.chunks_[i].data(), chunk_size));
                 }
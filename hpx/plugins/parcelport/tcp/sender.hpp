@@ -33,11 +33,20 @@
 #include <boost/asio/write.hpp>
 #include <boost/atomic.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#if !defined(HPX_WINDOWS)
+#include <cerrno>
+#include <climits>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#endif
+
 namespace hpx { namespace parcelset { namespace policies { namespace tcp
 {
     class sender
@@ -111,37 +120,49 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             buffer_.data_point_.time_ = timer_.elapsed_nanoseconds();
 
             // Write the serialized data to the socket. We use "gather-write"
-            // to send both the header and the data in a single write operation.
-            std::vector<boost::asio::const_buffer> buffers;
-            buffers.push_back(boost::asio::buffer(&buffer_.size_,
+            // to send the header, the data, and all zero-copy chunks in a
+            // single write operation without copying any of them. The parcels
+            // queued for the same destination have been encoded into this
+            // buffer already, so all of them go out together.
+            buffers_.clear();
+            buffers_.push_back(boost::asio::buffer(&buffer_.size_,
                 sizeof(buffer_.size_)));
-            buffers.push_back(boost::asio::buffer(&buffer_.data_size_,
+            buffers_.push_back(boost::asio::buffer(&buffer_.data_size_,
                 sizeof(buffer_.data_size_)));
 
             // add chunk description
-            buffers.push_back(boost::asio::buffer(&buffer_.num_chunks_,
+            buffers_.push_back(boost::asio::buffer(&buffer_.num_chunks_,
                 sizeof(buffer_.num_chunks_)));
 
             std::vector<parcel_buffer_type::transmission_chunk_type>& chunks =
                 buffer_.transmission_chunks_;
             if (!chunks.empty()) {
-                buffers.push_back(
+                buffers_.push_back(
                     boost::asio::buffer(chunks.data(), chunks.size() *
                         sizeof(parcel_buffer_type::transmission_chunk_type)));
 
                 // add main buffer holding data which was serialized normally
-                buffers.push_back(boost::asio::buffer(buffer_.data_));
+                buffers_.push_back(boost::asio::buffer(buffer_.data_));
 
                 // now add chunks themselves, those hold zero-copy serialized chunks
                 for (serialization::serialization_chunk& c : buffer_.chunks_)
                 {
                     if (c.type_ == serialization::chunk_type_pointer)
-                        buffers.push_back(boost::asio::buffer(c.data_.cpos_, c.size_));
+                        buffers_.push_back(boost::asio::buffer(c.data_.cpos_, c.size_));
                 }
             }
             else {
                 // add main buffer holding data which was serialized normally
-                buffers.push_back(boost::asio::buffer(buffer_.data_));
+                buffers_.push_back(boost::asio::buffer(buffer_.data_));
+            }
+
+            // Most messages fit into the socket buffer, try to hand them to
+            // the kernel right away
+            std::size_t bytes = try_write();
+            if (buffers_.empty())
+            {
+                handle_write(boost::system::error_code(), bytes);
+                return;
             }
 
             // this additional wrapping of the handler into a bind object is
@@ -152,11 +173,71 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
             using util::placeholders::_1;
             using util::placeholders::_2;
-            boost::asio::async_write(socket_, buffers,
+            boost::asio::async_write(socket_, buffers_,
                 util::bind(f, shared_from_this(), _1, _2));
         }
 
     private:
+        /// Write as much of the pending buffers as possible without blocking
+        /// using a single sendmsg call, remove what has been written from
+        /// the list of buffers. Any error is left for the asynchronous write
+        /// of the remaining data to report.
+        std::size_t try_write()
+        {
+#if !defined(HPX_WINDOWS)
+#if defined(IOV_MAX)
+            std::size_t const max_iov = IOV_MAX;
+#else
+            std::size_t const max_iov = 1024;
+#endif
+#if defined(MSG_NOSIGNAL)
+            int const flags = MSG_DONTWAIT | MSG_NOSIGNAL;
+#else
+            int const flags = MSG_DONTWAIT;
+#endif
+            std::size_t const num_iov = (std::min)(buffers_.size(), max_iov);
+
+            iov_.resize(num_iov);
+            for (std::size_t i = 0; i != num_iov; ++i)
+            {
+                iov_[i].iov_base = const_cast<void*>(
+                    boost::asio::buffer_cast<void const*>(buffers_[i]));
+                iov_[i].iov_len = boost::asio::buffer_size(buffers_[i]);
+            }
+
+            msghdr msg = msghdr();
+            msg.msg_iov = iov_.data();
+            msg.msg_iovlen = static_cast<decltype(msg.msg_iovlen)>(num_iov);
+
+            ssize_t result = 0;
+            do {
+                result = ::sendmsg(socket_.native_handle(), &msg, flags);
+            } while (result < 0 && errno == EINTR);
+
+            if (result <= 0)
+                return 0;
+
+            // drop the buffers which have been written completely and adjust
+            // the first partially written one
+            std::size_t bytes = static_cast<std::size_t>(result);
+            std::size_t remaining = bytes;
+            std::size_t i = 0;
+            while (i != buffers_.size() &&
+                remaining >= boost::asio::buffer_size(buffers_[i]))
+            {
+                remaining -= boost::asio::buffer_size(buffers_[i]);
+                ++i;
+            }
+            buffers_.erase(buffers_.begin(), buffers_.begin() + i);
+            if (remaining != 0)
+                buffers_.front() = buffers_.front() + remaining;
+
+            return bytes;
+#else
+            return 0;
+#endif
+        }
+
         /// handle completed write operation
         void handle_write(boost::system::error_code const& e, std::size_t bytes)
         {
@@ -210,6 +291,13 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
         bool ack_;
 
+        /// The buffers of the message currently being written, kept around
+        /// to avoid reallocating them for every message.
+        std::vector<boost::asio::const_buffer> buffers_;
+#if !defined(HPX_WINDOWS)
+        std::vector<iovec> iov_;
+#endif
+
         /// the other (receiving) end of this connection
         parcelset::locality there_;
 
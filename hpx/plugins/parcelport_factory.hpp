@@ -91,6 +91,12 @@ namespace hpx { namespace plugins
                 "max_connections_per_locality = "
                     "${HPX_PARCEL_" + name_uc + "_MAX_CONNECTIONS_PER_LOCALITY:"
                     "$[hpx.parcel.max_connections_per_locality]}",
+                "send_pipeline_depth = "
+                    "${HPX_PARCEL_" + name_uc + "_SEND_PIPELINE_DEPTH:"
+                    "$[hpx.parcel.send_pipeline_depth]}",
+                "send_pipeline_threshold = "
+                    "${HPX_PARCEL_" + name_uc + "_SEND_PIPELINE_THRESHOLD:"
+                    "$[hpx.parcel.send_pipeline_threshold]}",
                 "max_message_size =  ${HPX_PARCEL_" + name_uc +
                     "_MAX_MESSAGE_SIZE:$[hpx.parcel.max_message_size]}",
                 "max_outbound_message_size =  ${HPX_PARCEL_" + name_uc +
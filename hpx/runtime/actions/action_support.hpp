@@ -264,6 +264,9 @@ namespace hpx { namespace actions
 
         HPX_SERIALIZATION_POLYMORPHIC_ABSTRACT(base_action);
 
+        /// Return the id the concrete action type is serialized with
+        virtual std::uint32_t hpx_serialization_get_id() const = 0;
+
         virtual void load_schedule(serialization::input_archive& ar,
             naming::gid_type&& target, naming::address_type lva,
             std::size_t num_thread) = 0;
@@ -660,13 +660,17 @@ namespace hpx { namespace actions
         primary_namespace_allocate_action_id,
         primary_namespace_begin_migration_action_id,
         primary_namespace_bind_gid_action_id,
+        primary_namespace_bind_gid_bulk_action_id,
         primary_namespace_colocate_action_id,
         primary_namespace_decrement_credit_action_id,
         primary_namespace_end_migration_action_id,
         primary_namespace_increment_credit_action_id,
         primary_namespace_resolve_gid_action_id,
+        primary_namespace_resolve_gid_bulk_action_id,
+        primary_namespace_resolve_gid_prefetch_action_id,
         primary_namespace_route_action_id,
         primary_namespace_unbind_gid_action_id,
+        primary_namespace_unbind_gid_bulk_action_id,
         primary_namespace_statistics_counter_action_id,
         remove_from_connection_cache_action_id,
         set_value_action_agas_bool_response_type_id,
@@ -882,6 +886,9 @@ namespace hpx { namespace serialization
 #define HPX_ACTION_USES_HUGE_STACK(action)                                    \
     HPX_ACTION_USES_STACK(action, threads::thread_stacksize_huge)             \
 /**/
+#define HPX_ACTION_USES_NO_STACK(action)                                      \
+    HPX_ACTION_USES_STACK(action, threads::thread_stacksize_nostack)          \
+/**/
 // This macro is deprecated. It expands to an inline function which will emit a
 // warning.
 #define HPX_ACTION_DOES_NOT_SUSPEND(action)                                    \
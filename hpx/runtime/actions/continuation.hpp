@@ -16,6 +16,7 @@
 #include <hpx/runtime/naming/id_type.hpp>
 #include <hpx/runtime/naming/name.hpp>
 #include <hpx/runtime/serialization/base_object.hpp>
+#include <hpx/runtime/serialization/detail/polymorphic_id_factory.hpp>
 #include <hpx/runtime/serialization/serialize.hpp>
 #include <hpx/runtime/trigger_lco.hpp>
 #include <hpx/throw_exception.hpp>
@@ -291,6 +292,8 @@ namespace hpx { namespace actions
         }
         HPX_SERIALIZATION_POLYMORPHIC_ABSTRACT(continuation);
 
+        virtual std::uint32_t hpx_serialization_get_id() const = 0;
+
 #if defined(HPX_HAVE_COMPONENT_GET_GID_COMPATIBILITY)
         naming::id_type const& get_gid() const
         {
@@ -692,6 +695,7 @@ namespace hpx { namespace actions {
             typed_continuation
           , detail::get_continuation_name<typed_continuation>()
         )
+        HPX_SERIALIZATION_ADD_GET_ID_MEMBER(typed_continuation)
 
     protected:
         function_type f_;
@@ -815,6 +819,7 @@ namespace hpx { namespace actions {
             typed_continuation
           , detail::get_continuation_name<typed_continuation>()
         )
+        HPX_SERIALIZATION_ADD_GET_ID_MEMBER(typed_continuation)
     };
 }}
 
@@ -946,6 +951,7 @@ namespace hpx { namespace actions
             typed_continuation
           , "hpx_void_typed_continuation"
         )
+        HPX_SERIALIZATION_ADD_GET_ID_MEMBER(typed_continuation)
 
         function_type f_;
     };
@@ -23,6 +23,7 @@
 #include <hpx/runtime/get_locality_id.hpp>
 #include <hpx/runtime/parcelset/detail/per_action_data_counter_registry.hpp>
 #include <hpx/runtime/serialization/base_object.hpp>
+#include <hpx/runtime/serialization/detail/polymorphic_id_factory.hpp>
 #include <hpx/runtime/serialization/input_archive.hpp>
 #include <hpx/runtime/serialization/output_archive.hpp>
 #include <hpx/runtime/threads/thread_helpers.hpp>
@@ -456,6 +457,7 @@ namespace hpx { namespace actions
         }
         HPX_SERIALIZATION_POLYMORPHIC_WITH_NAME(
             transfer_action, detail::get_action_name<derived_type>())
+        HPX_SERIALIZATION_ADD_GET_ID_MEMBER(transfer_action)
 
         void load_schedule(serialization::input_archive& ar,
             naming::gid_type&& target, naming::address_type lva,
@@ -26,7 +26,7 @@
 #include <hpx/runtime/naming/name.hpp>
 #include <hpx/runtime/parcelset_fwd.hpp>
 #include <hpx/state.hpp>
-#include <hpx/util/cache/lru_cache.hpp>
+#include <hpx/util/cache/clock_cache.hpp>
 #include <hpx/util/cache/statistics/local_full_statistics.hpp>
 #include <hpx/util_fwd.hpp>
 #include <hpx/util/function.hpp>
@@ -75,18 +75,27 @@ public:
     // {{{ gva cache
     struct gva_cache_key;
 
-    typedef hpx::util::cache::lru_cache<
+    typedef hpx::util::cache::clock_cache<
         gva_cache_key
       , gva
       , hpx::util::cache::statistics::local_full_statistics
     > gva_cache_type;
+
+    // The gva cache is partitioned into shards, each guarded by its own lock,
+    // which allows for address lookups to proceed concurrently as long as
+    // they refer to different shards. Each cached range is stored in a single
+    // shard, the last shard holds all ranges spanning more than one block of
+    // ids.
+    struct gva_cache_shard;
+    typedef std::vector<std::shared_ptr<gva_cache_shard> >
+        gva_cache_shards_type;
     // }}}
 
     typedef std::set<naming::gid_type> migrated_objects_table_type;
     typedef std::map<naming::gid_type, std::int64_t> refcnt_requests_type;
 
-    mutable mutex_type gva_cache_mtx_;
-    std::shared_ptr<gva_cache_type> gva_cache_;
+    gva_cache_shards_type gva_cache_shards_;
+    boost::atomic<bool> gva_cache_has_ranges_;
 
     mutable mutex_type migrated_objects_mtx_;
     migrated_objects_table_type migrated_objects_table_;
@@ -107,6 +116,7 @@ public:
 
     bool const caching_;
     bool const range_caching_;
+    std::size_t const cache_prefetch_;
     threads::thread_priority const action_priority_;
 
     std::uint64_t rts_lva_;
@@ -235,6 +245,34 @@ protected:
       , gva const& g
         );
 
+    naming::address resolve_full_update_cache(
+        primary_namespace::resolved_type const& rep
+      , naming::gid_type const& id
+        );
+    naming::address resolve_prefetch_postproc(
+        future<std::vector<primary_namespace::resolved_type> > f
+      , std::vector<naming::gid_type> const& ids
+        );
+
+    void resolve_bulk_postproc(
+        future<std::vector<primary_namespace::resolved_type> > f
+      , std::vector<naming::gid_type> const& ids
+      , std::vector<std::size_t> const& indices
+      , std::shared_ptr<std::vector<naming::address> > const& addrs
+        );
+    void bind_bulk_postproc(
+        future<std::vector<primary_namespace::bind_gid_response_type> > f
+      , std::vector<primary_namespace::bind_gid_request_type> const& requests
+      , std::vector<std::size_t> const& indices
+      , std::shared_ptr<std::vector<bool> > const& results
+        );
+    void unbind_bulk_postproc(
+        future<std::vector<primary_namespace::unbind_gid_response_type> > f
+      , std::vector<primary_namespace::unbind_gid_request_type> const& requests
+      , std::vector<std::size_t> const& indices
+      , std::shared_ptr<std::vector<naming::address> > const& addrs
+        );
+
     /// Maintain list of migrated objects
     bool was_object_migrated_locked(
         naming::gid_type const& id
@@ -265,6 +303,31 @@ private:
       , error_code& ec
         );
 
+    /// Return the shard of the gva cache responsible for the block of ids
+    /// the given id belongs to.
+    std::size_t get_gva_cache_shard_index(naming::gid_type const& id) const;
+    gva_cache_shard& get_gva_cache_shard(naming::gid_type const& id) const;
+
+    /// Return the shard of the gva cache the entry for the given range of
+    /// ids is stored in.
+    std::size_t get_gva_cache_shard_index(
+        naming::gid_type const& id, std::uint64_t count) const;
+
+    /// Return the shard of the gva cache holding the ranges which span more
+    /// than one block of ids.
+    std::size_t get_gva_cache_range_shard_index() const
+    {
+        return gva_cache_shards_.size() - 1;
+    }
+
+    /// Look up the given id in the given shard of the gva cache.
+    bool get_cache_entry(
+        gva_cache_shard& shard
+      , gva_cache_key const& k
+      , gva_cache_key& idbase_key
+      , gva& gva
+        );
+
     // Helper functions to access the current cache statistics
     std::uint64_t get_cache_entries(bool);
     std::uint64_t get_cache_hits(bool);
@@ -605,6 +668,37 @@ public:
         return bind_range_async(id, 1, addr, 0, locality);
     }
 
+    /// \brief Bind a number of global addresses to their local addresses.
+    ///
+    /// This is equivalent to calling \a bind_async for each of the given
+    /// ids, except that all ids managed by the same primary namespace
+    /// instance are sent using a single request. All successfully bound
+    /// ids are put into the local cache.
+    ///
+    /// \param ids        [in] The global addresses which have to be bound.
+    /// \param addrs      [in] The local addresses to bind the corresponding
+    ///                   global address to, this has to have the same size
+    ///                   as \a ids.
+    /// \param locality   [in] The locality the ids are bound on.
+    ///
+    /// \returns          A future referring to one result per given id, in
+    ///                   the same order as \a ids.
+    hpx::future<std::vector<bool> > bind_bulk(
+        std::vector<naming::gid_type> const& ids
+      , std::vector<naming::address> const& addrs
+      , naming::gid_type const& locality
+        );
+
+    hpx::future<std::vector<bool> > bind_bulk(
+        std::vector<naming::gid_type> const& ids
+      , std::vector<naming::address> const& addrs
+      , std::uint32_t locality_id
+        )
+    {
+        return bind_bulk(ids, addrs,
+            naming::get_gid_from_locality_id(locality_id));
+    }
+
     /// \brief Bind unique range of global ids to given base address
     ///
     /// Every locality needs to be able to bind global ids to different
@@ -843,6 +937,16 @@ public:
       , std::uint64_t count = 1
         );
 
+    /// \brief Unbind a number of global addresses, sending a single request
+    ///        to each of the primary namespace instances involved.
+    ///
+    /// The returned future refers to the addresses the ids were bound to,
+    /// in the same order as \a ids. The unbound ids are removed from the
+    /// local cache.
+    hpx::future<std::vector<naming::address> > unbind_bulk(
+        std::vector<naming::gid_type> const& ids
+        );
+
     /// \brief Test whether the given address refers to a local object.
     ///
     /// This function will test whether the given address refers to an object
@@ -993,6 +1097,19 @@ public:
         return resolve_async(id.get_gid());
     }
 
+    /// \brief Resolve a number of global addresses at once.
+    ///
+    /// All ids which can't be resolved from the local cache are grouped by
+    /// the primary namespace instance managing them, and each group is
+    /// resolved using a single request. The cache is updated with all of
+    /// the results.
+    ///
+    /// \returns          A future referring to the resolved addresses, in
+    ///                   the same order as \a ids.
+    hpx::future<std::vector<naming::address> > resolve_bulk(
+        std::vector<naming::gid_type> const& ids
+        );
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<naming::id_type> get_colocation_id_async(
         naming::id_type const& id
@@ -1374,6 +1491,13 @@ public:
       , error_code& ec = throws
         );
 
+    /// \warning This function is for internal use only. It is dangerous and
+    ///          may break your code if you use it.
+    void remove_cache_entries(
+        std::vector<naming::gid_type> const& ids
+      , error_code& ec = throws
+        );
+
     /// \warning This function is for internal use only. It is dangerous and
     ///          may break your code if you use it.
     void clear_cache(
@@ -16,6 +16,9 @@
 #include <hpx/runtime/naming/address.hpp>
 #include <hpx/util/tuple.hpp>
 
+#include <boost/exception_ptr.hpp>
+
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <utility>
@@ -30,6 +33,14 @@ struct HPX_EXPORT primary_namespace
 {
     typedef hpx::util::tuple<naming::gid_type, gva, naming::gid_type>
         resolved_type;
+    typedef hpx::util::tuple<gva, naming::gid_type, naming::gid_type>
+        bind_gid_request_type;
+    typedef hpx::util::tuple<std::uint64_t, naming::gid_type>
+        unbind_gid_request_type;
+    typedef hpx::util::tuple<bool, boost::exception_ptr>
+        bind_gid_response_type;
+    typedef hpx::util::tuple<naming::address, boost::exception_ptr>
+        unbind_gid_response_type;
 
     static naming::gid_type get_service_instance(std::uint32_t service_locality_id);
 
@@ -48,7 +59,7 @@ struct HPX_EXPORT primary_namespace
         return is_service_instance(id.get_gid());
     }
 
-    primary_namespace();
+    explicit primary_namespace(std::size_t num_partitions);
     ~primary_namespace();
 
     naming::address::address_type ptr() const;
@@ -62,18 +73,30 @@ struct HPX_EXPORT primary_namespace
     bool bind_gid(gva g, naming::gid_type id, naming::gid_type locality);
     future<bool> bind_gid_async(gva g, naming::gid_type id, naming::gid_type locality);
 
+    // All ids passed to the bulk operations have to be managed by the same
+    // primary namespace instance.
+    future<std::vector<bind_gid_response_type> >
+    bind_gid_bulk(std::vector<bind_gid_request_type> const& requests);
+
     void route(parcelset::parcel && p,
         util::function_nonser<void(boost::system::error_code const&,
         parcelset::parcel const&)> && f);
 
     resolved_type resolve_gid(naming::gid_type id);
     future<resolved_type> resolve_full(naming::gid_type id);
+    future<std::vector<resolved_type> >
+    resolve_full_bulk(std::vector<naming::gid_type> const& ids);
+    // resolve the first id, and its neighbours unless they are being migrated
+    future<std::vector<resolved_type> >
+    resolve_full_prefetch(std::vector<naming::gid_type> const& ids);
 
     future<id_type> colocate(naming::gid_type id);
 
     naming::address unbind_gid(std::uint64_t count, naming::gid_type id);
     future<naming::address>
     unbind_gid_async(std::uint64_t count, naming::gid_type id);
+    future<std::vector<unbind_gid_response_type> >
+    unbind_gid_bulk(std::vector<unbind_gid_request_type> const& requests);
 
     future<std::int64_t> increment_credit(
         std::int64_t credits
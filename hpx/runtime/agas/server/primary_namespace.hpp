@@ -16,13 +16,16 @@
 #include <hpx/runtime/agas/gva.hpp>
 #include <hpx/runtime/actions/component_action.hpp>
 #include <hpx/runtime/components/server/fixed_component_base.hpp>
+#include <hpx/runtime/naming/address.hpp>
 #include <hpx/runtime/naming/id_type.hpp>
 #include <hpx/runtime/naming/name.hpp>
 #include <hpx/traits/action_message_handler.hpp>
 #include <hpx/traits/action_serialization_filter.hpp>
+#include <hpx/util/serialize_exception.hpp>
 #include <hpx/util/tuple.hpp>
 
 #include <boost/atomic.hpp>
+#include <boost/exception_ptr.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -129,24 +132,52 @@ struct HPX_EXPORT primary_namespace
 
     typedef hpx::util::tuple<naming::gid_type, gva, naming::gid_type>
         resolved_type;
+
+    // gva, id, and locality of a single bind_gid request
+    typedef hpx::util::tuple<gva, naming::gid_type, naming::gid_type>
+        bind_gid_request_type;
+
+    // count and id of a single unbind_gid request
+    typedef hpx::util::tuple<std::uint64_t, naming::gid_type>
+        unbind_gid_request_type;
+
+    // result of a single bind_gid/unbind_gid request of a bulk operation,
+    // along with the exception it raised (if any)
+    typedef hpx::util::tuple<bool, boost::exception_ptr>
+        bind_gid_response_type;
+    typedef hpx::util::tuple<naming::address, boost::exception_ptr>
+        unbind_gid_response_type;
     // }}}
 
   private:
-    // REVIEW: Separate mutexes might reduce contention here. This has to be
-    // investigated carefully.
-    mutex_type mutex_;
-
-    gva_table_type gvas_;
-    refcnt_table_type refcnts_;
     typedef std::map<
             naming::gid_type,
             hpx::util::tuple<bool, std::size_t, lcos::local::condition_variable_any>
         > migration_table_type;
 
+    // The tables are partitioned by blocks of consecutive ids, each partition
+    // is guarded by its own mutex. All table entries for a given id live in
+    // the same partition, which allows for operations on different ids to
+    // proceed concurrently. A bound range of ids spanning more than one block
+    // is stored in an additional partition, which is always locked last.
+    struct partition
+    {
+        mutex_type mutex_;
+
+        gva_table_type gvas_;
+        refcnt_table_type refcnts_;
+        migration_table_type migrating_objects_;
+    };
+
+    std::size_t const num_partitions_;
+    std::unique_ptr<partition[]> partitions_;
+    boost::atomic<bool> has_range_bindings_;
+
     std::string instance_name_;
+
+    mutex_type allocate_mutex_;
     naming::gid_type next_id_;      // next available gid
     naming::gid_type locality_;     // our locality id
-    migration_table_type migrating_objects_;
 
     struct update_time_on_exit;
 
@@ -225,7 +256,8 @@ struct HPX_EXPORT primary_namespace
     /// Dump the credit counts of all matching ranges. Expects that \p l
     /// is locked.
     void dump_refcnt_matches(
-        refcnt_table_type::iterator lower_it
+        partition& part
+      , refcnt_table_type::iterator lower_it
       , refcnt_table_type::iterator upper_it
       , naming::gid_type const& lower
       , naming::gid_type const& upper
@@ -234,20 +266,47 @@ struct HPX_EXPORT primary_namespace
         );
 #endif
 
-    // helper function
+    // helper functions
+    std::size_t get_partition_index(naming::gid_type const& id) const;
+    partition& get_partition(naming::gid_type const& id);
+
+    /// Return the partition the binding for the given range of ids is
+    /// stored in.
+    std::size_t get_partition_index(
+        naming::gid_type const& id, std::uint64_t count) const;
+
+    /// Return the partition holding the bindings which span more than one
+    /// block of ids.
+    std::size_t get_range_partition_index() const
+    {
+        return num_partitions_ - 1;
+    }
+
+    /// Return the indices (in ascending order) of all partitions which may
+    /// hold a binding covering the given id, including the partition the
+    /// binding for the given range of ids is stored in.
+    std::vector<std::size_t> get_partitions(
+        naming::gid_type const& id, std::uint64_t count) const;
+
+    /// Return the binding covering the given id, if any.
+    static gva_table_type::const_iterator find_binding(
+        gva_table_type const& gvas, naming::gid_type const& id);
+
     void wait_for_migration_locked(
         std::unique_lock<mutex_type>& l
+      , partition& part
       , naming::gid_type id
       , error_code& ec);
 
+    bool is_migrating_locked(
+        std::unique_lock<mutex_type>& l
+      , partition& part
+      , naming::gid_type id);
+
   public:
-    primary_namespace()
-      : base_type(HPX_AGAS_PRIMARY_NS_MSB, HPX_AGAS_PRIMARY_NS_LSB)
-      , mutex_()
-      , instance_name_()
-      , next_id_(naming::invalid_gid)
-      , locality_(naming::invalid_gid)
-    {}
+    /// The tables are split into the given number of partitions, plus one
+    /// for the bindings spanning several blocks of ids.
+    explicit primary_namespace(std::size_t num_partitions = 1);
 
     void finalize();
 
@@ -283,6 +342,29 @@ struct HPX_EXPORT primary_namespace
       , naming::gid_type locality
         );
 
+    // bulk versions of bind_gid, resolve_gid, and unbind_gid, these handle
+    // all given requests using a single action invocation. A failing bind or
+    // unbind request doesn't affect the other requests, its error is
+    // reported in the corresponding response.
+    std::vector<bind_gid_response_type> bind_gid_bulk(
+        std::vector<bind_gid_request_type> const& requests
+        );
+
+    std::vector<resolved_type> resolve_gid_bulk(
+        std::vector<naming::gid_type> const& ids
+        );
+
+    // resolve the first of the given ids like resolve_gid, the remaining ids
+    // are speculatively resolved neighbours which are reported as unresolved
+    // instead of waiting for them if they are being migrated
+    std::vector<resolved_type> resolve_gid_prefetch(
+        std::vector<naming::gid_type> const& ids
+        );
+
+    std::vector<unbind_gid_response_type> unbind_gid_bulk(
+        std::vector<unbind_gid_request_type> const& requests
+        );
+
     // API
     std::pair<naming::id_type, naming::address> begin_migration(naming::gid_type id);
     bool end_migration(naming::gid_type id);
@@ -315,6 +397,7 @@ struct HPX_EXPORT primary_namespace
   private:
     resolved_type resolve_gid_locked(
         std::unique_lock<mutex_type>& l
+      , partition& part
       , naming::gid_type const& gid
       , error_code& ec
         );
@@ -341,6 +424,7 @@ struct HPX_EXPORT primary_namespace
 
     void resolve_free_list(
         std::unique_lock<mutex_type>& l
+      , partition& part
       , std::list<refcnt_table_type::iterator> const& free_list
       , std::list<free_entry>& free_entry_list
       , naming::gid_type const& lower
@@ -366,13 +450,17 @@ struct HPX_EXPORT primary_namespace
   public:
     HPX_DEFINE_COMPONENT_ACTION(primary_namespace, allocate);
     HPX_DEFINE_COMPONENT_ACTION(primary_namespace, bind_gid);
+    HPX_DEFINE_COMPONENT_ACTION(primary_namespace, bind_gid_bulk);
     HPX_DEFINE_COMPONENT_ACTION(primary_namespace, begin_migration);
     HPX_DEFINE_COMPONENT_ACTION(primary_namespace, colocate);
     HPX_DEFINE_COMPONENT_ACTION(primary_namespace, end_migration);
     HPX_DEFINE_COMPONENT_ACTION(primary_namespace, decrement_credit);
     HPX_DEFINE_COMPONENT_ACTION(primary_namespace, increment_credit);
     HPX_DEFINE_COMPONENT_ACTION(primary_namespace, resolve_gid);
+    HPX_DEFINE_COMPONENT_ACTION(primary_namespace, resolve_gid_bulk);
+    HPX_DEFINE_COMPONENT_ACTION(primary_namespace, resolve_gid_prefetch);
     HPX_DEFINE_COMPONENT_ACTION(primary_namespace, unbind_gid);
+    HPX_DEFINE_COMPONENT_ACTION(primary_namespace, unbind_gid_bulk);
     HPX_DEFINE_COMPONENT_ACTION(primary_namespace, route);
     HPX_DEFINE_COMPONENT_ACTION(primary_namespace, statistics_counter);
 
@@ -403,6 +491,13 @@ HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::primary_namespace::bind_gid_action,
     primary_namespace_bind_gid_action)
 
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::primary_namespace::bind_gid_bulk_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::primary_namespace::bind_gid_bulk_action,
+    primary_namespace_bind_gid_bulk_action)
+
 HPX_ACTION_USES_MEDIUM_STACK(
     hpx::agas::server::primary_namespace::begin_migration_action)
 
@@ -438,6 +533,20 @@ HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::primary_namespace::resolve_gid_action,
     primary_namespace_resolve_gid_action)
 
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::primary_namespace::resolve_gid_bulk_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::primary_namespace::resolve_gid_bulk_action,
+    primary_namespace_resolve_gid_bulk_action)
+
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::primary_namespace::resolve_gid_prefetch_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::primary_namespace::resolve_gid_prefetch_action,
+    primary_namespace_resolve_gid_prefetch_action)
+
 HPX_ACTION_USES_MEDIUM_STACK(
     hpx::agas::server::primary_namespace::colocate_action)
 
@@ -452,6 +561,13 @@ HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::primary_namespace::unbind_gid_action,
     primary_namespace_unbind_gid_action)
 
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::primary_namespace::unbind_gid_bulk_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::primary_namespace::unbind_gid_bulk_action,
+    primary_namespace_unbind_gid_bulk_action)
+
 HPX_ACTION_USES_MEDIUM_STACK(
     hpx::agas::server::primary_namespace::route_action)
 
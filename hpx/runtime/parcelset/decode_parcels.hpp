@@ -14,13 +14,17 @@
 #include <hpx/runtime/naming/resolver_client.hpp>
 #include <hpx/runtime/parcelset/parcel.hpp>
 #include <hpx/runtime/parcelset/detail/parcel_route_handler.hpp>
+#include <hpx/runtime/parcelset/detail/parcel_tracer.hpp>
+#include <hpx/runtime/parcelset/detail/receive_buffer_pool.hpp>
 #include <hpx/runtime/serialization/serialize.hpp>
 #include <hpx/runtime_fwd.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
 #include <hpx/util/high_resolution_timer.hpp>
 
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <sstream>
 #include <utility>
 #include <vector>
@@ -89,6 +93,36 @@ namespace hpx { namespace parcelset
         return chunks;
     }
 
+    namespace detail
+    {
+        // Hands the zero-copy chunks of a received message over to the
+        // deserialized objects
+        template <typename Buffer>
+        struct parcel_buffer_chunk_owner : serialization::chunk_owner
+        {
+            explicit parcel_buffer_chunk_owner(Buffer& buffer)
+              : buffer_(buffer)
+            {}
+
+            std::shared_ptr<char> adopt(void const* data, std::size_t size)
+            {
+                typedef typename Buffer::chunk_type chunk_type;
+                for (chunk_type& c : buffer_.chunks_)
+                {
+                    if (c.data() == data && c.size() == size)
+                    {
+                        std::shared_ptr<chunk_type> holder =
+                            std::make_shared<chunk_type>(std::move(c));
+                        return std::shared_ptr<char>(holder, holder->data());
+                    }
+                }
+                return std::shared_ptr<char>();
+            }
+
+            Buffer& buffer_;
+        };
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Parcelport, typename Buffer>
     void decode_message_with_chunks(
@@ -106,27 +140,32 @@ namespace hpx { namespace parcelset
             try {
                 // mark start of serialization
                 util::high_resolution_timer timer;
+                std::int64_t receive_time = util::high_resolution_clock::now();
                 std::int64_t overall_add_parcel_time = 0;
                 performance_counters::parcels::data_point& data =
                     buffer.data_point_;
 
                 {
                     // De-serialize the parcel data
+                    detail::parcel_buffer_chunk_owner<Buffer> owner(buffer);
                     serialization::input_archive archive(buffer.data_,
-                        inbound_data_size, &chunks);
+                        inbound_data_size, &chunks, &owner);
 
                     if(parcel_count == 0)
                         archive >> parcel_count; //-V128
                     for(std::size_t i = 0; i != parcel_count; ++i)
                     {
-#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
                         std::size_t archive_pos = archive.current_pos();
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
                         std::int64_t serialize_time = timer.elapsed_nanoseconds();
 #endif
                         // de-serialize parcel and add it to incoming parcel queue
                         parcel p;
                         bool migrated = p.load_schedule(archive, num_thread);
 
+                        detail::trace_parcel(p, detail::trace_receive,
+                            archive.current_pos() - archive_pos, receive_time);
+
                         std::int64_t add_parcel_time = timer.elapsed_nanoseconds();
 
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
@@ -181,6 +220,10 @@ namespace hpx { namespace parcelset
                     overall_add_parcel_time;
 
                 pp.add_received_data(data);
+
+                // the buffers can be used for receiving other messages now
+                detail::receive_buffer_pool::instance()
+                    .reclaim_parcel_buffer(buffer);
             }
             catch (hpx::exception const& e) {
                 LPT_(error)
@@ -0,0 +1,69 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_DETAIL_BATCH_FLUSH_CONTROL_HPP
+#define HPX_PARCELSET_DETAIL_BATCH_FLUSH_CONTROL_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/parcelset/policies/message_handler.hpp>
+#include <hpx/util/function.hpp>
+#include <hpx/util/pool_timer.hpp>
+#include <hpx/util/steady_clock.hpp>
+
+#include <string>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    /// Decides when the batch of parcels held back by a message handler
+    /// (like the coalescing message handler or the parcel aggregator) has to
+    /// be flushed. It owns the deadline timer of the batch and remembers
+    /// whether buffering has been stopped. All functions have to be called
+    /// while holding the lock protecting the batch of the message handler.
+    class HPX_EXPORT batch_flush_control
+    {
+        HPX_NON_COPYABLE(batch_flush_control);
+
+    public:
+        /// \param on_timer     invoked once the deadline of a batch expired
+        /// \param on_terminate invoked if the timer is stopped at shutdown
+        /// \param allow_background_flush whether the batch may be flushed
+        ///                     from the background work of the scheduler
+        batch_flush_control(util::function_nonser<bool()> const& on_timer,
+            util::function_nonser<void()> const& on_terminate,
+            std::string const& description, bool allow_background_flush);
+
+        /// Return whether parcels are sent right away instead of being
+        /// buffered
+        bool stopped() const
+        {
+            return stopped_;
+        }
+
+        /// Start the deadline timer of the current batch unless it is
+        /// running already
+        void start_timer(util::steady_duration const& interval);
+
+        bool is_timer_started() const
+        {
+            return timer_.is_started();
+        }
+
+        /// Prepare flushing the current batch, return false if the batch
+        /// should be left alone for the given flush mode. Buffering stops if
+        /// stop_buffering is set, and the deadline timer is canceled if
+        /// either that or cancel_timer is set.
+        bool prepare_flush(policies::message_handler::flush_mode mode,
+            bool stop_buffering, bool cancel_timer);
+
+    private:
+        util::pool_timer timer_;
+        bool stopped_;
+        bool allow_background_flush_;
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
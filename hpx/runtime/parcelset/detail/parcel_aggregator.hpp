@@ -0,0 +1,78 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_DETAIL_PARCEL_AGGREGATOR_HPP
+#define HPX_PARCELSET_DETAIL_PARCEL_AGGREGATOR_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/parcelset/detail/batch_flush_control.hpp>
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/runtime/parcelset/parcel.hpp>
+#include <hpx/runtime/parcelset/policies/message_handler.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    /// The parcel aggregator collects the parcels of all actions sent to the
+    /// same destination locality and hands them to the parcelport as a
+    /// single batch, which ends up being encoded into one message. A batch
+    /// is sent once it holds the configured number of parcels or once the
+    /// aggregation interval has passed since its first parcel. Pending
+    /// batches are flushed from the background work of the scheduler only if
+    /// this was enabled.
+    class HPX_EXPORT parcel_aggregator
+      : public policies::message_handler
+    {
+        HPX_NON_COPYABLE(parcel_aggregator);
+
+        typedef lcos::local::spinlock mutex_type;
+
+    public:
+        parcel_aggregator(parcelport* pp, locality const& dest,
+            std::size_t max_parcels, std::size_t interval,
+            bool allow_background_flush);
+
+        void put_parcel(locality const& dest, parcel p, write_handler_type f);
+
+        bool flush(policies::message_handler::flush_mode mode,
+            bool stop_buffering = false);
+
+        std::int64_t get_parcels_count(bool reset);
+        std::int64_t get_messages_count(bool reset);
+
+    private:
+        bool timer_flush();
+        void flush_terminate();
+
+        bool flush_locked(std::unique_lock<mutex_type>& l,
+            policies::message_handler::flush_mode mode,
+            bool stop_buffering, bool cancel_timer);
+
+        mutable mutex_type mtx_;
+        parcelport* pp_;
+        locality dest_;
+        std::size_t max_parcels_;
+        std::size_t interval_;
+
+        std::vector<parcel> parcels_;
+        std::vector<write_handler_type> handlers_;
+
+        batch_flush_control flush_control_;
+        std::int64_t last_parcel_time_;
+
+        // performance counter data
+        std::int64_t num_parcels_;
+        std::int64_t num_messages_;
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -0,0 +1,150 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_DETAIL_PARCEL_TRACER_HPP
+#define HPX_PARCELSET_DETAIL_PARCEL_TRACER_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/error_code.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/runtime/parcelset_fwd.hpp>
+#include <hpx/util/static.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace parcelset
+{
+    namespace detail
+    {
+        /// The stages of the parcel pipeline a parcel trace event is recorded
+        /// for, the first three on the sending, the others on the receiving
+        /// locality.
+        enum parcel_trace_stage
+        {
+            trace_enqueue = 0,      ///< parcel was handed to the parcelhandler
+            trace_encode = 1,       ///< parcel was serialized
+            trace_send = 2,         ///< message holding the parcel was written
+            trace_receive = 3,      ///< message holding the parcel was read
+            trace_decode = 4,       ///< parcel header was de-serialized
+            trace_schedule = 5      ///< thread executing the action was created
+        };
+
+        /// The parcel tracer keeps ring buffers of time stamped events for
+        /// the individual parcels passing through this locality, one for each
+        /// worker thread and one shared by all other threads. The trace
+        /// can be written in the Chrome trace event format (JSON), which
+        /// shows the time each parcel spent in each stage of the pipeline.
+        ///
+        /// Tracing relies on the parcel ids which are available only if HPX
+        /// was configured with HPX_WITH_PARCEL_PROFILING=On, it is enabled at
+        /// runtime using hpx.parcel.tracing=1.
+        class HPX_EXPORT parcel_tracer
+        {
+            HPX_NON_COPYABLE(parcel_tracer);
+
+        public:
+            parcel_tracer();
+
+            static parcel_tracer& instance();
+
+            bool enabled() const
+            {
+                return enabled_;
+            }
+
+            /// Record an event for the given parcel, the time stamp defaults
+            /// to the current time.
+            void record(parcel const& p, parcel_trace_stage stage,
+                std::size_t size = 0, std::int64_t timestamp = 0);
+
+            /// Write all recorded events in the Chrome trace event format.
+            void dump(std::ostream& os) const;
+            void dump(std::string const& filename, error_code& ec = throws) const;
+
+            /// Write the trace to the file configured using
+            /// hpx.parcel.tracing_file, if any. The id of this locality is
+            /// inserted in front of the file extension.
+            void dump_at_shutdown() const;
+
+            /// Return the name of the file the trace of the given locality is
+            /// written to at shutdown.
+            static std::string get_trace_filename(std::string const& filename,
+                std::uint32_t locality_id);
+
+            /// Discard all recorded events.
+            void clear();
+
+        private:
+            struct tag {};
+            friend struct hpx::util::static_<parcel_tracer, tag>;
+
+            typedef lcos::local::spinlock mutex_type;
+
+            struct event
+            {
+                naming::gid_type parcel_id_;
+                char const* action_;
+                std::size_t size_;
+                std::int64_t timestamp_;
+                std::size_t thread_;
+                parcel_trace_stage stage_;
+            };
+
+            // the events recorded by one worker thread, the lock is contended
+            // only while the trace is written
+            struct event_buffer
+            {
+                event_buffer()
+                  : next_(0)
+                {}
+
+                void record(event const& e, std::size_t capacity);
+
+                mutable mutex_type mtx_;
+                std::vector<event> events_;
+                std::size_t next_;
+
+                // avoid false sharing between workers
+                char padding_[64];
+            };
+
+            event_buffer& get_buffer();
+            std::size_t get_buffer_capacity() const;
+
+            bool const enabled_;
+            std::size_t const capacity_;
+            std::string const filename_;
+
+            // the last buffer is shared by all threads which are not HPX
+            // worker threads (like the io threads of the parcelports)
+            std::size_t num_buffers_;
+            std::unique_ptr<event_buffer[]> buffers_;
+        };
+
+        /// Record a trace event for the given parcel if tracing is enabled.
+        inline void trace_parcel(parcel const& p, parcel_trace_stage stage,
+            std::size_t size = 0, std::int64_t timestamp = 0)
+        {
+            parcel_tracer& tracer = parcel_tracer::instance();
+            if (tracer.enabled())
+                tracer.record(p, stage, size, timestamp);
+        }
+    }
+
+    /// Write the parcel trace recorded so far by this locality to the given
+    /// file, using the Chrome trace event format (see hpx.parcel.tracing).
+    HPX_API_EXPORT void dump_parcel_trace(std::string const& filename,
+        error_code& ec = throws);
+}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -0,0 +1,92 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_DETAIL_RECEIVE_BUFFER_POOL_HPP
+#define HPX_PARCELSET_DETAIL_RECEIVE_BUFFER_POOL_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/util/static.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    /// The receive buffer pool recycles the buffers the parcelports receive
+    /// the message data and the zero-copy chunks into. The buffers are kept
+    /// in power of two size classes, separately for each NUMA domain. A
+    /// thread is handed the buffers of the domain it is running on.
+    class HPX_EXPORT receive_buffer_pool
+    {
+        HPX_NON_COPYABLE(receive_buffer_pool);
+
+    public:
+        typedef std::vector<char> buffer_type;
+
+        receive_buffer_pool();
+
+        static receive_buffer_pool& instance();
+
+        /// Return a buffer holding the given number of bytes, reuse a
+        /// pooled buffer if possible.
+        buffer_type get_buffer(std::size_t size);
+
+        /// Give a buffer back to the pool.
+        void reclaim_buffer(buffer_type && buffer);
+
+        /// Give all buffers of a received message back to the pool.
+        template <typename Buffer>
+        void reclaim_parcel_buffer(Buffer& buffer)
+        {
+            reclaim_buffer(std::move(buffer.data_));
+            for (buffer_type& c : buffer.chunks_)
+                reclaim_buffer(std::move(c));
+            buffer.chunks_.clear();
+        }
+
+        /// Release all pooled buffers.
+        void clear();
+
+        std::int64_t get_hits(bool reset);
+        std::int64_t get_misses(bool reset);
+
+    private:
+        struct tag {};
+        friend struct hpx::util::static_<receive_buffer_pool, tag>;
+
+        typedef lcos::local::spinlock mutex_type;
+
+        struct domain
+        {
+            domain(std::size_t num_classes)
+              : buffers_(num_classes)
+              , bytes_(0)
+              , hits_(0)
+              , misses_(0)
+            {}
+
+            mutex_type mtx_;
+            std::vector<std::vector<buffer_type> > buffers_;
+            std::size_t bytes_;
+            std::int64_t hits_;
+            std::int64_t misses_;
+        };
+
+        domain& get_domain();
+
+        bool enabled_;
+        std::size_t max_buffers_;
+        std::size_t max_bytes_;
+        std::size_t num_classes_;
+        std::vector<std::unique_ptr<domain> > domains_;
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
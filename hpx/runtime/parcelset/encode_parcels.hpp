@@ -12,6 +12,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/exception.hpp>
+#include <hpx/runtime/parcelset/detail/parcel_tracer.hpp>
 #include <hpx/runtime/parcelset/parcel.hpp>
 #include <hpx/runtime/parcelset/parcel_buffer.hpp>
 #include <hpx/runtime/parcelset/parcelport.hpp>
@@ -183,8 +184,8 @@ namespace hpx
 
                         for(std::size_t i = 0; i != parcels_sent; ++i)
                         {
-#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
                             std::size_t archive_pos = archive.current_pos();
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
                             std::int64_t serialize_time =
                                 timer.elapsed_nanoseconds();
 #endif
@@ -193,6 +194,9 @@ namespace hpx
                             archive.set_split_gids(ps[i].split_gids());
                             archive << ps[i];
 
+                            detail::trace_parcel(ps[i], detail::trace_encode,
+                                archive.current_pos() - archive_pos);
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
                             performance_counters::parcels::data_point action_data;
                             action_data.bytes_ = archive.current_pos() - archive_pos;
@@ -28,6 +28,7 @@ namespace hpx { namespace parcelset
         > count_chunks_type;
 
         typedef typename BufferType::allocator_type allocator_type;
+        typedef ChunkType chunk_type;
 
         explicit parcel_buffer(allocator_type allocator = allocator_type())
           : data_(allocator)
@@ -14,6 +14,7 @@
 #include <hpx/runtime/applier/applier.hpp>
 #include <hpx/runtime/naming/address.hpp>
 #include <hpx/runtime/naming/name.hpp>
+#include <hpx/runtime/parcelset/detail/parcel_aggregator.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/runtime/parcelset/parcelport.hpp>
 #include <hpx/runtime_fwd.hpp>
@@ -249,6 +250,13 @@ namespace hpx { namespace parcelset
             put_parcels(std::move(parcels), std::move(handlers));
         }
 
+        /// Hand parcels which have been queued by a parcelport which can't
+        /// reach their destination anymore to the parcelport which is now
+        /// best suited for it. All parcels have to be resolved and target
+        /// the same locality.
+        void reroute_parcels(std::vector<parcel> parcels,
+            std::vector<write_handler_type> handlers);
+
         double get_current_time() const
         {
             return util::high_resolution_timer::now();
@@ -316,6 +324,15 @@ namespace hpx { namespace parcelset
         // number of parcels routed
         std::int64_t get_parcel_routed_count(bool reset);
 
+        // number of parcels destined for this locality which were not sent
+        // through a parcelport
+        std::int64_t get_parcel_loopback_count(bool reset);
+
+        // number of parcels passed through the parcel aggregation and the
+        // number of messages these were sent in
+        std::int64_t get_aggregated_parcels_count(bool reset);
+        std::int64_t get_aggregated_messages_count(bool reset);
+
         // number of parcels received
         std::int64_t get_parcel_receive_count(
             std::string const& pp_type, bool reset) const;
@@ -378,6 +395,11 @@ namespace hpx { namespace parcelset
         std::int64_t get_buffer_allocate_time_received(
             std::string const& pp_type, bool reset) const;
 
+        // bandwidth achieved while sending data to the given destination
+        // locality (bytes per second)
+        std::int64_t get_sent_bandwidth(std::string const& pp_type,
+            std::uint32_t locality_id, bool reset) const;
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
         // same as above, just separated data for each action
         // number of parcels sent
@@ -446,6 +468,14 @@ namespace hpx { namespace parcelset
 
         std::int64_t get_outgoing_queue_length(bool reset) const;
 
+        /// Schedule the action of a parcel destined for this locality
+        /// directly, without serializing it
+        void put_parcel_loopback(parcel p, write_handler_type f);
+
+        /// Return the aggregator for the parcels sent to the given locality
+        detail::parcel_aggregator* get_parcel_aggregator(
+            parcelport* pp, locality const& loc);
+
         std::pair<std::shared_ptr<parcelport>, locality>
         find_appropriate_destination(naming::gid_type const & dest_gid);
         locality find_endpoint(endpoints_type const & eps, std::string const & name);
@@ -499,9 +529,23 @@ namespace hpx { namespace parcelset
         message_handler_map handlers_;
         bool const load_message_handlers_;
 
+        /// Aggregate the parcels of all actions sent to the same locality
+        /// (protected by handlers_mtx_)
+        typedef std::map<
+            locality, std::shared_ptr<detail::parcel_aggregator>
+        > parcel_aggregator_map;
+        parcel_aggregator_map aggregators_;
+        bool const aggregate_parcels_;
+        std::size_t const aggregation_max_parcels_;
+        std::size_t const aggregation_interval_;
+        bool const aggregation_background_flush_;
+
         /// Count number of (outbound) parcels routed
         boost::atomic<std::int64_t> count_routed_;
 
+        /// Count number of parcels short-circuited to this locality
+        boost::atomic<std::int64_t> count_loopback_;
+
         /// global exception handler for unhandled exceptions thrown from the
         /// parcel layer
         mutable mutex_type mtx_;
@@ -252,6 +252,14 @@ namespace hpx { namespace parcelset
 
         std::int64_t get_pending_parcels_count(bool /*reset*/);
 
+        /// number of parcels waiting to be sent to the given destination
+        std::size_t get_pending_parcels_count(locality const& dest) const;
+
+        /// the bandwidth achieved while sending data to the given destination
+        /// locality (bytes per second), naming::invalid_locality_id refers
+        /// to the data sent to all destinations
+        std::int64_t get_sent_bandwidth(std::uint32_t locality_id, bool reset);
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
         // same as above, just separated data for each action
         // number of parcels sent
@@ -335,7 +343,30 @@ namespace hpx { namespace parcelset
             return async_serialization_;
         }
 
+        bool priority_lanes() const
+        {
+            return priority_lanes_;
+        }
+
+        /// Return whether the given parcel should bypass the bulk traffic
+        /// to its destination
+        bool is_priority_parcel(parcel const& p) const
+        {
+            return priority_lanes_ &&
+                p.get_thread_priority() >= threads::thread_priority_critical;
+        }
+
     protected:
+        /// Give parcels this parcelport can't send anymore back to the parcel
+        /// handler, which passes them on to another parcelport
+        void reroute_parcels(std::vector<parcel>&& parcels,
+            std::vector<write_handler_type>&& handlers);
+
+        /// Update the bandwidth statistics for the given destination locality
+        /// whenever a message is handed to or completed by a connection
+        void add_send_started(std::uint32_t locality_id);
+        void add_send_completed(std::uint32_t locality_id, std::size_t bytes);
+
         /// mutex for all of the member data
         mutable lcos::local::spinlock mtx_;
 
@@ -357,6 +388,10 @@ namespace hpx { namespace parcelset
         typedef std::map<locality, map_second_type> pending_parcels_map;
         pending_parcels_map pending_parcels_;
 
+        /// The cache for pending high priority parcels, these are sent
+        /// before any other pending parcels to the same destination
+        pending_parcels_map pending_priority_parcels_;
+
         typedef std::set<locality> pending_parcels_destinations;
         pending_parcels_destinations parcel_destinations_;
 
@@ -387,6 +422,30 @@ namespace hpx { namespace parcelset
         /// async serialization of parcels
         bool async_serialization_;
 
+        /// separate high priority parcels from the bulk traffic
+        bool priority_lanes_;
+
+        /// Send bandwidth statistics, the time a destination is busy is
+        /// accounted for only once, regardless of the number of messages
+        /// concurrently written to it
+        struct bandwidth_data
+        {
+            bandwidth_data()
+              : bytes_(0), busy_time_(0), busy_start_(0), in_flight_(0)
+            {}
+
+            std::int64_t bytes_;
+            std::int64_t busy_time_;
+            std::int64_t busy_start_;
+            std::size_t in_flight_;
+        };
+
+        typedef std::map<std::uint32_t, bandwidth_data> bandwidth_map;
+
+        mutable lcos::local::spinlock bandwidth_mtx_;
+        bandwidth_map sent_bandwidth_;
+        bandwidth_data total_sent_bandwidth_;
+
         /// priority of the parcelport
         int priority_;
         std::string type_;
@@ -17,6 +17,7 @@
 #include <hpx/runtime/parcelset/detail/parcel_await.hpp>
 #include <hpx/runtime/parcelset/encode_parcels.hpp>
 #include <hpx/runtime/parcelset/parcelport.hpp>
+#include <hpx/runtime/serialization/serialization_chunk.hpp>
 #include <hpx/runtime/threads/thread.hpp>
 #include <hpx/throw_exception.hpp>
 #include <hpx/util/bind.hpp>
@@ -29,6 +30,7 @@
 #include <boost/detail/endian.hpp>
 #include <boost/exception_ptr.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -105,6 +107,31 @@ namespace hpx { namespace parcelset
                 HPX_PARCEL_MAX_CONNECTIONS_PER_LOCALITY);
         }
 
+        static
+            std::size_t send_pipeline_depth(util::runtime_configuration const& ini)
+        {
+            std::string key("hpx.parcel.");
+            key += connection_handler_type();
+
+            // there can't be more messages in flight to a destination than
+            // there are connections to it
+            return (std::min)(
+                hpx::util::get_entry_as<std::size_t>(
+                    ini, key + ".send_pipeline_depth",
+                    HPX_PARCEL_MAX_CONNECTIONS_PER_LOCALITY),
+                max_connections_per_loc(ini));
+        }
+
+        static std::size_t send_pipeline_threshold(
+            util::runtime_configuration const& ini)
+        {
+            std::string key("hpx.parcel.");
+            key += connection_handler_type();
+
+            return hpx::util::get_entry_as<std::size_t>(
+                ini, key + ".send_pipeline_threshold", 1048576);
+        }
+
     public:
         /// Construct the parcelport on the given locality.
         parcelport_impl(util::runtime_configuration const& ini,
@@ -115,6 +142,9 @@ namespace hpx { namespace parcelset
           , io_service_pool_(thread_pool_size(ini),
                 on_start_thread, on_stop_thread, pool_name(), pool_name_postfix())
           , connection_cache_(max_connections(ini), max_connections_per_loc(ini))
+          , priority_connection_cache_(max_connections(ini), 1)
+          , send_pipeline_depth_(send_pipeline_depth(ini))
+          , send_pipeline_threshold_(send_pipeline_threshold(ini))
           , archive_flags_(0)
           , operations_in_flight_(0)
           , num_thread_(0)
@@ -151,6 +181,7 @@ namespace hpx { namespace parcelset
         ~parcelport_impl()
         {
             connection_cache_.clear();
+            priority_connection_cache_.clear();
         }
 
         bool can_bootstrap() const
@@ -189,9 +220,11 @@ namespace hpx { namespace parcelset
             io_service_pool_.stop();
             if (blocking) {
                 connection_cache_.shutdown();
+                priority_connection_cache_.shutdown();
                 connection_handler().do_stop();
                 io_service_pool_.join();
                 connection_cache_.clear();
+                priority_connection_cache_.clear();
                 io_service_pool_.clear();
             }
 
@@ -349,6 +382,7 @@ namespace hpx { namespace parcelset
             }
 
             connection_cache_.clear(loc);
+            priority_connection_cache_.clear(loc);
         }
 
         void remove_from_connection_cache(locality const& loc)
@@ -495,14 +529,41 @@ namespace hpx { namespace parcelset
         }
 
         ///////////////////////////////////////////////////////////////////////
+        // High priority parcels are sent through their own connection to
+        // avoid waiting for the bulk traffic to the same destination.
+        util::connection_cache<connection, locality>&
+            get_connection_cache(bool priority)
+        {
+            return priority ? priority_connection_cache_ : connection_cache_;
+        }
+
+        pending_parcels_map& get_pending_parcels(bool priority)
+        {
+            return priority ? pending_priority_parcels_ : pending_parcels_;
+        }
+
+        static bool has_pending_parcels(pending_parcels_map const& pending,
+            locality const& locality_id)
+        {
+            pending_parcels_map::const_iterator it = pending.find(locality_id);
+#if defined(HPX_PARCELSET_PENDING_PARCELS_WORKAROUND)
+            return it != pending.end() && util::get<0>(it->second) &&
+                !util::get<0>(it->second)->empty();
+#else
+            return it != pending.end() && !util::get<0>(it->second).empty();
+#endif
+        }
+
         std::shared_ptr<connection> get_connection(
-            locality const& l, bool force, error_code& ec)
+            locality const& l, bool force, error_code& ec,
+            bool priority = false)
         {
             // Request new connection from connection cache.
             std::shared_ptr<connection> sender_connection;
 
             // Get a connection or reserve space for a new connection.
-            if (!connection_cache_.get_or_reserve(l, sender_connection))
+            if (!get_connection_cache(priority).get_or_reserve(
+                    l, sender_connection))
             {
                 // If no slot is available it's not a problem as the parcel
                 // will be sent out whenever the next connection is returned
@@ -536,7 +597,8 @@ namespace hpx { namespace parcelset
                 std::unique_lock<lcos::local::spinlock>
             > il(&l);
 
-            mapped_type& e = pending_parcels_[locality_id];
+            mapped_type& e =
+                get_pending_parcels(is_priority_parcel(p))[locality_id];
 #if defined(HPX_PARCELSET_PENDING_PARCELS_WORKAROUND)
             if(!util::get<0>(e))
                 util::get<0>(e) = std::make_shared<std::vector<parcel> >();
@@ -552,6 +614,54 @@ namespace hpx { namespace parcelset
         void enqueue_parcels(locality const& locality_id,
             std::vector<parcel>&& parcels,
             std::vector<write_handler_type>&& handlers)
+        {
+            HPX_ASSERT(parcels.size() == handlers.size());
+
+            if (priority_lanes())
+            {
+                // move the high priority parcels to their own lane
+                std::vector<parcel> priority_parcels;
+                std::vector<write_handler_type> priority_handlers;
+
+                std::size_t j = 0;
+                for (std::size_t i = 0; i != parcels.size(); ++i)
+                {
+                    if (is_priority_parcel(parcels[i]))
+                    {
+                        priority_parcels.push_back(std::move(parcels[i]));
+                        priority_handlers.push_back(std::move(handlers[i]));
+                    }
+                    else
+                    {
+                        if (i != j)
+                        {
+                            parcels[j] = std::move(parcels[i]);
+                            handlers[j] = std::move(handlers[i]);
+                        }
+                        ++j;
+                    }
+                }
+
+                if (!priority_parcels.empty())
+                {
+                    enqueue_parcels(locality_id, std::move(priority_parcels),
+                        std::move(priority_handlers), true);
+
+                    if (j == 0)
+                        return;
+
+                    parcels.erase(parcels.begin() + j, parcels.end());
+                    handlers.erase(handlers.begin() + j, handlers.end());
+                }
+            }
+
+            enqueue_parcels(locality_id, std::move(parcels),
+                std::move(handlers), false);
+        }
+
+        void enqueue_parcels(locality const& locality_id,
+            std::vector<parcel>&& parcels,
+            std::vector<write_handler_type>&& handlers, bool priority)
         {
             typedef pending_parcels_map::mapped_type mapped_type;
 
@@ -565,7 +675,7 @@ namespace hpx { namespace parcelset
 
             HPX_ASSERT(parcels.size() == handlers.size());
 
-            mapped_type& e = pending_parcels_[locality_id];
+            mapped_type& e = get_pending_parcels(priority)[locality_id];
 #if defined(HPX_PARCELSET_PENDING_PARCELS_WORKAROUND)
             if(!util::get<0>(e))
             {
@@ -609,21 +719,22 @@ namespace hpx { namespace parcelset
 
         bool dequeue_parcels(locality const& locality_id,
             std::vector<parcel>& parcels,
-            std::vector<write_handler_type>& handlers)
+            std::vector<write_handler_type>& handlers, bool priority)
         {
             typedef pending_parcels_map::iterator iterator;
 
             {
                 std::lock_guard<lcos::local::spinlock> l(mtx_);
 
-                iterator it = pending_parcels_.find(locality_id);
+                pending_parcels_map& pending = get_pending_parcels(priority);
+                iterator it = pending.find(locality_id);
 
                 // do nothing if parcels have already been picked up by
                 // another thread
 #if defined(HPX_PARCELSET_PENDING_PARCELS_WORKAROUND)
-                if (it != pending_parcels_.end() && !util::get<0>(it->second)->empty())
+                if (it != pending.end() && !util::get<0>(it->second)->empty())
 #else
-                if (it != pending_parcels_.end() && !util::get<0>(it->second).empty())
+                if (it != pending.end() && !util::get<0>(it->second).empty())
 #endif
                 {
                     HPX_ASSERT(it->first == locality_id);
@@ -639,11 +750,18 @@ namespace hpx { namespace parcelset
                 }
                 else
                 {
-                    HPX_ASSERT(util::get<1>(it->second).empty());
+                    HPX_ASSERT(it == pending.end() ||
+                        util::get<1>(it->second).empty());
                     return false;
                 }
 
-                parcel_destinations_.erase(locality_id);
+                // the destination stays registered as long as the other
+                // lane still holds parcels for it
+                if (!has_pending_parcels(
+                        get_pending_parcels(!priority), locality_id))
+                {
+                    parcel_destinations_.erase(locality_id);
+                }
 
                 return true;
             }
@@ -727,15 +845,56 @@ namespace hpx { namespace parcelset
         void get_connection_and_send_parcels(
             locality const& locality_id, bool background = false)
         {
-            // repeat until no more parcels are to be sent
-//             while (!hpx::is_stopped())
+            // service the high priority lane first
+            if (priority_lanes())
+                get_connection_and_send_parcels(locality_id, background, true);
+
+            get_connection_and_send_parcels(locality_id, background, false);
+        }
+
+        void get_connection_and_send_parcels(
+            locality const& locality_id, bool background, bool priority)
+        {
+            std::vector<parcel> parcels;
+            std::vector<write_handler_type> handlers;
+
+            if(!dequeue_parcels(locality_id, parcels, handlers, priority))
             {
-                std::vector<parcel> parcels;
-                std::vector<write_handler_type> handlers;
+                return;
+            }
 
-                if(!dequeue_parcels(locality_id, parcels, handlers))
+            // Large batches of parcels are striped across several connections
+            // to the same destination which are written to concurrently.
+            std::size_t num_stripes = 1;
+            std::size_t remaining_size = 0;
+            if (!priority && send_pipeline_depth_ > 1 && parcels.size() > 1)
+            {
+                for (parcel const& p : parcels)
+                    remaining_size += p.size();
+
+                if (remaining_size >= send_pipeline_threshold_)
                 {
-                    return;
+                    num_stripes = (std::min)(send_pipeline_depth_,
+                        parcels.size());
+                }
+            }
+
+            while (!parcels.empty())
+            {
+                std::vector<parcel> stripe_parcels;
+                std::vector<write_handler_type> stripe_handlers;
+
+                if (num_stripes > 1)
+                {
+                    remaining_size -= split_stripe(parcels, handlers,
+                        stripe_parcels, stripe_handlers,
+                        remaining_size / num_stripes, num_stripes - 1);
+                    --num_stripes;
+                }
+                else
+                {
+                    std::swap(stripe_parcels, parcels);
+                    std::swap(stripe_handlers, handlers);
                 }
 
                 // If one of the sending threads are in suspended state, we
@@ -744,13 +903,43 @@ namespace hpx { namespace parcelset
 
                 error_code ec;
                 std::shared_ptr<connection> sender_connection =
-                    get_connection(locality_id, force_connection, ec);
+                    get_connection(locality_id, force_connection, ec, priority);
+
+                if (!sender_connection && ec &&
+                    !connection_handler().can_connect(locality_id, true))
+                {
+                    // The destination can't be reached through this
+                    // parcelport anymore, release the reserved connection
+                    // and let the parcel handler pick another parcelport
+                    // for all parcels queued for this destination.
+                    get_connection_cache(priority).clear(
+                        locality_id, sender_connection);
+
+                    this->reroute_parcels(std::move(stripe_parcels),
+                        std::move(stripe_handlers));
+                    do {
+                        if (!parcels.empty())
+                        {
+                            this->reroute_parcels(std::move(parcels),
+                                std::move(handlers));
+                        }
+                        parcels.clear();
+                        handlers.clear();
+                    } while (dequeue_parcels(locality_id, parcels, handlers,
+                        priority));
+                    return;
+                }
 
                 if (!sender_connection)
                 {
                     // give the parcels back to the queues for later
-                    enqueue_parcels(locality_id, std::move(parcels),
-                        std::move(handlers));
+                    enqueue_parcels(locality_id, std::move(stripe_parcels),
+                        std::move(stripe_handlers), priority);
+                    if (!parcels.empty())
+                    {
+                        enqueue_parcels(locality_id, std::move(parcels),
+                            std::move(handlers), priority);
+                    }
 
                     // We can safely return if no connection is available
                     // at this point. As soon as a connection becomes
@@ -770,8 +959,9 @@ namespace hpx { namespace parcelset
                           , this
                           , locality_id
                           , sender_connection
-                          , std::move(parcels)
-                          , std::move(handlers)
+                          , std::move(stripe_parcels)
+                          , std::move(stripe_handlers)
+                          , priority
                         )
                       , "parcelport_impl::send_pending_parcels"
                       , threads::pending, true, threads::thread_priority_boost,
@@ -782,16 +972,58 @@ namespace hpx { namespace parcelset
                 {
                     send_pending_parcels(
                         locality_id,
-                        sender_connection, std::move(parcels),
-                        std::move(handlers));
+                        sender_connection, std::move(stripe_parcels),
+                        std::move(stripe_handlers), priority);
                 }
+            }
+        }
 
-                // We yield here for a short amount of time to give another
-                // HPX thread the chance to put a subsequent parcel which
-                // leads to a more effective parcel buffering
-//                 if (hpx::threads::get_self_ptr())
-//                     hpx::this_thread::yield();
+        // Move the leading parcels adding up to at least the given size into
+        // the given stripe, leaving at least min_remaining parcels behind.
+        // Returns the size of the parcels moved.
+        static std::size_t split_stripe(std::vector<parcel>& parcels,
+            std::vector<write_handler_type>& handlers,
+            std::vector<parcel>& stripe_parcels,
+            std::vector<write_handler_type>& stripe_handlers,
+            std::size_t stripe_size, std::size_t min_remaining)
+        {
+            HPX_ASSERT(parcels.size() > min_remaining);
+
+            std::size_t size = 0;
+            std::size_t count = 0;
+            std::size_t max_count = parcels.size() - min_remaining;
+            while (count != max_count && (count == 0 || size < stripe_size))
+            {
+                size += parcels[count].size();
+                ++count;
             }
+
+            stripe_parcels.reserve(count);
+            stripe_handlers.reserve(count);
+
+            std::move(parcels.begin(), parcels.begin() + count,
+                std::back_inserter(stripe_parcels));
+            std::move(handlers.begin(), handlers.begin() + count,
+                std::back_inserter(stripe_handlers));
+
+            parcels.erase(parcels.begin(), parcels.begin() + count);
+            handlers.erase(handlers.begin(), handlers.begin() + count);
+
+            return size;
+        }
+
+        // number of bytes written for the message encoded into the given
+        // buffer, including the zero-copy chunks
+        template <typename Buffer>
+        static std::size_t message_size(Buffer const& buffer)
+        {
+            std::size_t size = buffer.data_.size();
+            for (serialization::serialization_chunk const& c : buffer.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type_pointer)
+                    size += c.size_;
+            }
+            return size;
         }
 
         void immediate_send_done(
@@ -811,11 +1043,14 @@ namespace hpx { namespace parcelset
         void send_pending_parcels_trampoline(
             boost::system::error_code const& ec,
             locality const& locality_id,
-            std::shared_ptr<connection> sender_connection)
+            std::shared_ptr<connection> sender_connection, bool priority,
+            std::uint32_t dest_locality_id, std::size_t bytes)
         {
             HPX_ASSERT(operations_in_flight_ != 0);
             --operations_in_flight_;
 
+            add_send_completed(dest_locality_id, ec ? 0 : bytes);
+
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
             sender_connection->set_state(parcelport_connection::state_scheduled_thread);
 #endif
@@ -823,37 +1058,36 @@ namespace hpx { namespace parcelset
             {
                 // Give this connection back to the cache as it's not
                 // needed anymore.
-                connection_cache_.reclaim(locality_id, sender_connection);
+                get_connection_cache(priority).reclaim(
+                    locality_id, sender_connection);
             }
             else
             {
                 // remove this connection from cache
-                connection_cache_.clear(locality_id, sender_connection);
+                get_connection_cache(priority).clear(
+                    locality_id, sender_connection);
             }
             {
                 std::lock_guard<lcos::local::spinlock> l(mtx_);
 
                 HPX_ASSERT(locality_id == sender_connection->destination());
-                pending_parcels_map::iterator it = pending_parcels_.find(locality_id);
-#if defined(HPX_PARCELSET_PENDING_PARCELS_WORKAROUND)
-                if (it == pending_parcels_.end() ||
-                    (util::get<0>(it->second) && util::get<0>(it->second)->empty()))
-#else
-                if (it == pending_parcels_.end() || util::get<0>(it->second).empty())
-#endif
+                if (!has_pending_parcels(
+                        get_pending_parcels(priority), locality_id))
+                {
                     return;
+                }
             }
 
             // Create a new HPX thread which sends parcels that are still
             // pending.
-            get_connection_and_send_parcels(locality_id);
+            get_connection_and_send_parcels(locality_id, false, priority);
         }
 
         void send_pending_parcels(
             parcelset::locality const & parcel_locality_id,
             std::shared_ptr<connection> sender_connection,
             std::vector<parcel>&& parcels,
-            std::vector<write_handler_type>&& handlers)
+            std::vector<write_handler_type>&& handlers, bool priority)
         {
             // If we are stopped already, discard the remaining pending parcels
             if (hpx::is_stopped()) return;
@@ -873,6 +1107,11 @@ namespace hpx { namespace parcelset
                     archive_flags_,
                     this->get_max_outbound_message_size());
 
+            // keep track of the bandwidth to the destination
+            std::uint32_t dest_locality_id = parcels[0].destination_locality_id();
+            std::size_t bytes = message_size(sender_connection->buffer_);
+            add_send_started(dest_locality_id);
+
             using hpx::parcelset::detail::call_for_each;
             using hpx::util::placeholders::_1;
             using hpx::util::placeholders::_2;
@@ -884,7 +1123,7 @@ namespace hpx { namespace parcelset
                 sender_connection->async_write(
                     call_for_each(std::move(handlers), std::move(parcels)),
                     util::bind(&parcelport_impl::send_pending_parcels_trampoline,
-                        this, _1, _2, _3));
+                        this, _1, _2, _3, priority, dest_locality_id, bytes));
             }
             else
             {
@@ -908,14 +1147,14 @@ namespace hpx { namespace parcelset
                     call_for_each(
                         std::move(handled_handlers), std::move(handled_parcels)),
                     util::bind(&parcelport_impl::send_pending_parcels_trampoline,
-                        this, _1, _2, _3));
+                        this, _1, _2, _3, priority, dest_locality_id, bytes));
 
                 // give back unhandled parcels
                 parcels.erase(parcels.begin(), parcels.begin()+num_parcels);
                 handlers.erase(handlers.begin(), handlers.begin()+num_parcels);
 
                 enqueue_parcels(parcel_locality_id, std::move(parcels),
-                    std::move(handlers));
+                    std::move(handlers), priority);
             }
 
             std::size_t num_thread(0);
@@ -939,6 +1178,16 @@ namespace hpx { namespace parcelset
         /// The connection cache for sending connections
         util::connection_cache<connection, locality> connection_cache_;
 
+        /// The connection cache for the connections used by high priority
+        /// parcels, there is one such connection per destination
+        util::connection_cache<connection, locality> priority_connection_cache_;
+
+        /// The maximum number of connections a batch of parcels to the same
+        /// destination is striped across, and the minimal size of a batch
+        /// to be striped
+        std::size_t const send_pipeline_depth_;
+        std::size_t const send_pipeline_threshold_;
+
         typedef hpx::lcos::local::spinlock mutex_type;
 
         int archive_flags_;
@@ -15,6 +15,7 @@
 #include <hpx/util/assert.hpp>
 
 #include <cstddef>
+#include <memory>
 
 namespace hpx { namespace serialization
 {
@@ -45,6 +46,11 @@ namespace hpx { namespace serialization
         virtual void set_filter(binary_filter* filter) = 0;
         virtual void load_binary(void * address, std::size_t count) = 0;
         virtual void load_binary_chunk(void * address, std::size_t count) = 0;
+        virtual std::shared_ptr<char> adopt_binary_chunk(std::size_t count,
+            std::size_t alignment)
+        {
+            return std::shared_ptr<char>();
+        }
     };
 }}
 
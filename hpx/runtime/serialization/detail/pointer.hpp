@@ -156,9 +156,7 @@ namespace hpx { namespace serialization
                 static void call(output_archive& ar, const Pointer& ptr)
                 {
 #if !defined(HPX_DEBUG)
-                    const std::uint32_t id =
-                        polymorphic_id_factory::get_id(
-                            access::get_name(ptr.get()));
+                    const std::uint32_t id = access::get_id(ptr.get());
                     ar << id;
                     ar << *ptr;
 #else
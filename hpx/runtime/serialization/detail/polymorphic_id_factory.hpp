@@ -16,6 +16,7 @@
 #include <hpx/util/assert.hpp>
 #include <hpx/util/static.hpp>
 
+#include <boost/atomic.hpp>
 #include <boost/preprocessor/stringize.hpp>
 
 #include <cstdint>
@@ -114,6 +115,27 @@ namespace hpx { namespace serialization {
             HPX_EXPORT static std::uint32_t get_id(
                 const std::string& type_name);
 
+            // Return the id assigned to the type T. The id is looked up by
+            // name only once, all subsequent calls return the cached value.
+            // This avoids creating and looking up the (possibly very long)
+            // type name for every object being serialized.
+            template <class T>
+            static std::uint32_t get_cached_id(std::string (*get_name)())
+            {
+                static boost::atomic<std::uint32_t> cached_id(
+                    id_registry::invalid_id);
+
+                std::uint32_t id = cached_id.load(boost::memory_order_relaxed);
+                if (id == id_registry::invalid_id)
+                {
+                    // ids are assigned only once (during startup), and never
+                    // change afterwards
+                    id = get_id(get_name());
+                    cached_id.store(id, boost::memory_order_relaxed);
+                }
+                return id;
+            }
+
         private:
             polymorphic_id_factory() {}
 
@@ -177,6 +199,14 @@ namespace hpx { namespace serialization {
 
 #include <hpx/config/warnings_suffix.hpp>
 
+#define HPX_SERIALIZATION_ADD_GET_ID_MEMBER(Class)                            \
+  virtual std::uint32_t hpx_serialization_get_id() const                      \
+  {                                                                           \
+      return ::hpx::serialization::detail::polymorphic_id_factory::           \
+          get_cached_id<Class>(&Class::hpx_serialization_get_name_impl);      \
+  }                                                                           \
+/**/
+
 #define HPX_SERIALIZATION_ADD_CONSTANT_ENTRY(String, Id)                       \
     namespace hpx { namespace serialization { namespace detail {               \
         template <> std::string get_constant_entry_name<Id>()                  \
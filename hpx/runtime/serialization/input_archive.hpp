@@ -42,9 +42,11 @@ namespace hpx { namespace serialization
         template <typename Container>
         input_archive(Container & buffer,
             std::size_t inbound_data_size = 0,
-            const std::vector<serialization_chunk>* chunks = nullptr)
+            const std::vector<serialization_chunk>* chunks = nullptr,
+            chunk_owner* owner = nullptr)
           : base_type(0U)
-          , buffer_(new input_container<Container>(buffer, chunks, inbound_data_size))
+          , buffer_(new input_container<Container>(
+                buffer, chunks, inbound_data_size, owner))
         {
             // endianness needs to be saves separately as it is needed to
             // properly interpret the flags
@@ -130,6 +132,21 @@ namespace hpx { namespace serialization
             return basic_archive<input_archive>::current_pos();
         }
 
+        // Take over the memory of the next zero-copy chunk instead of copying
+        // it, returns an empty pointer if this is not possible.
+        std::shared_ptr<char> adopt_binary_chunk(std::size_t count,
+            std::size_t alignment = 1)
+        {
+            if (0 == count || disable_data_chunking())
+                return std::shared_ptr<char>();
+
+            std::shared_ptr<char> data =
+                buffer_->adopt_binary_chunk(count, alignment);
+            if (data)
+                size_ += count;
+            return data;
+        }
+
     private:
         friend struct basic_archive<input_archive>;
         template <class T>
@@ -50,15 +50,18 @@ namespace hpx { namespace serialization
         input_container(Container const& cont, std::size_t inbound_data_size)
           : cont_(cont), current_(0), filter_(),
             decompressed_size_(inbound_data_size),
-            chunks_(nullptr), current_chunk_(std::size_t(-1)), current_chunk_size_(0)
+            chunks_(nullptr), current_chunk_(std::size_t(-1)), current_chunk_size_(0),
+            owner_(nullptr)
         {}
 
         input_container(Container const& cont,
                 std::vector<serialization_chunk> const* chunks,
-                std::size_t inbound_data_size)
+                std::size_t inbound_data_size,
+                chunk_owner* owner = nullptr)
           : cont_(cont), current_(0), filter_(),
             decompressed_size_(inbound_data_size),
-            chunks_(nullptr), current_chunk_(std::size_t(-1)), current_chunk_size_(0)
+            chunks_(nullptr), current_chunk_(std::size_t(-1)), current_chunk_size_(0),
+            owner_(owner)
         {
             if (chunks && chunks->size() != 0)
             {
@@ -155,6 +158,28 @@ namespace hpx { namespace serialization
             }
         }
 
+        std::shared_ptr<char> adopt_binary_chunk(std::size_t count,
+            std::size_t alignment) // override
+        {
+            if (owner_ == nullptr || filter_.get() || chunks_ == nullptr ||
+                count < HPX_ZERO_COPY_SERIALIZATION_THRESHOLD ||
+                current_chunk_ >= get_num_chunks() ||
+                get_chunk_type(current_chunk_) != chunk_type_pointer ||
+                get_chunk_size(current_chunk_) != count)
+            {
+                return std::shared_ptr<char>();
+            }
+
+            void const* data = get_chunk_data(current_chunk_).cpos_;
+            if (reinterpret_cast<std::uintptr_t>(data) % alignment != 0)
+                return std::shared_ptr<char>();
+
+            std::shared_ptr<char> result = owner_->adopt(data, count);
+            if (result)
+                ++current_chunk_;
+            return result;
+        }
+
         Container const& cont_;
         std::size_t current_;
         std::unique_ptr<binary_filter> filter_;
@@ -163,6 +188,7 @@ namespace hpx { namespace serialization
         std::vector<serialization_chunk> const* chunks_;
         std::size_t current_chunk_;
         std::size_t current_chunk_size_;
+        chunk_owner* owner_;
     };
 }}
 
@@ -13,6 +13,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <memory>
 
 #if CHAR_BIT != 8
 #  error This code assumes an eight-bit byte.
@@ -65,6 +66,21 @@ namespace hpx { namespace serialization
         return retval;
     }
 
+    ///////////////////////////////////////////////////////////////////////
+    // The owner of the memory of received zero-copy chunks may hand it over
+    // to the objects being deserialized, which then can refer to the data
+    // directly instead of copying it.
+    struct chunk_owner
+    {
+        virtual ~chunk_owner() {}
+
+        // Return a pointer keeping the memory of the chunk starting at the
+        // given address alive, or an empty pointer if it can't be handed
+        // over.
+        virtual std::shared_ptr<char> adopt(void const* data,
+            std::size_t size) = 0;
+    };
+
 }}
 
 #endif
@@ -11,6 +11,7 @@
 #include <hpx/runtime/serialization/array.hpp>
 #include <hpx/runtime/serialization/serialize.hpp>
 #include <hpx/throw_exception.hpp>
+#include <hpx/traits/is_bitwise_serializable.hpp>
 #include <hpx/traits/supports_streaming_with_any.hpp>
 #include <hpx/util/bind.hpp>
 
@@ -18,6 +19,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <memory>
 #include <type_traits>
 
 namespace hpx { namespace serialization
@@ -37,6 +39,8 @@ namespace hpx { namespace serialization
             dealloc.deallocate(p, size);
         }
 
+        static void adopted_deleter(T*, std::shared_ptr<char> const&) {}
+
     public:
         enum init_mode
         {
@@ -259,6 +263,14 @@ namespace hpx { namespace serialization
             using util::placeholders::_1;
             ar >> size_ >> alloc_; //-V128
 
+            typedef std::integral_constant<bool,
+                    std::is_same<Allocator, std::allocator<T> >::value &&
+                    hpx::traits::is_bitwise_serializable<T>::value
+                > use_adopt;
+
+            if (size_ != 0 && adopt(ar, use_adopt()))
+                return;
+
             data_.reset(alloc_.allocate(size_),
                 util::bind(&serialize_buffer::deleter<allocator_type>, _1,
                     alloc_, size_));
@@ -269,6 +281,38 @@ namespace hpx { namespace serialization
             }
         }
 
+        // Refer to the received data directly instead of copying it, this
+        // is possible only if the memory would have been allocated using the
+        // default allocator anyways.
+        template <typename Archive>
+        bool adopt(Archive& ar, std::true_type)
+        {
+            using util::placeholders::_1;
+#ifdef BOOST_BIG_ENDIAN
+            bool archive_endianess_differs = ar.endian_little();
+#else
+            bool archive_endianess_differs = ar.endian_big();
+#endif
+            if (ar.disable_array_optimization() || archive_endianess_differs)
+                return false;
+
+            std::shared_ptr<char> data =
+                ar.adopt_binary_chunk(size_ * sizeof(T), alignof(T));
+            if (!data)
+                return false;
+
+            T* p = reinterpret_cast<T*>(data.get());
+            data_.reset(p, util::bind(&serialize_buffer::adopted_deleter, _1,
+                std::move(data)));
+            return true;
+        }
+
+        template <typename Archive>
+        bool adopt(Archive&, std::false_type)
+        {
+            return false;
+        }
+
         HPX_SERIALIZATION_SPLIT_MEMBER()
 
         // this is needed for util::any
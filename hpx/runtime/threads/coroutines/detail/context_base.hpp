@@ -93,6 +93,7 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
     {
     public:
         typedef void deleter_type(context_base const*);
+        typedef void invoker_type(context_base*);
         typedef void* thread_id_repr_type;
 
         template <typename Derived>
@@ -103,6 +104,7 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
             m_counter(0),
 #endif
             m_deleter(&deleter<Derived>),
+            m_stackless_invoker(&stackless_invoker<Derived>),
             m_state(ctx_ready),
             m_exit_state(ctx_exit_not_requested),
             m_exit_status(ctx_not_exited),
@@ -238,6 +240,22 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
             return m_thread_id;
         }
 
+        // Stackless contexts don't own a stack, they run to completion on
+        // the stack of the caller and can't be suspended.
+        bool is_stackless() const
+        {
+            return this->get_stacksize() == 0;
+        }
+
+#if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
+        std::ptrdiff_t get_available_stack_space()
+        {
+            if (is_stackless())
+                return (std::numeric_limits<std::ptrdiff_t>::max)();
+            return default_context_impl::get_available_stack_space();
+        }
+#endif
+
         /*
          * Wake up a waiting context.
          * Similar to invoke(), but *does not
@@ -559,7 +577,7 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
         }
 
         // Nothrow.
-        void do_return(context_exit_status status, boost::exception_ptr && info)
+        void set_exited(context_exit_status status, boost::exception_ptr && info)
             HPX_NOEXCEPT
         {
             HPX_ASSERT(status != ctx_not_exited);
@@ -567,6 +585,13 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
             m_type_info = std::move(info);
             m_state = ctx_exited;
             m_exit_status = status;
+        }
+
+        // Nothrow.
+        void do_return(context_exit_status status, boost::exception_ptr && info)
+            HPX_NOEXCEPT
+        {
+            set_exited(status, std::move(info));
             do_yield();
         }
 
@@ -586,6 +611,11 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
             ++m_phase;
 #endif
             m_state = ctx_running;
+            if (is_stackless())
+            {
+                m_stackless_invoker(this);
+                return;
+            }
             swap_context(m_caller, *this, detail::invoke_hint());
         }
 
@@ -595,6 +625,12 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
             ActualCtx::destroy(static_cast<ActualCtx*>(const_cast<context_base*>(ctx)));
         }
 
+        template <typename ActualCtx>
+        static void stackless_invoker(context_base* ctx)
+        {
+            static_cast<ActualCtx*>(ctx)->invoke_stackless();
+        }
+
         typedef default_context_impl::context_impl_base ctx_type;
         ctx_type m_caller;
 
@@ -603,6 +639,7 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
 #endif
         static HPX_EXPORT allocation_counters m_allocation_counters;
         deleter_type* m_deleter;
+        invoker_type* m_stackless_invoker;
         context_state m_state;
         context_exit_state m_exit_state;
         context_exit_status m_exit_status;
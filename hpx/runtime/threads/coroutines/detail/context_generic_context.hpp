@@ -199,8 +199,14 @@ namespace hpx { namespace threads { namespace coroutines
                     (stack_size == -1) ?
                     alloc_.minimum_stacksize() : std::size_t(stack_size)
                 )
-              , stack_pointer_(alloc_.allocate(stack_size_))
+              , stack_pointer_(
+                    stack_size_ != 0 ? alloc_.allocate(stack_size_) : nullptr
+                )
             {
+                // stackless contexts are executed on the stack of their caller
+                if (0 == stack_size_)
+                    return;
+
 #if BOOST_VERSION < 105600
                 boost::context::fcontext_t* ctx =
                     boost::context::make_fcontext(stack_pointer_, stack_size_, funp_);
@@ -198,7 +198,7 @@ namespace hpx { namespace threads { namespace coroutines
              */
             template<typename Functor>
             explicit fibers_context_impl(Functor& cb, std::ptrdiff_t stack_size)
-              : fibers_context_impl_base(
+              : fibers_context_impl_base(stack_size == 0 ? nullptr :
                     CreateFiberEx(stack_size == -1 ? default_stack_size : stack_size,
                         stack_size == -1 ? default_stack_size : stack_size, 0,
                         static_cast<LPFIBER_START_ROUTINE>(&trampoline<Functor>),
@@ -206,7 +206,8 @@ namespace hpx { namespace threads { namespace coroutines
                     ),
                 stacksize_(stack_size == -1 ? default_stack_size : stack_size)
             {
-                if (0 == m_ctx)
+                // stackless contexts are executed on the stack of their caller
+                if (0 == m_ctx && 0 != stacksize_)
                 {
                     boost::throw_exception(boost::system::system_error(
                         boost::system::error_code(
@@ -123,6 +123,9 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
 
         HPX_EXPORT void operator()();
 
+        // run the bound function of a stackless coroutine to completion
+        HPX_EXPORT void invoke_stackless();
+
     public:
         result_type * result()
         {
@@ -175,6 +178,10 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
         }
 
     private:
+        typedef super_type::context_exit_status context_exit_status;
+
+        context_exit_status invoke_function(boost::exception_ptr& tinfo);
+
         static HPX_EXPORT coroutine_impl* allocate(
             thread_id_repr_type id, std::ptrdiff_t stacksize);
 
@@ -33,6 +33,7 @@
 #include <hpx/runtime/threads/coroutines/detail/coroutine_accessor.hpp>
 #include <hpx/runtime/threads/coroutines/detail/coroutine_impl.hpp>
 #include <hpx/runtime/threads/thread_enums.hpp>
+#include <hpx/throw_exception.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/function.hpp>
 
@@ -79,6 +80,16 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
 
         arg_type yield(result_type arg = result_type())
         {
+            // stackless threads run on the stack of the scheduling loop, there
+            // is no context to switch away from
+            if (m_pimpl->is_stackless())
+            {
+                HPX_THROW_EXCEPTION(invalid_status, "coroutine_self::yield",
+                    "attempting to suspend a stackless thread, create the "
+                    "thread with a stack (i.e. not thread_stacksize_nostack) "
+                    "if it needs to suspend");
+            }
+
             return !yield_decorator_.empty() ?
                 yield_decorator_(std::move(arg)) :
                 yield_impl(std::move(arg));
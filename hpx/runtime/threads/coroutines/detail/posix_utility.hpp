@@ -64,6 +64,11 @@
 #define EXEC_PAGESIZE PAGE_SIZE
 #endif
 
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) \
+ && _POSIX_MAPPED_FILES > 0
+#define HPX_HAVE_THREAD_STACK_CACHE
+#endif
+
 #if defined(__APPLE__)
 #include <unistd.h>
 #define EXEC_PAGESIZE static_cast<std::size_t>(sysconf(_SC_PAGESIZE))
@@ -77,11 +82,44 @@ namespace posix
 {
     HPX_EXPORT extern bool use_guard_pages;
 
-#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) \
- && _POSIX_MAPPED_FILES > 0
+#if defined(HPX_HAVE_THREAD_STACK_CACHE)
+
+    ///////////////////////////////////////////////////////////////////////////
+    // These globals control whether stacks are carved from per-worker slabs
+    // bound to the NUMA domain of the worker, whether those slabs are backed
+    // by transparent huge pages, and how many stacks are reserved per slab.
+    HPX_EXPORT extern bool use_stack_cache;
+    HPX_EXPORT extern bool use_huge_pages;
+    HPX_EXPORT extern std::size_t stack_cache_slab_size;
+
+    // Associate a stack cache with the calling OS thread, all slabs created by
+    // it are bound to the given NUMA domain (std::size_t(-1) for none).
+    HPX_EXPORT void init_stack_cache(std::size_t numa_node);
+
+    // Hand the stacks cached by the calling OS thread over to the cache
+    // shared by all threads.
+    HPX_EXPORT void release_stack_cache();
+
+    HPX_EXPORT void* alloc_cached_stack(std::size_t size);
+    HPX_EXPORT void free_cached_stack(void* stack, std::size_t size);
+
+    struct stack_cache_helper
+    {
+        explicit stack_cache_helper(std::size_t numa_node)
+        {
+            init_stack_cache(numa_node);
+        }
+        ~stack_cache_helper()
+        {
+            release_stack_cache();
+        }
+    };
 
     inline void* alloc_stack(std::size_t size)
     {
+        if (use_stack_cache)
+            return alloc_cached_stack(size);
+
         void* real_stack = ::mmap(nullptr,
             size + EXEC_PAGESIZE,
             PROT_EXEC | PROT_READ | PROT_WRITE,
@@ -151,6 +189,12 @@ namespace posix
 
     inline void free_stack(void* stack, std::size_t size)
     {
+        if (use_stack_cache)
+        {
+            free_cached_stack(stack, size);
+            return;
+        }
+
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
         if (use_guard_pages) {
             void** real_stack =
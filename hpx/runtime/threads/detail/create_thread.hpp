@@ -15,6 +15,7 @@
 
 #include <cstddef>
 #include <sstream>
+#include <vector>
 
 namespace hpx { namespace threads { namespace detail
 {
@@ -91,6 +92,76 @@ namespace hpx { namespace threads { namespace detail
         // potentially wake up waiting thread
         scheduler->do_some_work(num_thread);
     }
+
+    inline void create_threads(
+        policies::scheduler_base* scheduler, std::vector<thread_init_data>& data,
+        thread_state_enum initial_state = pending, error_code& ec = throws)
+    {
+        // verify parameters
+        switch (initial_state) {
+        case pending:
+        case pending_do_not_schedule:
+        case suspended:
+            break;
+
+        default:
+            {
+                std::ostringstream strm;
+                strm << "invalid initial state: "
+                     << get_thread_state_name(initial_state);
+                HPX_THROWS_IF(ec, bad_parameter,
+                    "threads::detail::create_threads",
+                    strm.str());
+                return;
+            }
+        }
+
+        thread_self* self = get_self_ptr();
+
+        // Pass critical priority from parent to child.
+        bool critical = self &&
+            thread_priority_critical == threads::get_self_id()->get_priority();
+
+        for (thread_init_data& d : data)
+        {
+#ifdef HPX_HAVE_THREAD_DESCRIPTION
+            if (!d.description)
+            {
+                HPX_THROWS_IF(ec, bad_parameter,
+                    "threads::detail::create_threads", "description is nullptr");
+                return;
+            }
+#endif
+
+#ifdef HPX_HAVE_THREAD_PARENT_REFERENCE
+            if (nullptr == d.parent_id) {
+                if (self)
+                {
+                    d.parent_id = threads::get_self_id().get();
+                    d.parent_phase = self->get_thread_phase();
+                }
+            }
+            if (0 == d.parent_locality_id)
+                d.parent_locality_id = get_locality_id();
+#endif
+
+            if (nullptr == d.scheduler_base)
+                d.scheduler_base = scheduler;
+
+            if (critical)
+                d.priority = thread_priority_critical;
+        }
+
+        // create all new threads at once, each of them is placed as requested
+        // by its own num_os_thread
+        scheduler->create_threads(data, initial_state, ec, std::size_t(-1));
+
+        LTM_(info) << "register_threads(" << data.size() << "): initial_state("
+                   << get_thread_state_name(initial_state) << ")";
+
+        // potentially wake up all waiting threads
+        scheduler->do_some_work(std::size_t(-1));
+    }
 }}}
 
 #endif
@@ -264,6 +264,9 @@ namespace hpx { namespace threads { namespace detail
 
         std::int64_t idle_loop_count = 0;
         std::int64_t busy_loop_count = 0;
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        bool idle_backoff = false;
+#endif
 
         idle_collect_rate idle_rate(counters.tfunc_time_, counters.exec_time_);
         tfunc_time_wrapper tfunc_time_collector(idle_rate);
@@ -276,6 +279,15 @@ namespace hpx { namespace threads { namespace detail
         thread_data* next_thrd = nullptr;
 
         while (true) {
+            // retired workers do not execute any HPX threads while running
+            if (HPX_UNLIKELY(
+                    !scheduler.SchedulingPolicy::is_worker_active(num_thread)) &&
+                next_thrd == nullptr && this_state.load() == state_running)
+            {
+                scheduler.SchedulingPolicy::retire_worker(num_thread);
+                continue;
+            }
+
             // Get the next HPX thread from the queue
             thrd = next_thrd;
             if (HPX_LIKELY(thrd ||
@@ -287,6 +299,14 @@ namespace hpx { namespace threads { namespace detail
                 idle_loop_count = 0;
                 ++busy_loop_count;
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+                if (HPX_UNLIKELY(idle_backoff))
+                {
+                    idle_backoff = false;
+                    scheduler.SchedulingPolicy::reset_idle_backoff(num_thread);
+                }
+#endif
+
                 may_exit = false;
 
                 // Only pending HPX threads will be executed.
@@ -455,7 +475,19 @@ namespace hpx { namespace threads { namespace detail
                     !callbacks.background_.empty())
                 {
                     if (callbacks.background_())
+                    {
                         idle_loop_count = 0;
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+                        // background work made progress, more is likely to
+                        // follow soon
+                        if (HPX_UNLIKELY(idle_backoff))
+                        {
+                            idle_backoff = false;
+                            scheduler.SchedulingPolicy::reset_idle_backoff(
+                                num_thread);
+                        }
+#endif
+                    }
                 }
 
                 // call back into invoking context
@@ -477,7 +509,19 @@ namespace hpx { namespace threads { namespace detail
                     !callbacks.background_.empty())
                 {
                     if (callbacks.background_())
+                    {
                         idle_loop_count = 0;
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+                        // background work made progress, more is likely to
+                        // follow soon
+                        if (HPX_UNLIKELY(idle_backoff))
+                        {
+                            idle_backoff = false;
+                            scheduler.SchedulingPolicy::reset_idle_backoff(
+                                num_thread);
+                        }
+#endif
+                    }
                 }
             }
             else if ((scheduler.get_scheduler_mode() & policies::fast_idle_mode) ||
@@ -489,8 +533,21 @@ namespace hpx { namespace threads { namespace detail
 
                 // call back into invoking context
                 if (!callbacks.outer_.empty())
+                {
                     callbacks.outer_();
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+                    // keep invoking the idle callback without spinning while
+                    // it is backing off
+                    if (scheduler.SchedulingPolicy::is_idle_backing_off(
+                            num_thread))
+                    {
+                        idle_backoff = true;
+                        idle_loop_count = HPX_IDLE_LOOP_COUNT_MAX;
+                    }
+#endif
+                }
+
                 // break if we were idling after 'may_exit'
                 if (may_exit)
                 {
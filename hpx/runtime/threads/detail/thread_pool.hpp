@@ -65,10 +65,19 @@ namespace hpx { namespace threads { namespace detail
         }
         boost::thread& get_os_thread_handle(std::size_t num_thread);
 
+        bool supports_retiring_workers() const
+        {
+            return sched_.Scheduler::supports_retiring_workers();
+        }
+        std::size_t get_active_os_thread_count() const;
+        void set_active_os_thread_count(std::size_t count, error_code& ec);
+
         void create_thread(thread_init_data& data, thread_id_type& id,
             thread_state_enum initial_state, bool run_now, error_code& ec);
         void create_work(thread_init_data& data,
             thread_state_enum initial_state, error_code& ec);
+        void create_threads(std::vector<thread_init_data>& data,
+            thread_state_enum initial_state, error_code& ec);
 
         thread_state set_state(thread_id_type const& id,
             thread_state_enum new_state, thread_state_ex_enum new_state_ex,
@@ -105,6 +114,9 @@ namespace hpx { namespace threads { namespace detail
         std::int64_t avg_idle_rate(bool reset);
         std::int64_t avg_idle_rate(std::size_t num_thread, bool reset);
 
+        // idle-rate of the active worker threads since the previous call
+        std::int64_t sample_active_idle_rate();
+
 #if defined(HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES)
         std::int64_t avg_creation_idle_rate(bool reset);
         std::int64_t avg_cleanup_idle_rate(bool reset);
@@ -120,6 +132,15 @@ namespace hpx { namespace threads { namespace detail
             std::size_t num_thread) const;
 #endif
 
+        std::int64_t get_num_deadline_misses(std::size_t num, bool reset);
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        std::int64_t get_idle_backoff_count(std::size_t num, bool reset);
+        std::int64_t get_idle_park_count(std::size_t num, bool reset);
+        std::int64_t get_idle_wakeup_latency(std::size_t num, bool reset);
+        std::int64_t get_idle_backoff_time(std::size_t num, bool reset);
+#endif
+
 #if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
         std::int64_t get_num_pending_misses(std::size_t num, bool reset);
         std::int64_t get_num_pending_accesses(std::size_t num, bool reset);
@@ -214,6 +235,9 @@ namespace hpx { namespace threads { namespace detail
         std::vector<std::uint64_t> reset_idle_rate_time_;
         std::vector<std::uint64_t> reset_idle_rate_time_total_;
 
+        std::vector<std::uint64_t> sampled_idle_rate_time_;
+        std::vector<std::uint64_t> sampled_idle_rate_time_total_;
+
 #if defined(HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES)
         std::vector<std::uint64_t> reset_creation_idle_rate_time_;
         std::vector<std::uint64_t> reset_creation_idle_rate_time_total_;
@@ -35,6 +35,12 @@ namespace hpx { namespace threads { namespace executors
             default_executor(thread_priority priority,
                 thread_stacksize stacksize, std::size_t os_thread);
 
+            // All threads created by this executor get a deadline of
+            // rel_deadline after the time they become ready to run.
+            default_executor(util::steady_duration const& rel_deadline,
+                thread_priority priority, thread_stacksize stacksize,
+                std::size_t os_thread);
+
             // Schedule the specified function for execution in this executor.
             // Depending on the subclass implementation, this may block in some
             // situations.
@@ -78,9 +84,16 @@ namespace hpx { namespace threads { namespace executors
                 threads::detail::executor_parameter p, error_code& ec) const;
 
         private:
+            thread_id_type register_thread(closure_type&& f,
+                util::thread_description const& description,
+                threads::thread_state_enum initial_state, bool run_now,
+                threads::thread_stacksize stacksize, std::uint64_t start_time,
+                error_code& ec);
+
             thread_stacksize stacksize_;
             thread_priority priority_;
             std::size_t os_thread_;
+            std::uint64_t rel_deadline_;    // [ns], zero if none
         };
     }
 
@@ -107,6 +120,17 @@ namespace hpx { namespace threads { namespace executors
           : scheduled_executor(new detail::default_executor(
                 thread_priority_default, thread_stacksize_default, os_thread))
         {}
+
+        /// Create an executor whose threads have to finish within the given
+        /// time after they have been scheduled. The deadline is taken into
+        /// account by the deadline scheduler (--hpx:queuing=deadline) only.
+        default_executor(util::steady_duration const& rel_deadline,
+                thread_priority priority = thread_priority_default,
+                thread_stacksize stacksize = thread_stacksize_default,
+                std::size_t os_thread = std::size_t(-1))
+          : scheduled_executor(new detail::default_executor(
+                rel_deadline, priority, stacksize, os_thread))
+        {}
     };
 }}}
 
@@ -0,0 +1,161 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_THREADMANAGER_POLICIES_DEADLINE_QUEUE_BACKEND_HPP)
+#define HPX_THREADMANAGER_POLICIES_DEADLINE_QUEUE_BACKEND_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/threads/thread_data.hpp>
+#include <hpx/runtime/threads/thread_init_data.hpp>
+#include <hpx/util/spinlock.hpp>
+#include <hpx/util/tuple.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace hpx { namespace threads { namespace policies
+{
+    struct deadline_fifo;
+
+    namespace detail
+    {
+        // Extract the deadline from the items stored in the pending and
+        // staged queues of a thread_queue. Items without a deadline are
+        // ordered after all items with a deadline.
+        inline std::uint64_t get_deadline(thread_data* thrd)
+        {
+            std::uint64_t deadline = thrd->get_deadline();
+            return deadline != 0 ? deadline : std::uint64_t(-1);
+        }
+
+        template <typename ... Ts>
+        std::uint64_t get_deadline(util::tuple<thread_data*, Ts...>* desc)
+        {
+            return get_deadline(util::get<0>(*desc));
+        }
+
+        template <typename ... Ts>
+        std::uint64_t get_deadline(util::tuple<thread_init_data, Ts...>* desc)
+        {
+            std::uint64_t deadline = util::get<0>(*desc).deadline;
+            return deadline != 0 ? deadline : std::uint64_t(-1);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Queue backend returning the item with the earliest deadline first.
+    // Items with equal deadlines (including items without any deadline) are
+    // returned in FIFO order. The earliest deadline currently queued is
+    // published for other workers to decide where to steal from.
+    template <typename T>
+    struct deadline_fifo_backend
+    {
+        typedef deadline_fifo_backend container_type;
+        typedef T value_type;
+        typedef T& reference;
+        typedef T const& const_reference;
+        typedef std::uint64_t size_type;
+
+    private:
+        typedef hpx::util::spinlock mutex_type;
+
+        struct entry
+        {
+            std::uint64_t deadline_;
+            std::uint64_t seq_;
+            T val_;
+        };
+
+        // std::push_heap/pop_heap maintain a max-heap, the entry comparing
+        // 'smallest' ends up at the front
+        struct later
+        {
+            bool operator()(entry const& lhs, entry const& rhs) const
+            {
+                if (lhs.deadline_ != rhs.deadline_)
+                    return lhs.deadline_ > rhs.deadline_;
+                return lhs.seq_ > rhs.seq_;
+            }
+        };
+
+    public:
+        deadline_fifo_backend(
+            size_type initial_size = 0
+          , size_type num_thread = size_type(-1)
+            )
+          : seq_(0),
+            earliest_deadline_(std::uint64_t(-1))
+        {
+            heap_.reserve(std::size_t(initial_size));
+        }
+
+        bool push(const_reference val, bool /*other_end*/ = false)
+        {
+            entry e = { detail::get_deadline(val), 0, val };
+
+            std::lock_guard<mutex_type> l(mtx_);
+            e.seq_ = seq_++;
+            heap_.push_back(e);
+            std::push_heap(heap_.begin(), heap_.end(), later());
+            update_earliest_deadline();
+            return true;
+        }
+
+        bool pop(reference val, bool /*steal*/ = true)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (heap_.empty())
+                return false;
+
+            std::pop_heap(heap_.begin(), heap_.end(), later());
+            val = heap_.back().val_;
+            heap_.pop_back();
+            update_earliest_deadline();
+            return true;
+        }
+
+        bool empty()
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            return heap_.empty();
+        }
+
+        // return the earliest deadline of all queued items, std::uint64_t(-1)
+        // if the queue is empty or none of the items has a deadline
+        std::uint64_t get_earliest_deadline() const
+        {
+            return earliest_deadline_.load(boost::memory_order_relaxed);
+        }
+
+        void on_start_thread() {}
+
+    private:
+        void update_earliest_deadline()
+        {
+            earliest_deadline_.store(
+                heap_.empty() ? std::uint64_t(-1) : heap_.front().deadline_,
+                boost::memory_order_relaxed);
+        }
+
+        mutex_type mtx_;
+        std::vector<entry> heap_;
+        std::uint64_t seq_;
+        boost::atomic<std::uint64_t> earliest_deadline_;
+    };
+
+    struct deadline_fifo
+    {
+        template <typename T>
+        struct apply
+        {
+            typedef deadline_fifo_backend<T> type;
+        };
+    };
+}}}
+
+#endif
@@ -0,0 +1,234 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_THREADMANAGER_SCHEDULING_DEADLINE_QUEUE_HPP)
+#define HPX_THREADMANAGER_SCHEDULING_DEADLINE_QUEUE_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DEADLINE_SCHEDULER)
+#include <hpx/runtime/threads/policies/deadline_queue_backend.hpp>
+#include <hpx/runtime/threads/policies/local_priority_queue_scheduler.hpp>
+#include <hpx/runtime/threads/thread_data.hpp>
+#include <hpx/runtime/threads_fwd.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies
+{
+    namespace detail
+    {
+        // Deadline statistics of a single worker thread
+        struct deadline_data
+        {
+            deadline_data()
+              : misses_(0)
+            {}
+
+            boost::atomic<std::int64_t> misses_;
+
+            // avoid false sharing between workers
+            char padding_[64];
+        };
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The deadline_queue_scheduler implements earliest-deadline-first (EDF)
+    /// scheduling. It maintains exactly one deadline ordered queue of work
+    /// items (threads) per OS thread. Threads created with a deadline (see
+    /// thread_init_data::deadline) are executed in the order of their
+    /// deadlines, threads without a deadline are executed after all threads
+    /// with a deadline in FIFO order.
+    /// An OS thread executes the threads with a deadline from its own queue
+    /// first. Only if there is none, it steals the thread with the earliest
+    /// deadline from the queues of the other OS threads. High and low
+    /// priority threads are handled as by the local_priority_queue_scheduler,
+    /// high priority threads are executed before any thread with a deadline.
+    template <typename Mutex
+            , typename PendingQueuing
+            , typename StagedQueuing
+            , typename TerminatedQueuing
+             >
+    class deadline_queue_scheduler
+        : public local_priority_queue_scheduler<
+            Mutex, PendingQueuing, StagedQueuing, TerminatedQueuing
+          >
+    {
+    public:
+        typedef local_priority_queue_scheduler<
+            Mutex, PendingQueuing, StagedQueuing, TerminatedQueuing
+        > base_type;
+
+        typedef typename base_type::thread_queue_type thread_queue_type;
+
+        typedef typename base_type::init_parameter_type
+            init_parameter_type;
+
+        deadline_queue_scheduler(init_parameter_type const& init,
+                bool deferred_initialization = true)
+          : base_type(init, deferred_initialization),
+            deadline_data_(init.num_queues_)
+        {}
+
+        static std::string get_scheduler_name()
+        {
+            return "deadline_queue_scheduler";
+        }
+
+        /// Return the next thread to be executed, return false if non is
+        /// available
+        bool get_next_thread(std::size_t num_thread,
+            std::int64_t& idle_loop_count, threads::thread_data*& thrd)
+        {
+            std::size_t queues_size = this->queues_.size();
+
+            HPX_ASSERT(num_thread < queues_size);
+            thread_queue_type* this_queue = this->queues_[num_thread];
+
+            if (num_thread < this->high_priority_queues_.size())
+            {
+                thread_queue_type* q = this->high_priority_queues_[num_thread];
+
+                q->increment_num_pending_accesses();
+                if (q->get_next_thread(thrd))
+                    return true;
+                q->increment_num_pending_misses();
+            }
+
+            // the own queue is ordered by deadline, look at the deadlines of
+            // the other queues only if it has no thread with a deadline
+            if (this_queue->get_earliest_deadline() != std::uint64_t(-1))
+            {
+                this_queue->increment_num_pending_accesses();
+                if (this_queue->get_next_thread(thrd))
+                    return true;
+                this_queue->increment_num_pending_misses();
+            }
+
+            // retired workers don't steal work
+            if (!this->is_worker_active(num_thread))
+            {
+                return base_type::get_next_thread(num_thread, idle_loop_count,
+                    thrd);
+            }
+
+            // steal the thread with the earliest deadline of all other queues
+            std::size_t earliest = num_thread;
+            std::uint64_t earliest_deadline = std::uint64_t(-1);
+
+            for (std::size_t i = 0; i != queues_size; ++i)
+            {
+                if (i == num_thread)
+                    continue;
+
+                std::uint64_t deadline =
+                    this->queues_[i]->get_earliest_deadline();
+                if (deadline < earliest_deadline)
+                {
+                    earliest = i;
+                    earliest_deadline = deadline;
+                }
+            }
+
+            if (earliest_deadline != std::uint64_t(-1))
+            {
+                thread_queue_type* q = this->queues_[earliest];
+                if (q->get_next_thread(thrd))
+                {
+                    q->increment_num_stolen_from_pending();
+                    this_queue->increment_num_stolen_to_pending();
+                    return true;
+                }
+            }
+
+            // no thread with a deadline is pending (or it was stolen in the
+            // meantime), fall back to the regular queue processing
+            return base_type::get_next_thread(num_thread, idle_loop_count,
+                thrd);
+        }
+
+        /// Destroy the passed thread as it has been terminated, count it as
+        /// a deadline miss if it terminated after its deadline
+        bool destroy_thread(threads::thread_data* thrd,
+            std::int64_t& busy_count)
+        {
+            std::uint64_t deadline = thrd->get_deadline();
+            bool missed = deadline != 0 &&
+                util::high_resolution_clock::now() > deadline;
+
+            for (std::size_t i = 0; i != this->high_priority_queues_.size(); ++i)
+            {
+                if (this->high_priority_queues_[i]->destroy_thread(
+                        thrd, busy_count))
+                {
+                    if (missed)
+                        ++deadline_data_[i].misses_;
+                    return true;
+                }
+            }
+
+            for (std::size_t i = 0; i != this->queues_.size(); ++i)
+            {
+                if (this->queues_[i]->destroy_thread(thrd, busy_count))
+                {
+                    if (missed)
+                        ++deadline_data_[i].misses_;
+                    return true;
+                }
+            }
+
+            if (this->low_priority_queue_.destroy_thread(thrd, busy_count))
+            {
+                if (missed)
+                    ++low_priority_deadline_data_.misses_;
+                return true;
+            }
+
+            // the thread has to belong to one of the queues, always
+            HPX_ASSERT(false);
+
+            return false;
+        }
+
+        std::int64_t get_num_deadline_misses(std::size_t num_thread,
+            bool reset)
+        {
+            if (num_thread != std::size_t(-1))
+            {
+                HPX_ASSERT(num_thread < deadline_data_.size());
+                return util::get_and_reset_value(
+                    deadline_data_[num_thread].misses_, reset);
+            }
+
+            std::int64_t result = 0;
+            for (detail::deadline_data& d : deadline_data_)
+                result += util::get_and_reset_value(d.misses_, reset);
+            result += util::get_and_reset_value(
+                low_priority_deadline_data_.misses_, reset);
+            return result;
+        }
+
+    private:
+        std::vector<detail::deadline_data> deadline_data_;
+
+        // misses of the threads run from the low priority queue are not
+        // attributed to any of the workers
+        detail::deadline_data low_priority_deadline_data_;
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
+#endif
@@ -108,6 +108,12 @@ namespace hpx { namespace threads
           , error_code& ec = throws
             ) const;
 
+        mask_cref_type get_cache_affinity_mask(
+            std::size_t num_thread
+          , bool numa_sensitive
+          , error_code& ec = throws
+            ) const;
+
         mask_cref_type get_thread_affinity_mask(
             std::size_t num_thread
           , bool numa_sensitive = false
@@ -188,6 +194,10 @@ namespace hpx { namespace threads
         /// Free memory that was previously allocated by allocate
         void deallocate(void* addr, std::size_t len) const;
 
+        /// Bind the given memory area to the given NUMA domain
+        bool set_area_membind_nodeset(void const* addr, std::size_t len,
+            std::size_t numa_node) const;
+
     private:
         static mask_type empty_mask;
 
@@ -239,6 +249,7 @@ namespace hpx { namespace threads
             return init_core_affinity_mask_from_core(
                 get_core_number(num_thread), default_mask);
         }
+        mask_type init_cache_affinity_mask(std::size_t num_thread) const;
 
         void init_num_of_pus();
 
@@ -268,6 +279,7 @@ namespace hpx { namespace threads
         std::vector<mask_type> socket_affinity_masks_;
         std::vector<mask_type> numa_node_affinity_masks_;
         std::vector<mask_type> core_affinity_masks_;
+        std::vector<mask_type> cache_affinity_masks_;
         std::vector<mask_type> thread_affinity_masks_;
     };
 
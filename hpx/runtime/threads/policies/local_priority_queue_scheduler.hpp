@@ -21,6 +21,7 @@
 #include <boost/atomic.hpp>
 #include <boost/exception_ptr.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -74,10 +75,13 @@ namespace hpx { namespace threads { namespace policies
             Mutex, PendingQueuing, StagedQueuing, TerminatedQueuing
         > thread_queue_type;
 
-        // the scheduler type takes two initialization parameters:
+        // the scheduler type takes these initialization parameters:
         //    the number of queues
         //    the number of high priority queues
         //    the maxcount per queue
+        //    the NUMA sensitivity
+        //    whether to select stealing victims by topological distance
+        //    the maximal number of failed steal attempts (0: no limit)
         struct init_parameter
         {
             init_parameter()
@@ -85,21 +89,27 @@ namespace hpx { namespace threads { namespace policies
                 num_high_priority_queues_(1),
                 max_queue_thread_count_(max_thread_count),
                 numa_sensitive_(0),
-                description_("local_priority_queue_scheduler")
+                description_("local_priority_queue_scheduler"),
+                hierarchical_stealing_(false),
+                max_steal_attempts_(0)
             {}
 
             init_parameter(std::size_t num_queues,
                     std::size_t num_high_priority_queues = std::size_t(-1),
                     std::size_t max_queue_thread_count = max_thread_count,
                     std::size_t numa_sensitive = 0,
-                    char const* description = "local_priority_queue_scheduler")
+                    char const* description = "local_priority_queue_scheduler",
+                    bool hierarchical_stealing = false,
+                    std::size_t max_steal_attempts = 0)
               : num_queues_(num_queues),
                 num_high_priority_queues_(
                     num_high_priority_queues == std::size_t(-1) ?
                         num_queues : num_high_priority_queues),
                 max_queue_thread_count_(max_queue_thread_count),
                 numa_sensitive_(numa_sensitive),
-                description_(description)
+                description_(description),
+                hierarchical_stealing_(hierarchical_stealing),
+                max_steal_attempts_(max_steal_attempts)
             {}
 
             init_parameter(std::size_t num_queues, char const* description)
@@ -107,7 +117,9 @@ namespace hpx { namespace threads { namespace policies
                 num_high_priority_queues_(num_queues),
                 max_queue_thread_count_(max_thread_count),
                 numa_sensitive_(false),
-                description_(description)
+                description_(description),
+                hierarchical_stealing_(false),
+                max_steal_attempts_(0)
             {}
 
             std::size_t num_queues_;
@@ -115,6 +127,8 @@ namespace hpx { namespace threads { namespace policies
             std::size_t max_queue_thread_count_;
             std::size_t numa_sensitive_;
             char const* description_;
+            bool hierarchical_stealing_;
+            std::size_t max_steal_attempts_;
         };
         typedef init_parameter init_parameter_type;
 
@@ -127,6 +141,9 @@ namespace hpx { namespace threads { namespace policies
             low_priority_queue_(init.max_queue_thread_count_),
             curr_queue_(0),
             numa_sensitive_(init.numa_sensitive_),
+            hierarchical_stealing_(init.hierarchical_stealing_),
+            max_steal_attempts_(init.max_steal_attempts_),
+            victims_(init.num_queues_),
 #if !defined(HPX_NATIVE_MIC)        // we know that the MIC has one NUMA domain only
             steals_in_numa_domain_(),
             steals_outside_numa_domain_(),
@@ -466,12 +483,7 @@ namespace hpx { namespace threads { namespace policies
 //             }
 #endif
             std::size_t queue_size = queues_.size();
-
-            if (std::size_t(-1) == num_thread)
-                num_thread = curr_queue_++ % queue_size;
-
-            if (num_thread >= queue_size)
-                num_thread %= queue_size;
+            num_thread = select_active_queue(num_thread);
 
             // now create the thread
             if (data.priority == thread_priority_critical) {
@@ -500,6 +512,72 @@ namespace hpx { namespace threads { namespace policies
                 run_now, ec);
         }
 
+        // create a whole range of threads using a single operation on each
+        // of the target queues, threads with a non-normal priority still
+        // have to be distributed to their designated queues one by one
+        void create_threads(std::vector<thread_init_data>& data,
+            thread_state_enum initial_state, error_code& ec,
+            std::size_t num_thread)
+        {
+            std::size_t unplaced = 0;
+            for (thread_init_data const& d : data)
+            {
+                if (d.priority == thread_priority_critical ||
+                    d.priority == thread_priority_boost ||
+                    d.priority == thread_priority_low)
+                {
+                    scheduler_base::create_threads(data, initial_state, ec,
+                        num_thread);
+                    return;
+                }
+
+                std::size_t target = std::size_t(-1) == num_thread ?
+                    d.num_os_thread : num_thread;
+                if (std::size_t(-1) == target)
+                    ++unplaced;
+            }
+
+            // Threads with an explicit placement go to the requested queue.
+            // All others are spread over the active queues in contiguous
+            // chunks, one chunk per queue.
+            std::size_t const active = (std::min)(
+                this->get_active_thread_count(), queues_.size());
+            std::size_t const chunk_size = (std::max)(
+                (unplaced + active - 1) / active, std::size_t(1));
+
+            std::vector<std::vector<thread_init_data> > batches(queues_.size());
+            std::size_t chunk_queue = 0;
+            std::size_t placed = 0;
+            for (thread_init_data& d : data)
+            {
+                std::size_t target = std::size_t(-1) == num_thread ?
+                    d.num_os_thread : num_thread;
+                if (std::size_t(-1) == target)
+                {
+                    if (placed++ % chunk_size == 0)
+                        chunk_queue = select_active_queue(std::size_t(-1));
+                    target = chunk_queue;
+                }
+                else
+                {
+                    target = select_active_queue(target);
+                }
+
+                HPX_ASSERT(target < queues_.size());
+                batches[target].push_back(std::move(d));
+            }
+
+            for (std::size_t i = 0; i != batches.size(); ++i)
+            {
+                if (batches[i].empty())
+                    continue;
+
+                queues_[i]->create_threads(batches[i], initial_state, ec);
+                if (ec)
+                    return;
+            }
+        }
+
         /// Return the next thread to be executed, return false if none is
         /// available
         virtual bool get_next_thread(std::size_t num_thread,
@@ -539,7 +617,43 @@ namespace hpx { namespace threads { namespace policies
                     return false;
             }
 
-            if (numa_sensitive_ != 0)   // limited or no stealing across domains
+            // retired workers don't steal work
+            if (HPX_UNLIKELY(!this->is_worker_active(num_thread)))
+                return false;
+
+            if (hierarchical_stealing_)
+            {
+                // steal thread from other queues, closest ones first
+                bool result = for_each_victim(num_thread,
+                    [&](std::size_t idx) -> bool
+                    {
+                        if (idx < high_priority_queues &&
+                            num_thread < high_priority_queues)
+                        {
+                            thread_queue_type* q = high_priority_queues_[idx];
+                            if (q->get_next_thread(thrd))
+                            {
+                                q->increment_num_stolen_from_pending();
+                                this_high_priority_queue->
+                                    increment_num_stolen_to_pending();
+                                return true;
+                            }
+                        }
+
+                        if (queues_[idx]->get_next_thread(thrd))
+                        {
+                            queues_[idx]->increment_num_stolen_from_pending();
+                            this_queue->increment_num_stolen_to_pending();
+                            return true;
+                        }
+                        return false;
+                    });
+
+                if (result)
+                    return true;
+            }
+
+            else if (numa_sensitive_ != 0)   // limited or no stealing across domains
             {
 
                 // steal thread from other queue of same NUMA domain
@@ -663,8 +777,7 @@ namespace hpx { namespace threads { namespace policies
             std::size_t num_thread,
             thread_priority priority = thread_priority_normal)
         {
-            if (std::size_t(-1) == num_thread)
-                num_thread = curr_queue_++ % queues_.size();
+            num_thread = select_active_queue(num_thread);
 
             if (priority == thread_priority_critical ||
                 priority == thread_priority_boost)
@@ -685,8 +798,7 @@ namespace hpx { namespace threads { namespace policies
             std::size_t num_thread,
             thread_priority priority = thread_priority_normal)
         {
-            if (std::size_t(-1) == num_thread)
-                num_thread = curr_queue_++ % queues_.size();
+            num_thread = select_active_queue(num_thread);
 
             if (priority == thread_priority_critical ||
                 priority == thread_priority_boost)
@@ -1009,7 +1121,50 @@ namespace hpx { namespace threads { namespace policies
                 running, idle_loop_count, added) && result;
             if (0 != added) return result;
 
-            if (numa_sensitive_ != 0)   // limited or no cross domain stealing
+            // retired workers don't steal work
+            if (HPX_UNLIKELY(!this->is_worker_active(num_thread)))
+                return result;
+
+            if (hierarchical_stealing_)
+            {
+                // steal work items from other queues, closest ones first
+                bool stolen = for_each_victim(num_thread,
+                    [&](std::size_t idx) -> bool
+                    {
+                        if (idx < high_priority_queues &&
+                            num_thread < high_priority_queues)
+                        {
+                            thread_queue_type* q =  high_priority_queues_[idx];
+                            result = this_high_priority_queue->
+                                wait_or_add_new(running, idle_loop_count,
+                                    added, q)
+                              && result;
+
+                            if (0 != added)
+                            {
+                                q->increment_num_stolen_from_staged(added);
+                                this_high_priority_queue->
+                                    increment_num_stolen_to_staged(added);
+                                return true;
+                            }
+                        }
+
+                        result = this_queue->wait_or_add_new(running,
+                            idle_loop_count, added, queues_[idx]) && result;
+                        if (0 != added)
+                        {
+                            queues_[idx]->increment_num_stolen_from_staged(added);
+                            this_queue->increment_num_stolen_to_staged(added);
+                            return true;
+                        }
+                        return false;
+                    });
+
+                if (stolen)
+                    return result;
+            }
+
+            else if (numa_sensitive_ != 0)   // limited or no cross domain stealing
             {
                 // steal work items: first try to steal from other cores in
                 // the same NUMA node
@@ -1236,6 +1391,9 @@ namespace hpx { namespace threads { namespace policies
                 outside_numa_domain_masks_[num_thread] =
                     not_(node_mask) & machine_mask;
             }
+
+            if (hierarchical_stealing_)
+                init_victims(num_thread);
         }
 
         void on_stop_thread(std::size_t num_thread)
@@ -1263,13 +1421,211 @@ namespace hpx { namespace threads { namespace policies
             curr_queue_.store(0);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        bool supports_retiring_workers() const
+        {
+            return true;
+        }
+
+        // hand the staged and pending work of a retired worker over to one
+        // of the active workers
+        void migrate_work(std::size_t num_thread)
+        {
+            std::size_t const active = (std::min)(
+                this->get_active_thread_count(), queues_.size());
+            if (num_thread < active || num_thread >= queues_.size())
+                return;
+
+            std::size_t const target = num_thread % active;
+            std::int64_t moved = 0;
+
+            if (num_thread < high_priority_queues_.size())
+            {
+                thread_queue_type* src = high_priority_queues_[num_thread];
+                thread_queue_type* dest = high_priority_queues_[
+                    target % high_priority_queues_.size()];
+
+                moved += src->get_queue_length();
+                dest->move_task_items_from(src, -1);
+                dest->move_work_items_from(src, -1);
+            }
+
+            thread_queue_type* src = queues_[num_thread];
+            moved += src->get_queue_length();
+            queues_[target]->move_task_items_from(src, -1);
+            queues_[target]->move_work_items_from(src, -1);
+
+            if (moved != 0)
+                this->do_some_work(target);
+        }
+
+        // the low priority queue is shared by all workers, it is not taken
+        // into account
+        bool has_queued_work(std::size_t num_thread) const
+        {
+            HPX_ASSERT(num_thread < queues_.size());
+
+            if (num_thread < high_priority_queues_.size() &&
+                high_priority_queues_[num_thread]->get_queue_length() != 0)
+            {
+                return true;
+            }
+            return queues_[num_thread]->get_queue_length() != 0;
+        }
+
     protected:
+        // select the queue for new work, work is never placed onto the
+        // queues of retired workers
+        std::size_t select_active_queue(std::size_t num_thread)
+        {
+            std::size_t const active = (std::min)(
+                this->get_active_thread_count(), queues_.size());
+
+            if (std::size_t(-1) == num_thread)
+                return curr_queue_++ % active;
+
+            return num_thread < active ? num_thread : num_thread % active;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The queues other OS threads may steal from, ordered by the distance
+        // of the processing units they are running on: hyperthread siblings,
+        // processing units sharing a cache, processing units of the same NUMA
+        // domain, and everything else.
+        enum victim_level
+        {
+            victim_level_core = 0,
+            victim_level_cache = 1,
+            victim_level_numa_domain = 2,
+            victim_level_remote = 3,
+            victim_level_count = 4
+        };
+
+        struct victim_data
+        {
+            victim_data()
+              : seed_(0)
+            {
+                for (std::size_t i = 0; i != victim_level_count; ++i)
+                    level_ends_[i] = 0;
+            }
+
+            // xorshift generator, used by the owning OS thread only
+            std::uint64_t next_random()
+            {
+                seed_ ^= seed_ << 13;
+                seed_ ^= seed_ >> 7;
+                seed_ ^= seed_ << 17;
+                return seed_;
+            }
+
+            std::vector<std::size_t> victims_;
+            std::size_t level_ends_[victim_level_count];
+            std::uint64_t seed_;
+
+            // avoid false sharing between workers, seed_ is written on every
+            // scheduling cycle
+            char padding_[64];
+        };
+
+        void init_victims(std::size_t num_thread)
+        {
+            std::size_t queues_size = queues_.size();
+            bool numa_sensitive = numa_sensitive_ != 0;
+
+            std::size_t num_pu = get_pu_num(num_thread);
+            mask_cref_type core_mask =
+                topology_.get_core_affinity_mask(num_pu, numa_sensitive);
+            mask_cref_type cache_mask =
+                topology_.get_cache_affinity_mask(num_pu, numa_sensitive);
+            mask_cref_type node_mask =
+                topology_.get_numa_node_affinity_mask(num_pu, numa_sensitive);
+
+            // stealing across NUMA domains is limited by the NUMA sensitivity
+#if !defined(HPX_NATIVE_MIC)        // we know that the MIC has one NUMA domain only
+            bool steal_remote = numa_sensitive_ == 0 ||
+                test(steals_outside_numa_domain_, num_pu); //-V600 //-V111
+#else
+            bool steal_remote = true;
+#endif
+
+            std::vector<std::size_t> levels[victim_level_count];
+            for (std::size_t i = 1; i < queues_size; ++i)
+            {
+                std::size_t const idx = (i + num_thread) % queues_size;
+                std::size_t pu_num = get_pu_num(idx);
+
+                bool in_numa_domain = pu_num < mask_size(node_mask) &&
+                    test(node_mask, pu_num); //-V600 //-V111
+
+                if (pu_num < mask_size(core_mask) && test(core_mask, pu_num))
+                    levels[victim_level_core].push_back(idx);
+                else if (in_numa_domain && pu_num < mask_size(cache_mask) &&
+                        test(cache_mask, pu_num))
+                    levels[victim_level_cache].push_back(idx);
+                else if (in_numa_domain)
+                    levels[victim_level_numa_domain].push_back(idx);
+                else if (steal_remote)
+                    levels[victim_level_remote].push_back(idx);
+            }
+
+            victim_data& data = victims_[num_thread];
+            data.victims_.clear();
+            data.victims_.reserve(queues_size);
+            for (std::size_t i = 0; i != victim_level_count; ++i)
+            {
+                data.victims_.insert(data.victims_.end(),
+                    levels[i].begin(), levels[i].end());
+                data.level_ends_[i] = data.victims_.size();
+            }
+
+            // the seed must not be zero
+            data.seed_ = 0x9e3779b97f4a7c15ull * (num_thread + 1);
+        }
+
+        // Invoke f for the queues to steal from, closest ones first. The
+        // victims of the same distance are visited starting at a random
+        // position. Stop as soon as f returns true or the maximal number of
+        // failed steal attempts has been reached.
+        template <typename F>
+        bool for_each_victim(std::size_t num_thread, F && f)
+        {
+            victim_data& data = victims_[num_thread];
+
+            std::size_t attempts = 0;
+            std::size_t begin = 0;
+            for (std::size_t level = 0; level != victim_level_count; ++level)
+            {
+                std::size_t end = data.level_ends_[level];
+                std::size_t count = end - begin;
+                if (count != 0)
+                {
+                    std::size_t offset = count == 1 ? 0 :
+                        static_cast<std::size_t>(data.next_random() % count);
+
+                    for (std::size_t i = 0; i != count; ++i)
+                    {
+                        if (f(data.victims_[begin + (offset + i) % count]))
+                            return true;
+
+                        if (++attempts == max_steal_attempts_)
+                            return false;
+                    }
+                }
+                begin = end;
+            }
+            return false;
+        }
+
         std::size_t max_queue_thread_count_;
         std::vector<thread_queue_type*> queues_;
         std::vector<thread_queue_type*> high_priority_queues_;
         thread_queue_type low_priority_queue_;
         boost::atomic<std::size_t> curr_queue_;
         std::size_t numa_sensitive_;
+        bool hierarchical_stealing_;
+        std::size_t max_steal_attempts_;
+        std::vector<victim_data> victims_;
 
 #if !defined(HPX_NATIVE_MIC)        // we know that the MIC has one NUMA domain only
         mask_type steals_in_numa_domain_;
@@ -21,6 +21,7 @@
 #include <boost/atomic.hpp>
 #include <boost/exception_ptr.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -302,12 +303,7 @@ namespace hpx { namespace threads { namespace policies
 //             }
 #endif
             std::size_t queue_size = queues_.size();
-
-            if (std::size_t(-1) == num_thread)
-                num_thread = curr_queue_++ % queue_size;
-
-            if (num_thread >= queue_size)
-                num_thread %= queue_size;
+            num_thread = select_active_queue(num_thread);
 
             HPX_ASSERT(num_thread < queue_size);
             queues_[num_thread]->create_thread(data, id, initial_state,
@@ -340,6 +336,10 @@ namespace hpx { namespace threads { namespace policies
                     return false;
             }
 
+            // retired workers don't steal work
+            if (HPX_UNLIKELY(!this->is_worker_active(num_thread)))
+                return false;
+
             if (numa_sensitive_ != 0)
             {
                 // steal work items: first try to steal from other cores in
@@ -431,8 +431,7 @@ namespace hpx { namespace threads { namespace policies
         void schedule_thread(threads::thread_data* thrd, std::size_t num_thread,
             thread_priority priority = thread_priority_normal)
         {
-            if (std::size_t(-1) == num_thread)
-                num_thread = curr_queue_++ % queues_.size();
+            num_thread = select_active_queue(num_thread);
 
             HPX_ASSERT(num_thread < queues_.size());
             queues_[num_thread]->schedule_thread(thrd);
@@ -442,8 +441,7 @@ namespace hpx { namespace threads { namespace policies
             std::size_t num_thread,
             thread_priority priority = thread_priority_normal)
         {
-            if (std::size_t(-1) == num_thread)
-                num_thread = curr_queue_++ % queues_.size();
+            num_thread = select_active_queue(num_thread);
 
             HPX_ASSERT(num_thread < queues_.size());
             queues_[num_thread]->schedule_thread(thrd, true);
@@ -622,6 +620,10 @@ namespace hpx { namespace threads { namespace policies
                 idle_loop_count, added) && result;
             if (0 != added) return result;
 
+            // retired workers don't steal work
+            if (HPX_UNLIKELY(!this->is_worker_active(num_thread)))
+                return result;
+
             if (numa_sensitive_ != 0)   // limited or no stealing across domains
             {
                 // steal work items: first try to steal from other cores in
@@ -795,7 +797,46 @@ namespace hpx { namespace threads { namespace policies
             curr_queue_.store(0);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        bool supports_retiring_workers() const
+        {
+            return true;
+        }
+
+        // hand the staged and pending work of a retired worker over to one
+        // of the active workers
+        void migrate_work(std::size_t num_thread)
+        {
+            std::size_t const active = (std::min)(
+                this->get_active_thread_count(), queues_.size());
+            if (num_thread < active || num_thread >= queues_.size())
+                return;
+
+            std::size_t const target = num_thread % active;
+
+            thread_queue_type* src = queues_[num_thread];
+            std::int64_t moved = src->get_queue_length();
+            queues_[target]->move_task_items_from(src, -1);
+            queues_[target]->move_work_items_from(src, -1);
+
+            if (moved != 0)
+                this->do_some_work(target);
+        }
+
     protected:
+        // select the queue for new work, work is never placed onto the
+        // queues of retired workers
+        std::size_t select_active_queue(std::size_t num_thread)
+        {
+            std::size_t const active = (std::min)(
+                this->get_active_thread_count(), queues_.size());
+
+            if (std::size_t(-1) == num_thread)
+                return curr_queue_++ % active;
+
+            return num_thread < active ? num_thread : num_thread % active;
+        }
+
         std::size_t max_queue_thread_count_;
         std::vector<thread_queue_type*> queues_;
         boost::atomic<std::size_t> curr_queue_;
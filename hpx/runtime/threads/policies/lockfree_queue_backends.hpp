@@ -10,7 +10,11 @@
 
 #include <hpx/config.hpp>
 
+#include <hpx/util/lockfree/chase_lev_deque.hpp>
 #include <hpx/util/lockfree/deque.hpp>
+#include <hpx/util/thread_specific_ptr.hpp>
+
+#include <boost/atomic.hpp>
 #include <boost/lockfree/queue.hpp>
 #include <boost/lockfree/stack.hpp>
 
@@ -55,6 +59,8 @@ struct basic_lockfree_queue_backend
         return queue_.empty();
     }
 
+    void on_start_thread() {}
+
   private:
     container_type queue_;
 };
@@ -120,6 +126,8 @@ struct lockfree_abp_fifo_backend
         return queue_.empty();
     }
 
+    void on_start_thread() {}
+
   private:
     container_type queue_;
 };
@@ -170,6 +178,8 @@ struct lockfree_abp_lifo_backend
         return queue_.empty();
     }
 
+    void on_start_thread() {}
+
   private:
     container_type queue_;
 };
@@ -185,6 +195,98 @@ struct lockfree_abp_lifo
 
 #endif // HPX_HAVE_ABP_SCHEDULER
 
+///////////////////////////////////////////////////////////////////////////////
+// LIFO for the owning OS thread + FIFO stealing at opposite end.
+#if defined(HPX_HAVE_CHASE_LEV_SCHEDULER)
+struct lockfree_chase_lev;
+
+namespace detail
+{
+    // Returns an address which is unique for the calling OS thread.
+    inline void const* get_os_thread_tag()
+    {
+        static HPX_NATIVE_TLS char tag = 0;
+        return &tag;
+    }
+}
+
+// The Chase-Lev deque allows for only one thread to push and pop at the
+// bottom. This thread is bound in on_start_thread(), which is invoked by the
+// OS thread owning the queue. Items pushed by any other thread are placed
+// into an additional (multi-producer) FIFO queue which is drained by the
+// owner and the thieves once the deque has run empty.
+template <typename T>
+struct lockfree_chase_lev_backend
+{
+    typedef boost::lockfree::chase_lev_deque<T> container_type;
+    typedef T value_type;
+    typedef T& reference;
+    typedef T const& const_reference;
+    typedef std::uint64_t size_type;
+
+    lockfree_chase_lev_backend(
+        size_type initial_size = 0
+      , size_type num_thread = size_type(-1)
+        )
+      : queue_(std::size_t(initial_size)),
+        inbound_queue_(std::size_t(initial_size)),
+        owner_(nullptr)
+    {}
+
+    bool push(const_reference val, bool other_end = false)
+    {
+        if (!other_end && is_owner())
+            return queue_.push_bottom(val);
+        return inbound_queue_.push(val);
+    }
+
+    bool pop(reference val, bool /*steal*/ = true)
+    {
+        if (is_owner())
+        {
+            if (queue_.pop_bottom(val))
+                return true;
+        }
+        else if (queue_.steal_top(val))
+        {
+            return true;
+        }
+        return inbound_queue_.pop(val);
+    }
+
+    bool empty()
+    {
+        return queue_.empty() && inbound_queue_.empty();
+    }
+
+    void on_start_thread()
+    {
+        owner_.store(detail::get_os_thread_tag(), boost::memory_order_release);
+    }
+
+  private:
+    bool is_owner() const
+    {
+        return owner_.load(boost::memory_order_relaxed) ==
+            detail::get_os_thread_tag();
+    }
+
+    container_type queue_;
+    boost::lockfree::queue<T> inbound_queue_;
+    boost::atomic<void const*> owner_;
+};
+
+struct lockfree_chase_lev
+{
+    template <typename T>
+    struct apply
+    {
+        typedef lockfree_chase_lev_backend<T> type;
+    };
+};
+
+#endif // HPX_HAVE_CHASE_LEV_SCHEDULER
+
 }}}
 
 #endif // HPX_FB3518C8_4493_450E_A823_A9F8A3185B2D
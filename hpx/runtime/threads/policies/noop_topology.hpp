@@ -102,6 +102,18 @@ public:
         return empty_mask;
     }
 
+    mask_cref_type get_cache_affinity_mask(
+        std::size_t thread_num
+      , bool numa_sensitive
+      , error_code& ec = throws
+        ) const
+    {
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return empty_mask;
+    }
+
     mask_cref_type get_thread_affinity_mask(
         std::size_t thread_num
       , bool numa_sensitive = false
@@ -240,6 +252,12 @@ public:
     {
         ::operator delete(addr/*, len*/);
     }
+
+    bool set_area_membind_nodeset(void const* addr, std::size_t len,
+        std::size_t numa_node) const
+    {
+        return false;
+    }
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -11,7 +11,9 @@
 #define HPX_THREADMANAGER_SCHEDULING_SCHEDULER_BASE_JUL_14_2013_1132AM
 
 #include <hpx/config.hpp>
+#include <hpx/error_code.hpp>
 #include <hpx/runtime/agas/interface.hpp>
+#include <hpx/runtime/get_config_entry.hpp>
 #include <hpx/runtime/parcelset_fwd.hpp>
 #include <hpx/runtime/threads/policies/affinity_data.hpp>
 #include <hpx/runtime/threads/policies/scheduler_mode.hpp>
@@ -19,6 +21,9 @@
 #include <hpx/runtime/threads/topology.hpp>
 #include <hpx/state.hpp>
 #include <hpx/util/assert.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/safe_lexical_cast.hpp>
 #include <hpx/util_fwd.hpp>
 #if defined(HPX_HAVE_SCHEDULER_LOCAL_STORAGE)
 #include <hpx/runtime/threads/coroutines/detail/tss.hpp>
@@ -38,6 +43,7 @@
 #include <cstdint>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -64,6 +70,25 @@ namespace hpx { namespace threads { namespace policies
             }
             boost::atomic<std::int32_t>& counter_;
         };
+
+        // Idle state of a single worker thread
+        struct idle_backoff_data
+        {
+            idle_backoff_data()
+              : backoff_(0), backoffs_(0), parks_(0),
+                wakeups_(0), wakeup_time_(0)
+            {}
+
+            // all members are read concurrently by the performance counters
+            boost::atomic<std::uint64_t> backoff_;      // backoff period [us]
+            boost::atomic<std::int64_t> backoffs_;      // # backoff periods
+            boost::atomic<std::int64_t> parks_;         // # times parked
+            boost::atomic<std::int64_t> wakeups_;       // # notified wake-ups
+            boost::atomic<std::int64_t> wakeup_time_;   // wake-up latency [ns]
+
+            // avoid false sharing between workers
+            char padding_[64];
+        };
     }
 #endif
 
@@ -84,7 +109,14 @@ namespace hpx { namespace threads { namespace policies
           , mode_(mode)
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
           , wait_count_(0)
+          , last_notification_(0)
+          , idle_data_(num_threads)
+          , idle_backoff_enabled_(true)
+          , min_idle_backoff_time_(10)
+          , max_idle_backoff_time_(1000)
+          , idle_park_timeout_(10000)
 #endif
+          , active_threads_(num_threads)
           , states_(num_threads)
           , description_(description)
         {
@@ -119,15 +151,97 @@ namespace hpx { namespace threads { namespace policies
             return affinity_data_.init(data, topology);
         }
 
-        void idle_callback(std::size_t /*num_thread*/)
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        // read the idle policy from the configuration (all times are in
+        // microseconds)
+        void init_idle_backoff()
+        {
+            idle_backoff_enabled_ = get_idle_backoff_entry("enabled", 1) != 0;
+            min_idle_backoff_time_ =
+                (std::max)(get_idle_backoff_entry("min_time", 10),
+                    std::uint64_t(1));
+            max_idle_backoff_time_ =
+                (std::max)(get_idle_backoff_entry("max_time", 1000),
+                    min_idle_backoff_time_);
+            idle_park_timeout_ =
+                (std::max)(get_idle_backoff_entry("park_timeout", 10000),
+                    max_idle_backoff_time_);
+        }
+
+        // return whether the given worker is currently backing off
+        bool is_idle_backing_off(std::size_t num_thread) const
+        {
+            return idle_data_[num_thread].backoff_.load(
+                boost::memory_order_relaxed) != 0;
+        }
+
+        // the worker has found work, start over with the shortest backoff
+        void reset_idle_backoff(std::size_t num_thread)
+        {
+            idle_data_[num_thread].backoff_.store(0,
+                boost::memory_order_relaxed);
+        }
+#endif
+
+        void idle_callback(std::size_t num_thread)
         {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-            // Put this thread to sleep for some time, additionally it gets
-            // woken up on new work.
-            boost::chrono::milliseconds period(++wait_count_);
+            if (!idle_backoff_enabled_ ||
+                states_[num_thread].load() > state_running)
+            {
+                return;
+            }
+
+            // Back off exponentially while no work is available. Once the
+            // backoff exceeds its maximum the worker is parked until new work
+            // gets scheduled (or the park timeout expires, which allows for
+            // background work to be done).
+            detail::idle_backoff_data& data = idle_data_[num_thread];
+            std::uint64_t backoff =
+                data.backoff_.load(boost::memory_order_relaxed);
+            backoff = backoff == 0 ? min_idle_backoff_time_ : 2 * backoff;
+
+            bool const park = backoff > max_idle_backoff_time_;
+            if (park)
+                backoff = max_idle_backoff_time_ + 1;
+            data.backoff_.store(backoff, boost::memory_order_relaxed);
 
             boost::unique_lock<boost::mutex> l(mtx_);
-            cond_.wait_for(l, period);
+
+            // announce this worker as waiting before checking for work, this
+            // pairs with the check in do_some_work()
+            ++wait_count_;
+            if (this->get_queue_length() != 0)
+            {
+                --wait_count_;
+                data.backoff_.store(0, boost::memory_order_relaxed);
+                return;
+            }
+
+            std::uint64_t const start = util::high_resolution_clock::now();
+            if (park)
+            {
+                ++data.parks_;
+                cond_.wait_for(l,
+                    boost::chrono::microseconds(idle_park_timeout_));
+            }
+            else
+            {
+                ++data.backoffs_;
+                cond_.wait_for(l,
+                    boost::chrono::microseconds(backoff));
+            }
+            --wait_count_;
+
+            // measure the latency of being woken up by new work
+            std::uint64_t const notified =
+                last_notification_.load(boost::memory_order_relaxed);
+            if (notified > start)
+            {
+                ++data.wakeups_;
+                data.wakeup_time_ += static_cast<std::int64_t>(
+                    util::high_resolution_clock::now() - notified);
+            }
 #endif
         }
 
@@ -147,9 +261,27 @@ namespace hpx { namespace threads { namespace policies
         /// possibly idling OS threads
         void do_some_work(std::size_t num_thread)
         {
+            // work which was queued on a worker while it was being retired
+            // has to be handed over to the active workers
+            if (HPX_UNLIKELY(num_thread < states_.size() &&
+                    !is_worker_active(num_thread)) &&
+                has_queued_work(num_thread))
+            {
+                boost::lock_guard<boost::mutex> l(retire_mtx_);
+                retire_cond_.notify_all();
+            }
+
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-            wait_count_.store(0, boost::memory_order_release);
+            // the work has been queued already, make that visible before
+            // looking for waiting workers (pairs with idle_callback())
+            boost::atomic_thread_fence(boost::memory_order_seq_cst);
+            if (wait_count_.load(boost::memory_order_relaxed) == 0)
+                return;
+
+            last_notification_.store(util::high_resolution_clock::now(),
+                boost::memory_order_relaxed);
 
+            boost::lock_guard<boost::mutex> l(mtx_);
             if (num_thread == std::size_t(-1))
                 cond_.notify_all();
             else
@@ -157,6 +289,126 @@ namespace hpx { namespace threads { namespace policies
 #endif
         }
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        ///////////////////////////////////////////////////////////////////////
+        // performance counter data of the idle policy
+        std::int64_t get_idle_backoff_count(std::size_t num_thread, bool reset)
+        {
+            return accumulate_idle_data(num_thread, reset,
+                &detail::idle_backoff_data::backoffs_);
+        }
+
+        std::int64_t get_idle_park_count(std::size_t num_thread, bool reset)
+        {
+            return accumulate_idle_data(num_thread, reset,
+                &detail::idle_backoff_data::parks_);
+        }
+
+        // average latency between new work being announced and a waiting
+        // worker resuming [ns]
+        std::int64_t get_idle_wakeup_latency(std::size_t num_thread,
+            bool reset)
+        {
+            std::int64_t count = accumulate_idle_data(num_thread, reset,
+                &detail::idle_backoff_data::wakeups_);
+            std::int64_t time = accumulate_idle_data(num_thread, reset,
+                &detail::idle_backoff_data::wakeup_time_);
+            return count == 0 ? 0 : time / count;
+        }
+
+        // current backoff period of the worker(s), the park timeout is
+        // reported for parked workers [ns]
+        std::int64_t get_idle_backoff_time(std::size_t num_thread, bool reset)
+        {
+            std::size_t const begin =
+                num_thread == std::size_t(-1) ? 0 : num_thread;
+            std::size_t const end = num_thread == std::size_t(-1) ?
+                idle_data_.size() : num_thread + 1;
+
+            std::uint64_t result = 0;
+            for (std::size_t i = begin; i != end; ++i)
+            {
+                std::uint64_t backoff =
+                    idle_data_[i].backoff_.load(boost::memory_order_relaxed);
+                if (backoff > max_idle_backoff_time_)
+                    backoff = idle_park_timeout_;
+                result = (std::max)(result, backoff);
+            }
+            return static_cast<std::int64_t>(result * 1000);
+        }
+#endif
+
+        ///////////////////////////////////////////////////////////////////////
+        // Elastic worker count: only the workers [0, active_threads_) execute
+        // HPX-threads, the remaining ones are retired. Work placed on retired
+        // workers (explicitly or by resuming a thread) is put onto the queues
+        // of the active workers instead. Retired workers hand their queued
+        // work over to active workers and sleep until they are reactivated
+        // or the scheduler is stopped.
+
+        // return whether this scheduler is able to move work away from
+        // retired workers
+        virtual bool supports_retiring_workers() const
+        {
+            return false;
+        }
+
+        // move all work queued for the given (retired) worker to the queues
+        // of the active workers
+        virtual void migrate_work(std::size_t num_thread) {}
+
+        // return whether work is queued on the queues owned by the given
+        // worker
+        virtual bool has_queued_work(std::size_t num_thread) const
+        {
+            return get_queue_length(num_thread) != 0;
+        }
+
+        std::size_t get_active_thread_count() const
+        {
+            return active_threads_.load(boost::memory_order_relaxed);
+        }
+
+        void set_active_thread_count(std::size_t count)
+        {
+            HPX_ASSERT(count != 0 && count <= states_.size());
+            {
+                boost::lock_guard<boost::mutex> l(retire_mtx_);
+                active_threads_.store(count);
+                retire_cond_.notify_all();
+            }
+
+            // hand the work queued on the retired workers over to the active
+            // ones right away, and let parked workers pick it up
+            for (std::size_t i = count; i != states_.size(); ++i)
+                migrate_work(i);
+
+            do_some_work(std::size_t(-1));
+        }
+
+        bool is_worker_active(std::size_t num_thread) const
+        {
+            return num_thread <
+                active_threads_.load(boost::memory_order_relaxed);
+        }
+
+        // Called by retired workers from their scheduling loop. Work which
+        // was queued on the retired worker while it was being retired is
+        // migrated, afterwards the worker blocks until it is reactivated, the
+        // scheduler is stopped, or more of such work shows up.
+        void retire_worker(std::size_t num_thread)
+        {
+            migrate_work(num_thread);
+
+            boost::unique_lock<boost::mutex> l(retire_mtx_);
+            while (!is_worker_active(num_thread) &&
+                states_[num_thread].load() == state_running &&
+                !has_queued_work(num_thread))
+            {
+                retire_cond_.wait(l);
+            }
+        }
+
         // allow to access/manipulate states
         boost::atomic<hpx::state>& get_state(std::size_t num_thread)
         {
@@ -174,6 +426,10 @@ namespace hpx { namespace threads { namespace policies
             typedef boost::atomic<hpx::state> state_type;
             for (state_type& state : states_)
                 state.store(s);
+
+            // retired workers have to take part in the state transition
+            boost::lock_guard<boost::mutex> l(retire_mtx_);
+            retire_cond_.notify_all();
         }
 
         // return whether all states are at least at the given one
@@ -272,6 +528,23 @@ namespace hpx { namespace threads { namespace policies
             thread_state_enum initial_state, bool run_now, error_code& ec,
             std::size_t num_thread) = 0;
 
+        // Create a whole range of threads at once. Schedulers which are able
+        // to do better than creating the threads one by one should override
+        // this. If num_thread is std::size_t(-1) every thread is placed as
+        // requested by its own num_os_thread.
+        virtual void create_threads(std::vector<thread_init_data>& data,
+            thread_state_enum initial_state, error_code& ec,
+            std::size_t num_thread)
+        {
+            for (thread_init_data& d : data)
+            {
+                create_thread(d, nullptr, initial_state, true, ec,
+                    std::size_t(-1) == num_thread ? d.num_os_thread : num_thread);
+                if (ec)
+                    return;
+            }
+        }
+
         virtual bool get_next_thread(std::size_t num_thread,
             std::int64_t& idle_loop_count, threads::thread_data*& thrd) = 0;
 
@@ -306,18 +579,62 @@ namespace hpx { namespace threads { namespace policies
 
         virtual void reset_thread_distribution() {}
 
+        // number of threads which terminated after their deadline, only
+        // schedulers aware of deadlines report this
+        virtual std::int64_t get_num_deadline_misses(std::size_t num_thread,
+            bool reset)
+        {
+            return 0;
+        }
+
     protected:
         topology const& topology_;
         detail::affinity_data affinity_data_;
         boost::atomic<scheduler_mode> mode_;
 
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        std::uint64_t get_idle_backoff_entry(char const* key,
+            std::uint64_t dflt) const
+        {
+            return util::safe_lexical_cast<std::uint64_t>(
+                get_config_entry(std::string("hpx.idle_backoff.") + key,
+                    std::size_t(dflt)),
+                dflt);
+        }
+
+        std::int64_t accumulate_idle_data(std::size_t num_thread, bool reset,
+            boost::atomic<std::int64_t> detail::idle_backoff_data::* value)
+        {
+            if (num_thread != std::size_t(-1))
+            {
+                return util::get_and_reset_value(
+                    idle_data_[num_thread].*value, reset);
+            }
+
+            std::int64_t result = 0;
+            for (detail::idle_backoff_data& data : idle_data_)
+                result += util::get_and_reset_value(data.*value, reset);
+            return result;
+        }
+
         // support for suspension on idle queues
         boost::mutex mtx_;
         boost::condition_variable cond_;
-        boost::atomic<std::uint32_t> wait_count_;
+        boost::atomic<std::uint32_t> wait_count_;   // number of waiting workers
+        boost::atomic<std::uint64_t> last_notification_;
+
+        std::vector<detail::idle_backoff_data> idle_data_;
+        bool idle_backoff_enabled_;
+        std::uint64_t min_idle_backoff_time_;       // [us]
+        std::uint64_t max_idle_backoff_time_;       // [us]
+        std::uint64_t idle_park_timeout_;           // [us]
 #endif
 
+        // support for retiring workers
+        boost::mutex retire_mtx_;
+        boost::condition_variable retire_cond_;
+        boost::atomic<std::size_t> active_threads_;
+
         std::vector<boost::atomic<hpx::state> > states_;
         char const* description_;
 
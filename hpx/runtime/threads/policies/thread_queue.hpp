@@ -11,6 +11,7 @@
 #include <hpx/error_code.hpp>
 #include <hpx/runtime/threads/policies/lockfree_queue_backends.hpp>
 #include <hpx/runtime/threads/policies/queue_helpers.hpp>
+#include <hpx/runtime/threads/policies/thread_registry.hpp>
 #include <hpx/runtime/threads/thread_data.hpp>
 #include <hpx/throw_exception.hpp>
 #include <hpx/util/assert.hpp>
@@ -18,7 +19,6 @@
 #include <hpx/util/function.hpp>
 #include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/high_resolution_clock.hpp>
-#include <hpx/util/unlock_guard.hpp>
 
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
 #   include <hpx/util/tick_counter.hpp>
@@ -32,11 +32,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
-#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
-#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -97,6 +95,9 @@ namespace hpx { namespace threads { namespace policies
     //     bool pop(reference val, bool steal = true);
     //
     //     bool empty();
+    //
+    //     // called by the OS thread the queue is associated with
+    //     void on_start_thread();
     // };
     //
     // struct queue_policy
@@ -126,7 +127,10 @@ namespace hpx { namespace threads { namespace policies
         };
 
         // this is the type of a map holding all threads (except depleted ones)
-        typedef std::unordered_set<thread_id_type> thread_map_type;
+        typedef detail::thread_registry thread_map_type;
+
+        // this is the type of the lists holding unused thread objects
+        typedef detail::thread_free_list thread_heap_type;
 
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
         typedef
@@ -152,16 +156,10 @@ namespace hpx { namespace threads { namespace policies
             apply<thread_data*>::type terminated_items_type;
 
     protected:
-        template <typename Lock>
-        void create_thread_object(threads::thread_id_type& thrd,
-            threads::thread_init_data& data, thread_state_enum state, Lock& lk)
+        // return the list of recycled thread objects for the given stack size
+        thread_heap_type* get_thread_heap(std::ptrdiff_t stacksize)
         {
-            HPX_ASSERT(lk.owns_lock());
-            HPX_ASSERT(data.stacksize != 0);
-
-            std::ptrdiff_t stacksize = data.stacksize;
-
-            std::list<thread_id_type>* heap = nullptr;
+            thread_heap_type* heap = nullptr;
 
             if (stacksize == get_stack_size(thread_stacksize_small))
             {
@@ -179,6 +177,10 @@ namespace hpx { namespace threads { namespace policies
             {
                 heap = &thread_heap_huge_;
             }
+            else if (stacksize == get_stack_size(thread_stacksize_nostack))
+            {
+                heap = &thread_heap_nostack_;
+            }
             else {
                 switch(stacksize) {
                 case thread_stacksize_small:
@@ -197,26 +199,35 @@ namespace hpx { namespace threads { namespace policies
                     heap = &thread_heap_huge_;
                     break;
 
+                case thread_stacksize_nostack:
+                    heap = &thread_heap_nostack_;
+                    break;
+
                 default:
                     break;
                 }
             }
             HPX_ASSERT(heap);
+            return heap;
+        }
+
+        void create_thread_object(threads::thread_id_type& thrd,
+            threads::thread_init_data& data, thread_state_enum state)
+        {
+            HPX_ASSERT(data.stacksize >= 0);
+
+            thread_heap_type* heap = get_thread_heap(data.stacksize);
 
             // Check for an unused thread object.
-            if (!heap->empty())
+            if (heap->pop(thrd))
             {
                 // Take ownership of the thread object and rebind it.
-                thrd = heap->front();
-                heap->pop_front();
                 thrd->rebind(data,
                     state == pending_do_not_schedule ? pending : state);
             }
 
             else
             {
-                hpx::util::unlock_guard<Lock> ull(lk);
-
                 // Allocate a new thread object.
                 thrd = threads::thread_data::create(
                     data, memory_pool_,
@@ -255,21 +266,12 @@ namespace hpx { namespace threads { namespace policies
                 thread_state_enum state = util::get<1>(*task);
                 threads::thread_id_type thrd;
 
-                create_thread_object(thrd, data, state, lk);
+                create_thread_object(thrd, data, state);
 
                 delete task;
 
                 // add the new entry to the map of all threads
-                std::pair<thread_map_type::iterator, bool> p =
-                    thread_map_.insert(thrd);
-
-                if (HPX_UNLIKELY(!p.second)) {
-                    HPX_THROW_EXCEPTION(hpx::out_of_memory,
-                        "threadmanager::add_new",
-                        "Couldn't add new thread to the thread map");
-                    return 0;
-                }
-                ++thread_map_count_;
+                thread_map_.insert(thrd.get());
 
                 // only insert the thread into the work-items queue if it is in
                 // pending state
@@ -280,8 +282,6 @@ namespace hpx { namespace threads { namespace policies
                     schedule_thread(thrd.get());
                 }
 
-                // this thread has to be in the map now
-                HPX_ASSERT(thread_map_.find(thrd.get()) != thread_map_.end());
                 HPX_ASSERT(thrd->get_pool() == &memory_pool_);
             }
 
@@ -375,48 +375,7 @@ namespace hpx { namespace threads { namespace policies
 
         void recycle_thread(thread_id_type thrd)
         {
-            std::ptrdiff_t stacksize = thrd->get_stack_size();
-
-            if (stacksize == get_stack_size(thread_stacksize_small))
-            {
-                thread_heap_small_.push_front(thrd);
-            }
-            else if (stacksize == get_stack_size(thread_stacksize_medium))
-            {
-                thread_heap_medium_.push_front(thrd);
-            }
-            else if (stacksize == get_stack_size(thread_stacksize_large))
-            {
-                thread_heap_large_.push_front(thrd);
-            }
-            else if (stacksize == get_stack_size(thread_stacksize_huge))
-            {
-                thread_heap_huge_.push_front(thrd);
-            }
-            else
-            {
-                switch(stacksize) {
-                case thread_stacksize_small:
-                    thread_heap_small_.push_front(thrd);
-                    break;
-
-                case thread_stacksize_medium:
-                    thread_heap_medium_.push_front(thrd);
-                    break;
-
-                case thread_stacksize_large:
-                    thread_heap_large_.push_front(thrd);
-                    break;
-
-                case thread_stacksize_huge:
-                    thread_heap_huge_.push_front(thrd);
-                    break;
-
-                default:
-                    HPX_ASSERT(false);
-                    break;
-                }
-            }
+            get_thread_heap(thrd->get_stack_size())->push(std::move(thrd));
         }
 
     public:
@@ -435,21 +394,13 @@ namespace hpx { namespace threads { namespace policies
                 return true;
 
             if (delete_all) {
-                // delete all threads
+                // delete all threads, releasing the reference held by the
+                // map deletes the thread object
                 thread_data* todelete;
                 while (terminated_items_.pop(todelete))
                 {
                     --terminated_items_count_;
-
-                    // this thread has to be in this map
-                    HPX_ASSERT(thread_map_.find(todelete) != thread_map_.end());
-
-                    bool deleted = thread_map_.erase(todelete) != 0;
-                    HPX_ASSERT(deleted);
-                    if (deleted) {
-                        --thread_map_count_;
-                        HPX_ASSERT(thread_map_count_ >= 0);
-                    }
+                    thread_map_.erase(todelete);
                 }
             }
             else {
@@ -464,16 +415,7 @@ namespace hpx { namespace threads { namespace policies
                 {
                     --terminated_items_count_;
 
-                    thread_map_type::iterator it = thread_map_.find(todelete);
-
-                    // this thread has to be in this map
-                    HPX_ASSERT(it != thread_map_.end());
-
-                    recycle_thread(*it);
-
-                    thread_map_.erase(it);
-                    --thread_map_count_;
-                    HPX_ASSERT(thread_map_count_ >= 0);
+                    recycle_thread(thread_map_.erase(todelete));
 
                     --delete_count;
                 }
@@ -491,7 +433,7 @@ namespace hpx { namespace threads { namespace policies
         bool cleanup_terminated(bool delete_all = false)
         {
             if (terminated_items_count_ == 0)
-                return thread_map_count_ == 0;
+                return thread_map_.empty();
 
             if (delete_all) {
                 // do not lock mutex while deleting all threads, do it piece-wise
@@ -502,7 +444,7 @@ namespace hpx { namespace threads { namespace policies
                     if (cleanup_terminated_locked_helper(false))
                     {
                         thread_map_is_empty =
-                            (thread_map_count_ == 0) && (new_tasks_count_ == 0);
+                            thread_map_.empty() && (new_tasks_count_ == 0);
                         break;
                     }
                 }
@@ -511,7 +453,7 @@ namespace hpx { namespace threads { namespace policies
 
             std::lock_guard<mutex_type> lk(mtx_);
             return cleanup_terminated_locked_helper(false) &&
-                (thread_map_count_ == 0) && (new_tasks_count_ == 0);
+                thread_map_.empty() && (new_tasks_count_ == 0);
         }
 
         // The maximum number of active threads this thread manager should
@@ -523,8 +465,7 @@ namespace hpx { namespace threads { namespace policies
 
         thread_queue(std::size_t queue_num = std::size_t(-1),
                 std::size_t max_count = max_thread_count)
-          : thread_map_count_(0),
-            work_items_(128, queue_num),
+          : work_items_(128, queue_num),
             work_items_count_(0),
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
             work_items_wait_(0),
@@ -542,10 +483,12 @@ namespace hpx { namespace threads { namespace policies
             new_tasks_wait_count_(0),
 #endif
             memory_pool_(64),
+            thread_map_(),
             thread_heap_small_(),
             thread_heap_medium_(),
             thread_heap_large_(),
             thread_heap_huge_(),
+            thread_heap_nostack_(),
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
             add_new_time_(0),
             cleanup_terminated_time_(0),
@@ -585,6 +528,13 @@ namespace hpx { namespace threads { namespace policies
             return work_items_count_ + new_tasks_count_;
         }
 
+        // This returns the earliest deadline of all pending threads, only
+        // available for deadline ordered pending queues
+        std::uint64_t get_earliest_deadline() const
+        {
+            return work_items_.get_earliest_deadline();
+        }
+
         // This returns the current length of the pending queue
         std::int64_t get_pending_queue_length() const
         {
@@ -697,42 +647,22 @@ namespace hpx { namespace threads { namespace policies
             if (run_now)
             {
                 threads::thread_id_type thrd;
+                create_thread_object(thrd, data, initial_state);
 
-                // The mutex can not be locked while a new thread is getting
-                // created, as it might have that the current HPX thread gets
-                // suspended.
-                {
-                    std::unique_lock<mutex_type> lk(mtx_);
-
-                    create_thread_object(thrd, data, initial_state, lk);
-
-                    // add a new entry in the map for this thread
-                    std::pair<thread_map_type::iterator, bool> p =
-                        thread_map_.insert(thrd);
-
-                    if (HPX_UNLIKELY(!p.second)) {
-                        HPX_THROWS_IF(ec, hpx::out_of_memory,
-                            "threadmanager::register_thread",
-                            "Couldn't add new thread to the map of threads");
-                        return;
-                    }
-                    ++thread_map_count_;
-
-                    // this thread has to be in the map now
-                    HPX_ASSERT(thread_map_.find(thrd.get()) != thread_map_.end());
-                    HPX_ASSERT(thrd->get_pool() == &memory_pool_);
+                // add a new entry in the map for this thread
+                thread_map_.insert(thrd.get());
+                HPX_ASSERT(thrd->get_pool() == &memory_pool_);
 
-                    // push the new thread in the pending queue thread
-                    if (initial_state == pending)
-                        schedule_thread(thrd.get());
+                // push the new thread in the pending queue thread
+                if (initial_state == pending)
+                    schedule_thread(thrd.get());
 
-                    // return the thread_id of the newly created thread
-                    if (id) *id = std::move(thrd);
+                // return the thread_id of the newly created thread
+                if (id) *id = std::move(thrd);
 
-                    if (&ec != &throws)
-                        ec = make_success_code();
-                    return;
-                }
+                if (&ec != &throws)
+                    ec = make_success_code();
+                return;
             }
 
             // do not execute the work, but register a task description for
@@ -752,6 +682,71 @@ namespace hpx { namespace threads { namespace policies
                 ec = make_success_code();
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // create all threads described by the given range at once and
+        // schedule them if the initial state is equal to pending. All thread
+        // objects are created before any of them is published. Threads
+        // exceeding the maximum number of existing threads are staged, just
+        // like threads created with run_now == false.
+        void create_threads(std::vector<thread_init_data>& data,
+            thread_state_enum initial_state, error_code& ec)
+        {
+            std::size_t count = data.size();
+            if (HPX_LIKELY(max_count_))
+            {
+                std::size_t existing =
+                    static_cast<std::size_t>(thread_map_.size());
+                std::size_t room =
+                    max_count_ > existing ? max_count_ - existing : 0;
+                if (room < count)
+                    count = room;
+            }
+
+            // stage all threads which should not be created right away
+            for (std::size_t i = count; i != data.size(); ++i)
+            {
+                create_thread(data[i], nullptr, initial_state, false, ec);
+                if (ec)
+                    return;
+            }
+
+            if (count == 0)
+            {
+                if (&ec != &throws)
+                    ec = make_success_code();
+                return;
+            }
+
+            // releasing the references held by this vector destroys all
+            // thread objects which have not been published yet
+            std::vector<threads::thread_id_type> thrds(count);
+            for (std::size_t i = 0; i != count; ++i)
+                create_thread_object(thrds[i], data[i], initial_state);
+
+            // add all new threads to the map, on failure remove the threads
+            // which were already added again
+            std::size_t inserted = 0;
+            try {
+                for (/**/; inserted != count; ++inserted)
+                {
+                    thread_map_.insert(thrds[inserted].get());
+                    HPX_ASSERT(thrds[inserted]->get_pool() == &memory_pool_);
+                }
+            }
+            catch (...) {
+                for (std::size_t i = 0; i != inserted; ++i)
+                    thread_map_.erase(thrds[i].get());
+                throw;
+            }
+
+            // push all of them in the pending queue, if appropriate
+            if (initial_state == pending)
+                schedule_threads(thrds);
+
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+
         void move_work_items_from(thread_queue *src, std::int64_t count)
         {
             thread_description* trd;
@@ -851,6 +846,22 @@ namespace hpx { namespace threads { namespace policies
 #endif
         }
 
+        /// Schedule all passed threads, the pending queue count is updated
+        /// only once
+        void schedule_threads(std::vector<threads::thread_id_type> const& thrds)
+        {
+            work_items_count_ += static_cast<std::int64_t>(thrds.size());
+            for (threads::thread_id_type const& thrd : thrds)
+            {
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+                work_items_.push(new thread_description(
+                    thrd.get(), util::high_resolution_clock::now()));
+#else
+                work_items_.push(thrd.get());
+#endif
+            }
+        }
+
         /// Destroy the passed thread as it has been terminated
         bool destroy_thread(threads::thread_data* thrd, std::int64_t& busy_count)
         {
@@ -879,34 +890,35 @@ namespace hpx { namespace threads { namespace policies
                 return new_tasks_count_;
 
             if (unknown == state)
-                return thread_map_count_ + new_tasks_count_ - terminated_items_count_;
-
-            // acquire lock only if absolutely necessary
-            std::lock_guard<mutex_type> lk(mtx_);
+                return thread_map_.size() + new_tasks_count_ -
+                    terminated_items_count_;
 
             std::int64_t num_threads = 0;
-            thread_map_type::const_iterator end = thread_map_.end();
-            for (thread_map_type::const_iterator it = thread_map_.begin();
-                 it != end; ++it)
-            {
-                if ((*it)->get_state().state() == state)
-                    ++num_threads;
-            }
+            thread_map_.for_each(
+                [&num_threads, state](thread_data const* thrd)
+                {
+                    if (thrd->get_state().state() == state)
+                        ++num_threads;
+                });
             return num_threads;
         }
 
         ///////////////////////////////////////////////////////////////////////
         void abort_all_suspended_threads()
         {
-            std::lock_guard<mutex_type> lk(mtx_);
-            thread_map_type::iterator end =  thread_map_.end();
-            for (thread_map_type::iterator it = thread_map_.begin();
-                 it != end; ++it)
+            // don't hold any lock of the thread map while rescheduling
+            std::vector<thread_id_type> ids = thread_map_.snapshot(
+                [](thread_data const* thrd)
+                {
+                    return thrd->get_state().state() == suspended;
+                });
+
+            for (thread_id_type const& id : ids)
             {
-                if ((*it)->get_state().state() == suspended)
+                if (id->get_state().state() == suspended)
                 {
-                    (*it)->set_state(pending, wait_abort);
-                    schedule_thread((*it).get());
+                    id->set_state(pending, wait_abort);
+                    schedule_thread(id.get());
                 }
             }
         }
@@ -915,12 +927,7 @@ namespace hpx { namespace threads { namespace policies
             util::function_nonser<bool(thread_id_type)> const& f,
             thread_state_enum state = unknown) const
         {
-            std::uint64_t count = thread_map_count_;
-            if (state == terminated)
-            {
-                count = terminated_items_count_;
-            }
-            else if (state == staged)
+            if (state == staged)
             {
                 HPX_THROW_EXCEPTION(bad_parameter,
                     "thread_queue::iterate_threads",
@@ -928,30 +935,11 @@ namespace hpx { namespace threads { namespace policies
                 return false;
             }
 
-            std::vector<thread_id_type> ids;
-            ids.reserve(count);
-
-            if (state == unknown)
-            {
-                std::lock_guard<mutex_type> lk(mtx_);
-                thread_map_type::const_iterator end =  thread_map_.end();
-                for (thread_map_type::const_iterator it = thread_map_.begin();
-                     it != end; ++it)
-                {
-                    ids.push_back(*it);
-                }
-            }
-            else
-            {
-                std::lock_guard<mutex_type> lk(mtx_);
-                thread_map_type::const_iterator end =  thread_map_.end();
-                for (thread_map_type::const_iterator it = thread_map_.begin();
-                     it != end; ++it)
+            std::vector<thread_id_type> ids = thread_map_.snapshot(
+                [state](thread_data const* thrd)
                 {
-                    if ((*it)->get_state().state() == state)
-                        ids.push_back(*it);
-                }
-            }
+                    return state == unknown || thrd->get_state().state() == state;
+                });
 
             // now invoke callback function for all matching threads
             for (thread_id_type const& id : ids)
@@ -1017,8 +1005,9 @@ namespace hpx { namespace threads { namespace policies
             return false;
 #else
             if (minimal_deadlock_detection) {
-                std::lock_guard<mutex_type> lk(mtx_);
-                return detail::dump_suspended_threads(num_thread, thread_map_
+                std::vector<thread_id_type> ids = thread_map_.snapshot(
+                    [](thread_data const*) { return true; });
+                return detail::dump_suspended_threads(num_thread, ids
                   , idle_loop_count, running);
             }
             return false;
@@ -1026,18 +1015,18 @@ namespace hpx { namespace threads { namespace policies
         }
 
         ///////////////////////////////////////////////////////////////////////
-        void on_start_thread(std::size_t num_thread) {}
+        void on_start_thread(std::size_t num_thread)
+        {
+            work_items_.on_start_thread();
+            terminated_items_.on_start_thread();
+            new_tasks_.on_start_thread();
+        }
         void on_stop_thread(std::size_t num_thread) {}
         void on_error(std::size_t num_thread, boost::exception_ptr const& e) {}
 
     private:
         mutable mutex_type mtx_;                    ///< mutex protecting the members
 
-        thread_map_type thread_map_;
-        ///< mapping of thread id's to HPX-threads
-        boost::atomic<std::int64_t> thread_map_count_;
-        ///< overall count of work items
-
         work_items_type work_items_;
         ///< list of active work items
         boost::atomic<std::int64_t> work_items_count_;
@@ -1070,10 +1059,15 @@ namespace hpx { namespace threads { namespace policies
         threads::thread_pool memory_pool_;          ///< OS thread local memory pools for
                                                     ///< HPX-threads
 
-        std::list<thread_id_type> thread_heap_small_;
-        std::list<thread_id_type> thread_heap_medium_;
-        std::list<thread_id_type> thread_heap_large_;
-        std::list<thread_id_type> thread_heap_huge_;
+        thread_map_type thread_map_;
+        ///< registry of all HPX-threads owned by this queue
+
+        thread_heap_type thread_heap_small_;
+        thread_heap_type thread_heap_medium_;
+        thread_heap_type thread_heap_large_;
+        thread_heap_type thread_heap_huge_;
+        thread_heap_type thread_heap_nostack_;
+        ///< lists of unused thread objects
 
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
         std::uint64_t add_new_time_;
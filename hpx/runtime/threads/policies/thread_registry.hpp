@@ -0,0 +1,237 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_THREADMANAGER_POLICIES_THREAD_REGISTRY_OCT_17_2016_1034AM)
+#define HPX_THREADMANAGER_POLICIES_THREAD_REGISTRY_OCT_17_2016_1034AM
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/threads/thread_data.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/spinlock.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/lockfree/detail/prefix.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // LIFO of recycled thread objects protected by a spinlock. The list is
+    // linked through the intrusive hook of the thread objects (which is unused
+    // while a thread object is not registered), pushing and popping never
+    // allocates. Every thread object in the list is referenced by it.
+    class thread_free_list
+    {
+    private:
+        HPX_NON_COPYABLE(thread_free_list);
+
+        typedef hpx::util::spinlock mutex_type;
+
+    public:
+        thread_free_list()
+          : head_(nullptr), count_(0)
+        {}
+
+        ~thread_free_list()
+        {
+            thread_id_type thrd;
+            while (pop(thrd))
+                thrd.reset();
+        }
+
+        void push(thread_id_type thrd)
+        {
+            thread_data* p = thrd.detach();
+            HPX_ASSERT(p != nullptr);
+
+            std::lock_guard<mutex_type> lk(mtx_);
+            p->next_hook() = head_;
+            head_ = p;
+            ++count_;
+        }
+
+        bool pop(thread_id_type& thrd)
+        {
+            // avoid taking the lock if there is nothing to pop
+            if (count_.load(boost::memory_order_relaxed) == 0)
+                return false;
+
+            thread_data* p = nullptr;
+            {
+                std::lock_guard<mutex_type> lk(mtx_);
+                p = head_;
+                if (p == nullptr)
+                    return false;
+
+                head_ = p->next_hook();
+                --count_;
+            }
+
+            p->next_hook() = nullptr;
+            thrd = thread_id_type(p, false);    // adopt the reference
+            return true;
+        }
+
+        bool empty() const
+        {
+            return count_.load(boost::memory_order_relaxed) == 0;
+        }
+
+    private:
+        mutable mutex_type mtx_;
+        thread_data* head_;
+        boost::atomic<std::size_t> count_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Registry of all threads owned by a thread queue. The threads are kept in
+    // intrusive doubly linked lists which are sharded based on the address of
+    // the thread objects, each shard being protected by its own spinlock.
+    // Every registered thread object is referenced by the registry.
+    class thread_registry
+    {
+    private:
+        HPX_NON_COPYABLE(thread_registry);
+
+        typedef hpx::util::spinlock mutex_type;
+
+        enum { num_shards = 16 };
+
+        struct shard
+        {
+            shard()
+              : head_(nullptr)
+            {}
+
+            mutable mutex_type mtx_;
+            thread_data* head_;
+
+            // avoid false sharing between shards
+            char padding_[BOOST_LOCKFREE_CACHELINE_BYTES -
+                sizeof(mutex_type) - sizeof(thread_data*)];
+        };
+
+        shard& get_shard(thread_data const* thrd)
+        {
+            return shards_[
+                (reinterpret_cast<std::size_t>(thrd) >> 6) % num_shards];
+        }
+
+    public:
+        thread_registry()
+          : count_(0)
+        {}
+
+        ~thread_registry()
+        {
+            for (shard& s : shards_)
+            {
+                while (s.head_ != nullptr)
+                    erase(s.head_);
+            }
+        }
+
+        void insert(thread_data* thrd)
+        {
+            intrusive_ptr_add_ref(thrd);
+
+            shard& s = get_shard(thrd);
+            {
+                std::lock_guard<mutex_type> lk(s.mtx_);
+
+                thrd->prev_hook() = nullptr;
+                thrd->next_hook() = s.head_;
+                if (s.head_ != nullptr)
+                    s.head_->prev_hook() = thrd;
+                s.head_ = thrd;
+            }
+            ++count_;
+        }
+
+        // remove the given thread from the registry, the returned id holds
+        // the reference previously owned by the registry
+        thread_id_type erase(thread_data* thrd)
+        {
+            shard& s = get_shard(thrd);
+            {
+                std::lock_guard<mutex_type> lk(s.mtx_);
+
+                thread_data* prev = thrd->prev_hook();
+                thread_data* next = thrd->next_hook();
+
+                if (prev != nullptr)
+                    prev->next_hook() = next;
+                else
+                {
+                    HPX_ASSERT(s.head_ == thrd);
+                    s.head_ = next;
+                }
+
+                if (next != nullptr)
+                    next->prev_hook() = prev;
+
+                thrd->prev_hook() = nullptr;
+                thrd->next_hook() = nullptr;
+            }
+            --count_;
+
+            return thread_id_type(thrd, false);
+        }
+
+        std::int64_t size() const
+        {
+            return count_.load(boost::memory_order_relaxed);
+        }
+
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        // Invoke the given function for all registered threads. The shard
+        // currently being traversed is locked while the function executes,
+        // so the function must not block or touch the registry.
+        template <typename F>
+        void for_each(F && f) const
+        {
+            for (shard const& s : shards_)
+            {
+                std::lock_guard<mutex_type> lk(s.mtx_);
+                for (thread_data* thrd = s.head_; thrd != nullptr;
+                     thrd = thrd->next_hook())
+                {
+                    f(thrd);
+                }
+            }
+        }
+
+        // Return references to all registered threads (matching the given
+        // predicate), no lock is held while the caller operates on them.
+        template <typename Pred>
+        std::vector<thread_id_type> snapshot(Pred && pred) const
+        {
+            std::vector<thread_id_type> ids;
+            ids.reserve(static_cast<std::size_t>((std::max)(size(),
+                std::int64_t(0))));
+            for_each(
+                [&ids, &pred](thread_data* thrd)
+                {
+                    if (pred(thrd))
+                        ids.push_back(thread_id_type(thrd));
+                });
+            return ids;
+        }
+
+    private:
+        shard shards_[num_shards];
+        boost::atomic<std::int64_t> count_;
+    };
+}}}}
+
+#endif
@@ -20,17 +20,22 @@
 #include <hpx/util/assert.hpp>
 #include <hpx/util/atomic_count.hpp>
 #include <hpx/util/backtrace.hpp>
+#include <hpx/util/cache_aligned_allocator.hpp>
 #include <hpx/util/function.hpp>
 #include <hpx/util/lockfree/freelist.hpp>
 #include <hpx/util/logging.hpp>
 #include <hpx/util/spinlock_pool.hpp>
 #include <hpx/util/thread_description.hpp>
+#include <hpx/util/unused.hpp>
 
 #include <boost/atomic.hpp>
 #include <boost/intrusive_ptr.hpp>
+#include <boost/lockfree/detail/prefix.hpp>
 
 #include <cstddef>
 #include <cstdint>
+#include <forward_list>
+#include <memory>
 #include <stack>
 #include <string>
 #include <utility>
@@ -60,6 +65,42 @@ namespace hpx { namespace threads
                 f_();
             }
         };
+
+#if defined(HPX_HAVE_THREAD_TARGET_ADDRESS) ||                                \
+    defined(HPX_HAVE_THREAD_DESCRIPTION) ||                                   \
+    defined(HPX_HAVE_THREAD_PARENT_REFERENCE) ||                              \
+    defined(HPX_HAVE_THREAD_BACKTRACE_ON_SUSPENSION)
+#define HPX_THREAD_DATA_HAVE_COLD_DATA
+        ///////////////////////////////////////////////////////////////////////
+        // Debugging/logging information of a thread which is not needed for
+        // scheduling. It is allocated on first use and kept while the thread
+        // object is recycled.
+        struct thread_data_cold
+        {
+#ifdef HPX_HAVE_THREAD_TARGET_ADDRESS
+            naming::address_type component_id_ = 0;
+#endif
+
+#ifdef HPX_HAVE_THREAD_DESCRIPTION
+            util::thread_description description_;
+            util::thread_description lco_description_;
+#endif
+
+#ifdef HPX_HAVE_THREAD_PARENT_REFERENCE
+            std::uint32_t parent_locality_id_ = 0;
+            thread_id_repr_type parent_thread_id_ = nullptr;
+            std::size_t parent_thread_phase_ = 0;
+#endif
+
+#ifdef HPX_HAVE_THREAD_BACKTRACE_ON_SUSPENSION
+# ifdef HPX_HAVE_THREAD_FULLBACKTRACE_ON_SUSPENSION
+            char const* backtrace_ = nullptr;
+# else
+            util::backtrace const* backtrace_ = nullptr;
+# endif
+#endif
+        };
+#endif
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -79,7 +120,10 @@ namespace hpx { namespace threads
     /// Generally, \a threads are not created or executed directly. All
     /// functionality related to the management of \a thread's is
     /// implemented by the thread-manager.
-    class thread_data
+    ///
+    /// Thread objects are aligned to cache lines, the state needed for
+    /// scheduling a thread is kept in the first cache line of the object.
+    class alignas(BOOST_LOCKFREE_CACHELINE_BYTES) thread_data
     {
         HPX_MOVABLE_ONLY(thread_data);
 
@@ -92,7 +136,9 @@ namespace hpx { namespace threads
         struct tag {};
         typedef util::spinlock_pool<tag> mutex_type;
 
-        typedef boost::lockfree::caching_freelist<thread_data> pool_type;
+        typedef boost::lockfree::caching_freelist<
+                thread_data, util::cache_aligned_allocator<thread_data>
+            > pool_type;
 
         static boost::intrusive_ptr<thread_data> create(
             thread_init_data& init_data, pool_type& pool,
@@ -270,7 +316,8 @@ namespace hpx { namespace threads
 #ifndef HPX_HAVE_THREAD_TARGET_ADDRESS
             return 0;
 #else
-            return component_id_;
+            mutex_type::scoped_lock l(this);
+            return cold_ ? cold_->component_id_ : 0;
 #endif
         }
 
@@ -296,25 +343,25 @@ namespace hpx { namespace threads
         util::thread_description get_description() const
         {
             mutex_type::scoped_lock l(this);
-            return description_;
+            return cold_ ? cold_->description_ : util::thread_description();
         }
         util::thread_description set_description(util::thread_description value)
         {
             mutex_type::scoped_lock l(this);
-            std::swap(description_, value);
+            std::swap(get_cold_data().description_, value);
             return value;
         }
 
         util::thread_description get_lco_description() const
         {
             mutex_type::scoped_lock l(this);
-            return lco_description_;
+            return cold_ ? cold_->lco_description_ : util::thread_description();
         }
         util::thread_description set_lco_description(
             util::thread_description value)
         {
             mutex_type::scoped_lock l(this);
-            std::swap(lco_description_, value);
+            std::swap(get_cold_data().lco_description_, value);
             return value;
         }
 #endif
@@ -341,19 +388,22 @@ namespace hpx { namespace threads
         /// Return the locality of the parent thread
         std::uint32_t get_parent_locality_id() const
         {
-            return parent_locality_id_;
+            mutex_type::scoped_lock l(this);
+            return cold_ ? cold_->parent_locality_id_ : 0;
         }
 
         /// Return the thread id of the parent thread
         thread_id_repr_type get_parent_thread_id() const
         {
-            return parent_thread_id_;
+            mutex_type::scoped_lock l(this);
+            return cold_ ? cold_->parent_thread_id_ : nullptr;
         }
 
         /// Return the phase of the parent thread
         std::size_t get_parent_thread_phase() const
         {
-            return parent_thread_phase_;
+            mutex_type::scoped_lock l(this);
+            return cold_ ? cold_->parent_thread_phase_ : 0;
         }
 #endif
 
@@ -396,28 +446,28 @@ namespace hpx { namespace threads
         char const* get_backtrace() const
         {
             mutex_type::scoped_lock l(this);
-            return backtrace_;
+            return cold_ ? cold_->backtrace_ : nullptr;
         }
         char const* set_backtrace(char const* value)
         {
             mutex_type::scoped_lock l(this);
 
-            char const* bt = backtrace_;
-            backtrace_ = value;
+            char const* bt = get_cold_data().backtrace_;
+            cold_->backtrace_ = value;
             return bt;
         }
 # else
         util::backtrace const* get_backtrace() const
         {
             mutex_type::scoped_lock l(this);
-            return backtrace_;
+            return cold_ ? cold_->backtrace_ : nullptr;
         }
         util::backtrace const* set_backtrace(util::backtrace const* value)
         {
             mutex_type::scoped_lock l(this);
 
-            util::backtrace const* bt = backtrace_;
-            backtrace_ = value;
+            util::backtrace const* bt = get_cold_data().backtrace_;
+            cold_->backtrace_ = value;
             return bt;
         }
 # endif
@@ -427,12 +477,12 @@ namespace hpx { namespace threads
         {
             mutex_type::scoped_lock l(this);
             std::string bt;
-            if (0 != backtrace_)
+            if (cold_ && 0 != cold_->backtrace_)
             {
 # ifdef HPX_HAVE_THREAD_FULLBACKTRACE_ON_SUSPENSION
-                bt = *backtrace_;
+                bt = *cold_->backtrace_;
 #else
-                bt = backtrace_->trace();
+                bt = cold_->backtrace_->trace();
 #endif
             }
             return bt;
@@ -448,6 +498,17 @@ namespace hpx { namespace threads
             priority_ = priority;
         }
 
+        // the absolute deadline of this thread (see thread_init_data), zero
+        // if none was given
+        std::uint64_t get_deadline() const
+        {
+            return deadline_;
+        }
+        void set_deadline(std::uint64_t deadline)
+        {
+            deadline_ = deadline;
+        }
+
         // handle thread interruption
         bool interruption_requested() const
         {
@@ -554,13 +615,19 @@ namespace hpx { namespace threads
 
             coroutine_.rebind(std::move(init_data.func), this_());
 
-            HPX_ASSERT(init_data.stacksize != 0);
+            HPX_ASSERT(init_data.stacksize >= 0);
             HPX_ASSERT(coroutine_.is_ready());
         }
 
         /// This function will be called when the thread is about to be deleted
         //virtual void reset() {}
 
+        /// Intrusive hooks used by the thread queues to keep track of live
+        /// and recycled thread objects without allocating any memory. A
+        /// thread object is linked into at most one such list at a time.
+        thread_data*& prev_hook() { return prev_hook_; }
+        thread_data*& next_hook() { return next_hook_; }
+
         friend HPX_EXPORT void intrusive_ptr_add_ref(thread_data* p);
         friend HPX_EXPORT void intrusive_ptr_release(thread_data* p);
 
@@ -569,53 +636,29 @@ namespace hpx { namespace threads
         thread_data(thread_init_data& init_data,
                 pool_type& pool, thread_state_enum newstate)
           : current_state_(thread_state(newstate, wait_signaled)),
-#ifdef HPX_HAVE_THREAD_TARGET_ADDRESS
-            component_id_(init_data.lva),
-#endif
-#ifdef HPX_HAVE_THREAD_DESCRIPTION
-            description_(init_data.description),
-            lco_description_(),
-#endif
-#ifdef HPX_HAVE_THREAD_PARENT_REFERENCE
-            parent_locality_id_(init_data.parent_locality_id),
-            parent_thread_id_(init_data.parent_id),
-            parent_thread_phase_(init_data.parent_phase),
-#endif
-#ifdef HPX_HAVE_THREAD_MINIMAL_DEADLOCK_DETECTION
-            marked_state_(unknown),
-#endif
-#ifdef HPX_HAVE_THREAD_BACKTRACE_ON_SUSPENSION
-            backtrace_(nullptr),
-#endif
+            count_(0),
+            coroutine_(std::move(init_data.func),
+                this_(), init_data.stacksize),
             priority_(init_data.priority),
             requested_interrupt_(false),
             enabled_interrupt_(true),
             ran_exit_funcs_(false),
-            scheduler_base_(init_data.scheduler_base),
-            count_(0),
             stacksize_(init_data.stacksize),
-            coroutine_(std::move(init_data.func),
-                this_(), init_data.stacksize),
-            pool_(&pool)
+            pool_(&pool),
+            scheduler_base_(init_data.scheduler_base),
+            deadline_(init_data.deadline),
+            prev_hook_(nullptr),
+            next_hook_(nullptr)
+#ifdef HPX_HAVE_THREAD_MINIMAL_DEADLOCK_DETECTION
+          , marked_state_(unknown)
+#endif
         {
+            init_cold_data(init_data);
+
             LTM_(debug) << "thread::thread(" << this << "), description("
                         << get_description() << ")";
 
-#ifdef HPX_HAVE_THREAD_PARENT_REFERENCE
-            // store the thread id of the parent thread, mainly for debugging
-            // purposes
-            if (nullptr == parent_thread_id_) {
-                thread_self* self = get_self_ptr();
-                if (self)
-                {
-                    parent_thread_id_ = threads::get_self_id().get();
-                    parent_thread_phase_ = self->get_thread_phase();
-                }
-            }
-            if (0 == parent_locality_id_)
-                parent_locality_id_ = get_locality_id();
-#endif
-            HPX_ASSERT(init_data.stacksize != 0);
+            HPX_ASSERT(init_data.stacksize >= 0);
             HPX_ASSERT(coroutine_.is_ready());
         }
 
@@ -625,25 +668,11 @@ namespace hpx { namespace threads
 
             current_state_.store(thread_state(newstate, wait_signaled));
 
-#ifdef HPX_HAVE_THREAD_TARGET_ADDRESS
-            component_id_ = init_data.lva;
-#endif
-#ifdef HPX_HAVE_THREAD_DESCRIPTION
-            description_ = (init_data.description);
-            lco_description_ = util::thread_description();
-#endif
-#ifdef HPX_HAVE_THREAD_PARENT_REFERENCE
-            parent_locality_id_ = init_data.parent_locality_id;
-            parent_thread_id_ = init_data.parent_id;
-            parent_thread_phase_ = init_data.parent_phase;
-#endif
 #ifdef HPX_HAVE_THREAD_MINIMAL_DEADLOCK_DETECTION
             set_marked_state(unknown);
-#endif
-#ifdef HPX_HAVE_THREAD_BACKTRACE_ON_SUSPENSION
-            backtrace_ = nullptr;
 #endif
             priority_ = init_data.priority;
+            deadline_ = init_data.deadline;
             requested_interrupt_ = false;
             enabled_interrupt_ = true;
             ran_exit_funcs_ = false;
@@ -652,77 +681,99 @@ namespace hpx { namespace threads
 
             HPX_ASSERT(init_data.stacksize == get_stack_size());
 
+            init_cold_data(init_data);
+
             LTM_(debug) << "thread::thread(" << this << "), description("
                         << get_description() << "), rebind";
+        }
+
+        // (re-)initialize the debugging/logging information, the cold data
+        // block is allocated only if there is anything to store
+        void init_cold_data(thread_init_data& init_data)
+        {
+#ifdef HPX_THREAD_DATA_HAVE_COLD_DATA
+            if (cold_)
+                *cold_ = detail::thread_data_cold();
 
+#ifdef HPX_HAVE_THREAD_TARGET_ADDRESS
+            if (init_data.lva != 0)
+                get_cold_data().component_id_ = init_data.lva;
+#endif
+#ifdef HPX_HAVE_THREAD_DESCRIPTION
+            if (init_data.description)
+                get_cold_data().description_ = init_data.description;
+#endif
 #ifdef HPX_HAVE_THREAD_PARENT_REFERENCE
             // store the thread id of the parent thread, mainly for debugging
             // purposes
-            if (nullptr == parent_thread_id_) {
+            detail::thread_data_cold& cold = get_cold_data();
+            cold.parent_locality_id_ = init_data.parent_locality_id;
+            cold.parent_thread_id_ = init_data.parent_id;
+            cold.parent_thread_phase_ = init_data.parent_phase;
+
+            if (nullptr == cold.parent_thread_id_) {
                 thread_self* self = get_self_ptr();
                 if (self)
                 {
-                    parent_thread_id_ = threads::get_self_id().get();
-                    parent_thread_phase_ = self->get_thread_phase();
+                    cold.parent_thread_id_ = threads::get_self_id().get();
+                    cold.parent_thread_phase_ = self->get_thread_phase();
                 }
             }
-            if (0 == parent_locality_id_)
-                parent_locality_id_ = get_locality_id();
+            if (0 == cold.parent_locality_id_)
+                cold.parent_locality_id_ = get_locality_id();
 #endif
-        }
-
-        mutable boost::atomic<thread_state> current_state_;
-
-        ///////////////////////////////////////////////////////////////////////
-        // Debugging/logging information
-#ifdef HPX_HAVE_THREAD_TARGET_ADDRESS
-        naming::address_type component_id_;
+#else
+            HPX_UNUSED(init_data);
 #endif
+        }
 
-#ifdef HPX_HAVE_THREAD_DESCRIPTION
-        util::thread_description description_;
-        util::thread_description lco_description_;
+#ifdef HPX_THREAD_DATA_HAVE_COLD_DATA
+        detail::thread_data_cold& get_cold_data()
+        {
+            if (!cold_)
+                cold_.reset(new detail::thread_data_cold());
+            return *cold_;
+        }
 #endif
 
-#ifdef HPX_HAVE_THREAD_PARENT_REFERENCE
-        std::uint32_t parent_locality_id_;
-        thread_id_repr_type parent_thread_id_;
-        std::size_t parent_thread_phase_;
-#endif
+        ///////////////////////////////////////////////////////////////////////
+        // State accessed whenever the thread is scheduled, this fits into the
+        // first cache line of the thread object
+        mutable boost::atomic<thread_state> current_state_;
 
-#ifdef HPX_HAVE_THREAD_MINIMAL_DEADLOCK_DETECTION
-        mutable thread_state_enum marked_state_;
-#endif
+        //reference count
+        util::atomic_count count_;
 
-#ifdef HPX_HAVE_THREAD_BACKTRACE_ON_SUSPENSION
-# ifdef HPX_HAVE_THREAD_FULLBACKTRACE_ON_SUSPENSION
-        char const* backtrace_;
-# else
-        util::backtrace const* backtrace_;
-# endif
-#endif
+        coroutine_type coroutine_;
 
-        ///////////////////////////////////////////////////////////////////////
         thread_priority priority_;
-
         bool requested_interrupt_;
         bool enabled_interrupt_;
         bool ran_exit_funcs_;
 
-        // Singly linked list (heap-allocated)
-        // FIXME: replace with forward_list eventually.
-        std::deque<util::function_nonser<void()> > exit_funcs_;
+        std::ptrdiff_t stacksize_;
+        pool_type* pool_;
 
         // reference to scheduler which created/manages this thread
         policies::scheduler_base* scheduler_base_;
 
-        //reference count
-        util::atomic_count count_;
+        std::uint64_t deadline_;
 
-        std::ptrdiff_t stacksize_;
+        ///////////////////////////////////////////////////////////////////////
+        thread_data* prev_hook_;
+        thread_data* next_hook_;
 
-        coroutine_type coroutine_;
-        pool_type* pool_;
+        // Singly linked list of exit functions, executed in reverse order
+        // of their registration
+        std::forward_list<util::function_nonser<void()> > exit_funcs_;
+
+#ifdef HPX_HAVE_THREAD_MINIMAL_DEADLOCK_DETECTION
+        mutable thread_state_enum marked_state_;
+#endif
+
+#ifdef HPX_THREAD_DATA_HAVE_COLD_DATA
+        std::unique_ptr<detail::thread_data_cold> cold_;
+#endif
     };
 
     typedef thread_data::pool_type thread_pool;
@@ -21,6 +21,7 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace threads
@@ -661,6 +662,13 @@ namespace hpx { namespace this_thread
 // FIXME: the API function below belong into the namespace hpx::threads
 namespace hpx { namespace applier
 {
+    namespace detail
+    {
+        // The thread function of all threads created from nullary functions
+        HPX_API_EXPORT threads::thread_result_type thread_function_nullary(
+            util::unique_function_nonser<void()> func);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Create a new \a thread using the given function as the work to
     ///        be executed.
@@ -776,6 +784,31 @@ namespace hpx { namespace applier
         threads::thread_stacksize stacksize = threads::thread_stacksize_default,
         error_code& ec = throws);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Create a new \a thread for each of the given functions. All
+    ///        threads are created and handed to the scheduler using a single
+    ///        operation, which avoids the per-thread overheads of calling
+    ///        \a threads#register_thread_nullary repeatedly.
+    ///
+    /// \param funcs      [in] The functions to be executed as the
+    ///                   thread-functions. These functions have to expose the
+    ///                   minimal low level HPX-thread interface, i.e. they
+    ///                   take no arguments. Each thread will be terminated
+    ///                   after its function returns.
+    ///
+    /// \note All other arguments are equivalent to those of the function
+    ///       \a threads#register_thread_plain, they apply to all created
+    ///       threads.
+    ///
+    HPX_API_EXPORT void register_thread_nullary_bulk(
+        std::vector<util::unique_function_nonser<void()> > && funcs,
+        util::thread_description const& description = util::thread_description(),
+        threads::thread_state_enum initial_state = threads::pending,
+        threads::thread_priority priority = threads::thread_priority_normal,
+        std::size_t os_thread = std::size_t(-1),
+        threads::thread_stacksize stacksize = threads::thread_stacksize_default,
+        error_code& ec = throws);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Create a new \a thread using the given data.
     ///
@@ -913,6 +946,7 @@ namespace hpx { namespace threads
     using applier::register_thread_plain;
     using applier::register_thread;
     using applier::register_thread_nullary;
+    using applier::register_thread_nullary_bulk;
 
     using applier::register_work_plain;
     using applier::register_work;
@@ -43,7 +43,8 @@ namespace hpx { namespace threads
             priority(thread_priority_normal),
             num_os_thread(std::size_t(-1)),
             stacksize(get_default_stack_size()),
-            scheduler_base(nullptr)
+            scheduler_base(nullptr),
+            deadline(0)
         {}
 
         thread_init_data(thread_init_data&& rhs)
@@ -61,7 +62,8 @@ namespace hpx { namespace threads
             priority(rhs.priority),
             num_os_thread(rhs.num_os_thread),
             stacksize(rhs.stacksize),
-            scheduler_base(rhs.scheduler_base)
+            scheduler_base(rhs.scheduler_base),
+            deadline(rhs.deadline)
         {}
 
         template <typename F>
@@ -70,7 +72,8 @@ namespace hpx { namespace threads
                 thread_priority priority_ = thread_priority_normal,
                 std::size_t os_thread = std::size_t(-1),
                 std::ptrdiff_t stacksize_ = std::ptrdiff_t(-1),
-                policies::scheduler_base* scheduler_base_ = nullptr)
+                policies::scheduler_base* scheduler_base_ = nullptr,
+                std::uint64_t deadline_ = 0)
           : func(std::forward<F>(f)),
 #if defined(HPX_HAVE_THREAD_TARGET_ADDRESS)
             lva(lva_),
@@ -84,7 +87,8 @@ namespace hpx { namespace threads
             priority(priority_), num_os_thread(os_thread),
             stacksize(stacksize_ == std::ptrdiff_t(-1) ?
                 get_default_stack_size() : stacksize_),
-            scheduler_base(scheduler_base_)
+            scheduler_base(scheduler_base_),
+            deadline(deadline_)
         {}
 
         threads::thread_function_type func;
@@ -106,6 +110,10 @@ namespace hpx { namespace threads
         std::ptrdiff_t stacksize;
 
         policies::scheduler_base* scheduler_base;
+
+        // absolute deadline of the new thread in nanoseconds as returned by
+        // util::high_resolution_clock::now(), zero if the thread has none
+        std::uint64_t deadline;
     };
 }}
 
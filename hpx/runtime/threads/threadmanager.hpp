@@ -24,6 +24,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
 #include <hpx/config/warnings_prefix.hpp>
 
@@ -140,6 +141,27 @@ namespace hpx { namespace threads
             thread_state_enum initial_state = pending,
             bool run_now = true, error_code& ec = throws) = 0;
 
+        /// The function \a register_thread_bulk adds a whole range of new
+        /// work items to the thread manager at once. It creates a new \a
+        /// thread for each of the given elements, adds all of them to the
+        /// internal management data structures using a single operation, and
+        /// schedules the new threads, if appropriate.
+        ///
+        /// \param data   [in] The descriptions of the threads to create. All
+        ///               threads are placed with the OS-thread requested by
+        ///               the first element.
+        /// \param initial_state
+        ///               [in] The value of this parameter defines the initial
+        ///               state of the newly created threads. This must be
+        ///               one of the values as defined by the \a thread_state
+        ///               enumeration (thread_state#pending, or \a
+        ///               thread_state#suspended, any other value will throw a
+        ///               hpx#bad_parameter exception).
+        virtual void
+        register_thread_bulk(std::vector<thread_init_data>& data,
+            thread_state_enum initial_state = pending,
+            error_code& ec = throws) = 0;
+
         /// \brief  Run the thread manager's work queue. This function
         ///         instantiates the specified number of OS threads. All OS
         ///         threads are started to execute the function \a tfunc.
@@ -214,6 +236,19 @@ namespace hpx { namespace threads
         virtual void reset_thread_distribution() = 0;
 
         virtual void set_scheduler_mode(threads::policies::scheduler_mode m) = 0;
+
+        /// Return the number of OS threads currently executing HPX-threads
+        virtual std::size_t get_active_os_thread_count() const = 0;
+
+        /// Change the number of OS threads executing HPX-threads. The OS
+        /// threads which are not active anymore hand their queued work over
+        /// to the active ones and go to sleep until they are reactivated.
+        virtual void set_active_os_thread_count(std::size_t count,
+            error_code& ec = throws) = 0;
+
+        /// Start adapting the number of active OS threads to the load of the
+        /// system as configured in the section [hpx.elasticity].
+        virtual void start_elasticity_policy() = 0;
     };
 }}
 
@@ -18,6 +18,7 @@
 #include <hpx/runtime/threads/threadmanager.hpp>
 #include <hpx/state.hpp>
 #include <hpx/util/block_profiler.hpp>
+#include <hpx/util/interval_timer.hpp>
 #include <hpx/util/io_service_pool.hpp>
 #include <hpx/util/spinlock.hpp>
 
@@ -123,6 +124,26 @@ namespace hpx { namespace threads
             thread_state_enum initial_state = pending,
             bool run_now = true, error_code& ec = throws);
 
+        /// The function \a register_thread_bulk adds a whole range of new
+        /// work items to the thread manager at once. It creates a new \a
+        /// thread for each of the given elements, adds all of them to the
+        /// internal management data structures using a single operation, and
+        /// schedules the new threads, if appropriate.
+        ///
+        /// \param data   [in] The descriptions of the threads to create. All
+        ///               threads are placed with the OS-thread requested by
+        ///               the first element.
+        /// \param initial_state
+        ///               [in] The value of this parameter defines the initial
+        ///               state of the newly created threads. This must be
+        ///               one of the values as defined by the \a thread_state
+        ///               enumeration (thread_state#pending, or \a
+        ///               thread_state#suspended, any other value will throw a
+        ///               hpx#bad_parameter exception).
+        void register_thread_bulk(std::vector<thread_init_data>& data,
+            thread_state_enum initial_state = pending,
+            error_code& ec = throws);
+
         /// \brief  Run the thread manager's work queue. This function
         ///         instantiates the specified number of OS threads. All OS
         ///         threads are started to execute the function \a tfunc.
@@ -188,6 +209,21 @@ namespace hpx { namespace threads
             return pool_.get_os_thread_handle(num_thread);
         }
 
+        /// \brief Return the number of OS threads currently executing
+        ///        HPX-threads
+        std::size_t get_active_os_thread_count() const
+        {
+            return pool_.get_active_os_thread_count();
+        }
+
+        /// \brief Change the number of OS threads executing HPX-threads
+        void set_active_os_thread_count(std::size_t count,
+            error_code& ec = throws);
+
+        /// \brief Start adapting the number of active OS threads to the
+        ///        measured idle-rate
+        void start_elasticity_policy();
+
 #ifdef HPX_HAVE_THREAD_IDLE_RATES
         /// Get percent maintenance time in main thread-manager loop.
         std::int64_t avg_idle_rate(bool reset);
@@ -313,6 +349,10 @@ namespace hpx { namespace threads
             performance_counters::counter_info const& info, error_code& ec);
 #endif
 
+#ifdef HPX_HAVE_THREAD_IDLE_RATES
+        bool adapt_active_os_thread_count();
+#endif
+
     private:
         mutable mutex_type mtx_;   // mutex protecting the members
 
@@ -325,6 +365,14 @@ namespace hpx { namespace threads
 
         detail::thread_pool<scheduling_policy_type> pool_;
         notification_policy_type& notifier_;
+
+#ifdef HPX_HAVE_THREAD_IDLE_RATES
+        // elasticity policy, idle-rates are given in 0.01%
+        std::unique_ptr<util::interval_timer> elasticity_timer_;
+        std::size_t elasticity_min_threads_;
+        std::int64_t elasticity_shrink_idle_rate_;
+        std::int64_t elasticity_grow_idle_rate_;
+#endif
     };
 }}
 
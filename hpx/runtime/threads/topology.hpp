@@ -109,6 +109,16 @@ namespace hpx { namespace threads
         virtual mask_cref_type get_core_affinity_mask(std::size_t num_thread,
             bool numa_sensitive, error_code& ec = throws) const = 0;
 
+        /// \brief Return a bit mask where each set bit corresponds to a
+        ///        processing unit sharing the outermost cache below the
+        ///        socket level with the given thread.
+        ///
+        /// \param ec         [in,out] this represents the error status on exit,
+        ///                   if this is pre-initialized to \a hpx#throws
+        ///                   the function will throw on error instead.
+        virtual mask_cref_type get_cache_affinity_mask(std::size_t num_thread,
+            bool numa_sensitive, error_code& ec = throws) const = 0;
+
         /// \brief Return a bit mask where each set bit corresponds to a
         ///        processing unit available to the given thread.
         ///
@@ -204,6 +214,14 @@ namespace hpx { namespace threads
 
         /// Free memory that was previously allocated by allocate
         virtual void deallocate(void* addr, std::size_t len) const = 0;
+
+        /// \brief Bind the given memory area to the given NUMA domain.
+        ///
+        /// Pages of the area which were not touched yet will be allocated
+        /// on the given NUMA domain. Returns whether the binding was
+        /// successfully applied.
+        virtual bool set_area_membind_nodeset(void const* addr,
+            std::size_t len, std::size_t numa_node) const = 0;
     };
 
     HPX_API_EXPORT std::size_t hardware_concurrency();
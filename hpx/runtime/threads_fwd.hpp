@@ -55,6 +55,18 @@ namespace hpx
             class HPX_EXPORT periodic_priority_queue_scheduler;
 #endif
 
+#if defined(HPX_HAVE_DEADLINE_SCHEDULER)
+            struct deadline_fifo;
+
+            // earliest-deadline-first scheduler with work-stealing
+            template <typename Mutex = boost::mutex
+                    , typename PendingQueuing = deadline_fifo
+                    , typename StagedQueuing = deadline_fifo
+                    , typename TerminatedQueuing = lockfree_lifo
+                     >
+            class HPX_EXPORT deadline_queue_scheduler;
+#endif
+
 #if defined(HPX_HAVE_STATIC_PRIORITY_SCHEDULER)
             // multi priority scheduler with no work-stealing
             template <typename Mutex = boost::mutex
@@ -113,6 +125,17 @@ namespace hpx
             > abp_fifo_priority_queue_scheduler;
 #endif
 
+#if defined(HPX_HAVE_CHASE_LEV_SCHEDULER)
+            struct lockfree_chase_lev;
+
+            typedef local_priority_queue_scheduler<
+                boost::mutex,
+                lockfree_chase_lev, // LIFO + Chase-Lev stealing pending queuing
+                lockfree_fifo, // FIFO staged queuing
+                lockfree_lifo  // LIFO terminated queuing
+            > chase_lev_priority_queue_scheduler;
+#endif
+
             // define the default scheduler to use
             typedef fifo_priority_queue_scheduler queue_scheduler;
 
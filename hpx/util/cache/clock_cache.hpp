@@ -0,0 +1,439 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_UTIL_CACHE_CLOCK_CACHE_HPP
+#define HPX_UTIL_CACHE_CLOCK_CACHE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/util/cache/statistics/no_statistics.hpp>
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace util { namespace cache
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class clock_cache clock_cache.hpp hpx/util/cache/clock_cache.hpp
+    ///
+    /// \brief The \a clock_cache implements a local (non-distributed) cache
+    ///        using the CLOCK (second chance) replacement policy, which
+    ///        approximates LRU.
+    ///
+    /// In contrast to the \a lru_cache a cache hit does not reorder the
+    /// stored entries, it merely sets the referenced bit of the entry. On
+    /// eviction the clock hand sweeps over the entries, clearing the
+    /// referenced bits, until it finds an entry which was not referenced
+    /// since the last sweep. This keeps lookups cheap and makes the
+    /// \a clock_cache a good fit for caches which are read much more often
+    /// than they are modified. The interface is the same as the one of the
+    /// \a lru_cache.
+    ///
+    /// \tparam Key           The type of the keys to use to identify the
+    ///                       entries stored in the cache
+    /// \tparam Entry         The type of the items to be held in the cache.
+    /// \tparam Statistics    A (optional) type allowing to collect some basic
+    ///                       statistics about the operation of the cache
+    ///                       instance. The type must conform to the
+    ///                       CacheStatistics concept. The default value is
+    ///                       the type \a statistics#no_statistics which does
+    ///                       not collect any numbers, but provides empty stubs
+    ///                       allowing the code to compile.
+    template <
+        typename Key, typename Entry,
+        typename Statistics = statistics::no_statistics
+    >
+    class clock_cache
+    {
+        HPX_MOVABLE_ONLY(clock_cache);
+    public:
+        typedef Key key_type;
+        typedef Entry entry_type;
+        typedef Statistics statistics_type;
+        typedef std::pair<key_type, entry_type> entry_pair;
+        typedef std::size_t size_type;
+
+    private:
+        struct node
+        {
+            node(key_type const& key, entry_type const& entry)
+              : value_(key, entry), referenced_(false)
+            {}
+
+            entry_pair value_;
+            bool referenced_;
+        };
+
+        typedef std::list<node> storage_type;
+        typedef std::map<Key, typename storage_type::iterator> map_type;
+        typedef typename statistics_type::update_on_exit update_on_exit;
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Construct an instance of a clock_cache.
+        ///
+        /// \param max_size   [in] The maximal number of entries this cache is
+        ///                   allowed to hold at any time.
+        ///
+        clock_cache(size_type max_size = 0)
+          : max_size_(max_size),
+            current_size_(0),
+            hand_(storage_.end())
+        {
+        }
+
+        clock_cache(clock_cache && other)
+          : max_size_(other.max_size_)
+          , current_size_(other.current_size_)
+          , storage_(std::move(other.storage_))
+          , hand_(storage_.end())
+          , map_(std::move(other.map_))
+          , statistics_(std::move(other.statistics_))
+        {
+            other.current_size_ = 0;
+            other.hand_ = other.storage_.end();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return current size of the cache.
+        ///
+        /// \returns The current number of entries held by this cache instance.
+        size_type size() const
+        {
+            return current_size_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Access the maximum size the cache is allowed to grow to.
+        ///
+        /// \returns    The maximum number of entries this cache instance is
+        ///             currently allowed to hold.
+        size_type capacity() const
+        {
+            return max_size_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Change the maximum size this cache can grow to
+        ///
+        /// \param max_size    [in] The new maximum size this cache will be
+        ///             allowed to grow to.
+        ///
+        void reserve(size_type max_size)
+        {
+            max_size_ = max_size;
+            while (current_size_ > max_size_)
+            {
+                evict();
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Check whether the cache currently holds an entry identified
+        ///        by the given key
+        ///
+        /// \param key    [in] The key for the entry which should be looked up
+        ///               in the cache.
+        ///
+        /// \note         This function does not mark the entry as referenced.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool holds_key(key_type const& key) const
+        {
+            return map_.find(key) != map_.end();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param key    [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param realkey [out] If the entry indexed by the key is found in
+        ///               the cache this value on successful return will be a
+        ///               copy of the key the entry was stored with.
+        /// \param entry  [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \note         The function will mark the entry as referenced if the
+        ///               key was found in the cache.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(key_type const& key, key_type& realkey,
+            entry_type& entry)
+        {
+            update_on_exit update(statistics_, statistics::method_get_entry);
+
+            auto it = map_.find(key);
+            if (it == map_.end())
+            {
+                // got miss
+                statistics_.got_miss();
+                return false;
+            }
+
+            // got hit
+            it->second->referenced_ = true;
+            statistics_.got_hit();
+
+            realkey = it->first;
+            entry = it->second->value_.second;
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param key    [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param entry  [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(key_type const& key, entry_type& entry)
+        {
+            key_type tmp;
+            return get_entry(key, tmp, entry);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Insert a new entry into this cache
+        ///
+        /// \param key    [in] The key for the entry which should be added to
+        ///               the cache.
+        /// \param entry  [in] The entry which should be added to the cache.
+        ///
+        /// \returns      This function returns \a false if the cache already
+        ///               holds an entry for the given key, otherwise it
+        ///               returns \a true.
+        bool insert(key_type const& key, entry_type const& entry)
+        {
+            update_on_exit update(statistics_, statistics::method_insert_entry);
+            if (map_.find(key) != map_.end())
+            {
+                return false;
+            }
+
+            insert_nonexist(key, entry);
+            return true;
+        }
+
+        void insert_nonexist(key_type const& key, entry_type const& entry)
+        {
+            // the new entry is placed right behind the clock hand, which
+            // makes it the last one to be considered during the next sweep
+            typename storage_type::iterator it =
+                storage_.insert(hand_, node(key, entry));
+            map_[key] = it;
+            ++current_size_;
+
+            // update statistics
+            statistics_.got_insertion();
+
+            // Do we need to evict a cache entry?
+            if (current_size_ > max_size_)
+            {
+                evict();
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache
+        ///
+        /// \param key    [in] The key for the value which should be updated in
+        ///               the cache.
+        /// \param entry  [in] The entry which should be used as a replacement
+        ///               for the existing value in the cache. If no entry is
+        ///               held for the given key it is added.
+        void update(key_type const& key, entry_type const& entry)
+        {
+            update_on_exit update(statistics_, statistics::method_update_entry);
+
+            auto it = map_.find(key);
+            if (it == map_.end())
+            {
+                // got miss
+                statistics_.got_miss();
+                update_on_exit update(statistics_,
+                    statistics::method_insert_entry);
+                insert_nonexist(key, entry);
+                return;
+            }
+
+            // got hit
+            it->second->value_.second = entry;
+            it->second->referenced_ = true;
+            statistics_.got_hit();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache
+        ///
+        /// \param key    [in] The key for the value which should be updated in
+        ///               the cache.
+        /// \param entry  [in] The value which should be used as a replacement
+        ///               for the existing value in the cache.
+        /// \param f      [in] A callable taking two arguments, \a k and the
+        ///               key found in the cache (in that order). If \a f
+        ///               returns true, then the update will not succeed.
+        ///
+        /// \returns      This function returns \a true if the entry has been
+        ///               successfully updated, otherwise it returns \a false.
+        ///               If the entry currently is not held by the cache it is
+        ///               added and the return value is \a true.
+        template <typename F>
+        bool update_if(key_type const& key, entry_type const& entry, F && f)
+        {
+            update_on_exit update(statistics_, statistics::method_update_entry);
+
+            auto it = map_.find(key);
+            if (it == map_.end())
+            {
+                // got miss
+                statistics_.got_miss();
+                update_on_exit update(statistics_,
+                    statistics::method_insert_entry);
+                insert_nonexist(key, entry);
+                return true;
+            }
+
+            if (f(key, it->first))
+                return false;
+
+            // got hit
+            it->second->value_.second = entry;
+            it->second->referenced_ = true;
+            statistics_.got_hit();
+
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove stored entries from the cache for which the supplied
+        ///        function object returns true.
+        ///
+        /// \param ep     [in] This parameter has to be a (unary) function
+        ///               object. It is invoked for each of the entries
+        ///               (as a \a entry_pair) currently held in the cache. An
+        ///               entry is removed from the cache whenever the value
+        ///               returned from this invocation is \a true.
+        ///
+        /// \returns      This function returns the number of removed entries.
+        template <typename Func>
+        size_type erase(Func const& ep)
+        {
+            update_on_exit update(statistics_, statistics::method_erase_entry);
+
+            size_type erased = 0;
+            for (auto it = map_.begin(); it != map_.end(); /**/)
+            {
+                if (ep(it->second->value_))
+                {
+                    ++erased;
+
+                    remove(it->second);
+                    it = map_.erase(it);
+
+                    // update statistics
+                    statistics_.got_eviction();
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+
+            return erased;
+        }
+
+        /// \brief Remove all stored entries from the cache
+        ///
+        /// \returns      This function returns the number of removed entries.
+        size_type erase()
+        {
+            return clear();
+        }
+
+        /// \brief Clear the cache
+        ///
+        /// Unconditionally removes all stored entries from the cache.
+        size_type clear()
+        {
+            size_type erased = current_size_;
+            current_size_ = 0;
+            map_.clear();
+            storage_.clear();
+            hand_ = storage_.end();
+            return erased;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Allow to access the embedded statistics instance
+        ///
+        /// \returns      This function returns a reference to the statistics
+        ///               instance embedded inside this cache
+        statistics_type const& get_statistics() const
+        {
+            return statistics_;
+        }
+
+        statistics_type& get_statistics()
+        {
+            return statistics_;
+        }
+
+    private:
+        void advance_hand()
+        {
+            if (hand_ == storage_.end() || ++hand_ == storage_.end())
+                hand_ = storage_.begin();
+        }
+
+        void remove(typename storage_type::iterator it)
+        {
+            if (it == hand_)
+                ++hand_;
+            storage_.erase(it);
+            --current_size_;
+        }
+
+        void evict()
+        {
+            if (storage_.empty())
+                return;
+
+            // give every referenced entry a second chance, this terminates
+            // after at most one full sweep
+            if (hand_ == storage_.end())
+                hand_ = storage_.begin();
+            while (hand_->referenced_)
+            {
+                hand_->referenced_ = false;
+                advance_hand();
+            }
+
+            statistics_.got_eviction();
+
+            typename storage_type::iterator victim = hand_;
+            map_.erase(victim->value_.first);
+            remove(victim);
+        }
+
+        size_type max_size_;
+        size_type current_size_;
+
+        storage_type storage_;
+        typename storage_type::iterator hand_;
+        map_type map_;
+
+        statistics_type statistics_;
+    };
+}}}
+
+#endif
@@ -0,0 +1,94 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_UTIL_CACHE_ALIGNED_ALLOCATOR_HPP)
+#define HPX_UTIL_CACHE_ALIGNED_ALLOCATOR_HPP
+
+#include <hpx/config.hpp>
+
+#include <boost/lockfree/detail/prefix.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace hpx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Allocator returning memory aligned to a cache line boundary (or to the
+    // alignment of T, if larger). This allows to allocate over-aligned types
+    // without relying on the aligned operator new of C++17.
+    template <typename T>
+    struct cache_aligned_allocator
+    {
+        typedef T value_type;
+        typedef T* pointer;
+        typedef T const* const_pointer;
+        typedef T& reference;
+        typedef T const& const_reference;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+
+        template <typename U>
+        struct rebind
+        {
+            typedef cache_aligned_allocator<U> other;
+        };
+
+        cache_aligned_allocator() HPX_NOEXCEPT {}
+
+        template <typename U>
+        cache_aligned_allocator(cache_aligned_allocator<U> const&) HPX_NOEXCEPT
+        {}
+
+        // The pointer returned by std::malloc is stored right in front of
+        // the aligned block.
+        pointer allocate(size_type n, void const* = nullptr)
+        {
+            std::size_t const alignment = get_alignment();
+            void* p = std::malloc(n * sizeof(T) + alignment + sizeof(void*));
+            if (p == nullptr)
+                throw std::bad_alloc();
+
+            std::uintptr_t aligned =
+                (reinterpret_cast<std::uintptr_t>(p) + sizeof(void*) +
+                    alignment - 1) & ~std::uintptr_t(alignment - 1);
+            reinterpret_cast<void**>(aligned)[-1] = p;
+            return reinterpret_cast<pointer>(aligned);
+        }
+
+        void deallocate(pointer p, size_type)
+        {
+            if (p != nullptr)
+                std::free(reinterpret_cast<void**>(p)[-1]);
+        }
+
+        size_type max_size() const HPX_NOEXCEPT
+        {
+            return (size_type(-1) - get_alignment() - sizeof(void*)) /
+                sizeof(T);
+        }
+
+        friend bool operator==(cache_aligned_allocator const&,
+            cache_aligned_allocator const&) HPX_NOEXCEPT
+        {
+            return true;
+        }
+
+        friend bool operator!=(cache_aligned_allocator const&,
+            cache_aligned_allocator const&) HPX_NOEXCEPT
+        {
+            return false;
+        }
+
+    private:
+        static std::size_t get_alignment() HPX_NOEXCEPT
+        {
+            return alignof(T) > BOOST_LOCKFREE_CACHELINE_BYTES ?
+                alignof(T) : BOOST_LOCKFREE_CACHELINE_BYTES;
+        }
+    };
+}}
+
+#endif
@@ -42,7 +42,9 @@ namespace hpx { namespace util
             num_localities_(1),
             pu_step_(1),
             pu_offset_(std::size_t(-1)),
-            numa_sensitive_(0)
+            numa_sensitive_(0),
+            hierarchical_stealing_(false),
+            max_steal_attempts_(0)
         {}
 
         int call(boost::program_options::options_description const& desc_cmdline,
@@ -67,6 +69,8 @@ namespace hpx { namespace util
         std::string affinity_domain_;
         std::string affinity_bind_;
         std::size_t numa_sensitive_;
+        bool hierarchical_stealing_;
+        std::size_t max_steal_attempts_;
 
     protected:
         bool handle_arguments(util::manage_config& cfgmap,
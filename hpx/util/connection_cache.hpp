@@ -499,9 +499,11 @@ namespace hpx { namespace util
                 // do the accounting
                 ++evictions_;
 
-                // the connection itself will go out of scope on return
+                // the connection itself will go out of scope on return, it
+                // is empty if only a reserved slot is given back
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
-                conn->set_state(Connection::state_deleting);
+                if (conn)
+                    conn->set_state(Connection::state_deleting);
 #endif
             }
 
@@ -0,0 +1,202 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Algorithms from "Dynamic Circular Work-Stealing Deque"
+//  by D. Chase and Y. Lev
+//  Link: http://dl.acm.org/citation.cfm?id=1073974
+//
+//  Memory orderings follow "Correct and Efficient Work-Stealing for Weak
+//  Memory Models" by N. M. Le, A. Pop, A. Cohen and F. Zappa Nardelli
+//  Link: http://dl.acm.org/citation.cfm?id=2442524
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//  Disclaimer: Not a Boost library.
+//
+//  Only the owning thread may call push_bottom() and pop_bottom(), any thread
+//  may call steal_top(). Arrays which were replaced while growing the deque
+//  are kept alive until the deque is destroyed, thieves might still be
+//  reading from them.
+////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(HPX_UTIL_LOCKFREE_CHASE_LEV_DEQUE_OCT_16_2016_0912AM)
+#define HPX_UTIL_LOCKFREE_CHASE_LEV_DEQUE_OCT_16_2016_0912AM
+
+#include <hpx/config.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/lockfree/detail/prefix.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace boost { namespace lockfree
+{
+
+template <typename T>
+struct chase_lev_array
+{
+    explicit chase_lev_array(std::size_t log_size)
+      : log_size_(log_size),
+        buffer_(new atomic<T>[std::size_t(1) << log_size])
+    {}
+
+    ~chase_lev_array()
+    {
+        delete [] buffer_;
+    }
+
+    std::int64_t size() const
+    {
+        return std::int64_t(1) << log_size_;
+    }
+
+    T get(std::int64_t i) const
+    {
+        return buffer_[i & (size() - 1)].load(memory_order_relaxed);
+    }
+
+    void put(std::int64_t i, T const& val)
+    {
+        buffer_[i & (size() - 1)].store(val, memory_order_relaxed);
+    }
+
+    // Create a new array of twice the size holding the elements [top, bottom)
+    chase_lev_array* grow(std::int64_t bottom, std::int64_t top) const
+    {
+        chase_lev_array* a = new chase_lev_array(log_size_ + 1);
+        for (std::int64_t i = top; i != bottom; ++i)
+            a->put(i, get(i));
+        return a;
+    }
+
+private:
+    chase_lev_array(chase_lev_array const&);
+    chase_lev_array& operator=(chase_lev_array const&);
+
+    std::size_t log_size_;
+    atomic<T>* buffer_;
+};
+
+template <typename T>
+struct chase_lev_deque
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+        "chase_lev_deque requires a trivially copyable element type");
+
+    typedef T value_type;
+    typedef chase_lev_array<T> array_type;
+
+    explicit chase_lev_deque(std::size_t initial_size = 0)
+      : top_(0), bottom_(0), array_(nullptr)
+    {
+        std::size_t log_size = 4;
+        while ((std::size_t(1) << log_size) < initial_size)
+            ++log_size;
+
+        array_type* a = new array_type(log_size);
+        retired_.push_back(a);
+        array_.store(a, memory_order_relaxed);
+    }
+
+    ~chase_lev_deque()
+    {
+        for (array_type* a : retired_)
+            delete a;
+    }
+
+    // May be called by the owning thread only.
+    bool push_bottom(T const& val)
+    {
+        std::int64_t b = bottom_.load(memory_order_relaxed);
+        std::int64_t t = top_.load(memory_order_acquire);
+        array_type* a = array_.load(memory_order_relaxed);
+
+        if (b - t > a->size() - 1)
+        {
+            a = a->grow(b, t);
+            retired_.push_back(a);
+            array_.store(a, memory_order_release);
+        }
+
+        a->put(b, val);
+        atomic_thread_fence(memory_order_release);
+        bottom_.store(b + 1, memory_order_relaxed);
+        return true;
+    }
+
+    // May be called by the owning thread only.
+    bool pop_bottom(T& val)
+    {
+        std::int64_t b = bottom_.load(memory_order_relaxed) - 1;
+        array_type* a = array_.load(memory_order_relaxed);
+        bottom_.store(b, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        std::int64_t t = top_.load(memory_order_relaxed);
+
+        if (t > b)
+        {
+            // the deque was empty
+            bottom_.store(b + 1, memory_order_relaxed);
+            return false;
+        }
+
+        val = a->get(b);
+        if (t != b)
+            return true;        // more than one element left, no race
+
+        // last element, compete with thieves
+        bool result = top_.compare_exchange_strong(t, t + 1,
+            memory_order_seq_cst, memory_order_relaxed);
+        bottom_.store(b + 1, memory_order_relaxed);
+        return result;
+    }
+
+    // May be called by any thread.
+    bool steal_top(T& val)
+    {
+        std::int64_t t = top_.load(memory_order_acquire);
+        atomic_thread_fence(memory_order_seq_cst);
+        std::int64_t b = bottom_.load(memory_order_acquire);
+
+        if (t >= b)
+            return false;
+
+        array_type* a = array_.load(memory_order_acquire);
+        T x = a->get(t);
+        if (!top_.compare_exchange_strong(t, t + 1,
+                memory_order_seq_cst, memory_order_relaxed))
+        {
+            return false;       // lost the race against the owner or a thief
+        }
+
+        val = x;
+        return true;
+    }
+
+    bool empty() const
+    {
+        std::int64_t b = bottom_.load(memory_order_relaxed);
+        std::int64_t t = top_.load(memory_order_relaxed);
+        return b <= t;
+    }
+
+private:
+    chase_lev_deque(chase_lev_deque const&);
+    chase_lev_deque& operator=(chase_lev_deque const&);
+
+    // top_ is written by thieves, bottom_ by the owner only
+    atomic<std::int64_t> top_;
+    char padding1_[BOOST_LOCKFREE_CACHELINE_BYTES - sizeof(atomic<std::int64_t>)];
+    atomic<std::int64_t> bottom_;
+    atomic<array_type*> array_;
+    char padding2_[BOOST_LOCKFREE_CACHELINE_BYTES -
+        sizeof(atomic<std::int64_t>) - sizeof(atomic<array_type*>)];
+
+    std::vector<array_type*> retired_;      // touched by the owner only
+};
+
+}}
+
+#endif // HPX_UTIL_LOCKFREE_CHASE_LEV_DEQUE_OCT_16_2016_0912AM
@@ -72,6 +72,18 @@ namespace hpx { namespace util
         std::size_t get_agas_local_cache_size(
             std::size_t dflt = HPX_AGAS_LOCAL_CACHE_SIZE) const;
 
+        // Get the number of shards the AGAS client-side local cache is
+        // partitioned into
+        std::size_t get_agas_local_cache_shards() const;
+
+        // Get the number of partitions of the tables of the AGAS primary
+        // namespace service
+        std::size_t get_agas_primary_namespace_partitions() const;
+
+        // Get the number of ids following a missed id which are resolved
+        // (and cached) together with it
+        std::size_t get_agas_local_cache_prefetch() const;
+
         bool get_agas_caching_mode() const;
 
         bool get_agas_range_caching_mode() const;
@@ -143,6 +155,9 @@ namespace hpx { namespace util
 
 #if defined(__linux) || defined(linux) || defined(__linux__) || defined(__FreeBSD__)
         bool init_use_stack_guard_pages() const;
+        bool init_use_stack_cache() const;
+        bool init_use_huge_pages() const;
+        std::size_t init_stack_slab_size() const;
 #endif
 
         void pre_initialize_ini();
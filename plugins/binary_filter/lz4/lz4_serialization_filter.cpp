@@ -0,0 +1,353 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/actions/action_support.hpp>
+#include <hpx/runtime/components/component_startup_shutdown.hpp>
+#include <hpx/runtime/get_config_entry.hpp>
+#include <hpx/runtime/startup_function.hpp>
+#include <hpx/performance_counters/counter_creators.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/manage_counter_type.hpp>
+#include <hpx/traits/plugin_config_data.hpp>
+#include <hpx/util/bind.hpp>
+#include <hpx/util/function.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/safe_lexical_cast.hpp>
+
+#include <hpx/plugins/plugin_registry.hpp>
+#include <hpx/plugins/binary_filter_factory.hpp>
+#include <hpx/plugins/binary_filter/lz4_serialization_filter.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+
+#include <lz4.h>
+
+namespace hpx { namespace traits
+{
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.plugins.lz4_serialization_filter]
+    //      ...
+    //      adaptive = 1
+    //      min_size = 4096
+    //      max_ratio = 90
+    //      probe_interval = 64
+    //
+    template <>
+    struct plugin_config_data<hpx::plugins::compression::lz4_serialization_filter>
+    {
+        static char const* call()
+        {
+            return "adaptive = 1\n"
+                   "min_size = 4096\n"
+                   "max_ratio = 90\n"
+                   "probe_interval = 64";
+        }
+    };
+}}
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE_DYNAMIC();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::lz4_serialization_filter,
+    lz4_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace plugins { namespace compression
+{
+    namespace detail
+    {
+        // number of consecutive incompressible messages of an action after
+        // which its compression is suspended
+        std::uint32_t const max_incompressible = 3;
+
+        struct lz4_settings
+        {
+            lz4_settings()
+              : adaptive_(util::safe_lexical_cast<int>(get_config_entry(
+                    "hpx.plugins.lz4_serialization_filter.adaptive", "1"),
+                    1) != 0)
+              , min_size_(util::safe_lexical_cast<std::size_t>(
+                    get_config_entry(
+                        "hpx.plugins.lz4_serialization_filter.min_size",
+                        "4096"), 4096))
+              , max_ratio_(util::safe_lexical_cast<std::size_t>(
+                    get_config_entry(
+                        "hpx.plugins.lz4_serialization_filter.max_ratio",
+                        "90"), 90))
+              , probe_interval_(util::safe_lexical_cast<std::uint32_t>(
+                    get_config_entry(
+                        "hpx.plugins.lz4_serialization_filter.probe_interval",
+                        "64"), 64))
+            {}
+
+            bool adaptive_;
+            std::size_t min_size_;
+            std::size_t max_ratio_;         // in percent
+            std::uint32_t probe_interval_;
+        };
+
+        lz4_settings const& get_settings()
+        {
+            static lz4_settings settings;
+            return settings;
+        }
+
+        // statistics exposed as performance counters
+        boost::atomic<std::int64_t> bytes_saved(0);
+        boost::atomic<std::int64_t> compression_time(0);
+        boost::atomic<std::int64_t> compressed_messages(0);
+        boost::atomic<std::int64_t> uncompressed_messages(0);
+
+        std::int64_t get_bytes_saved(bool reset)
+        {
+            return util::get_and_reset_value(bytes_saved, reset);
+        }
+
+        std::int64_t get_compression_time(bool reset)
+        {
+            return util::get_and_reset_value(compression_time, reset);
+        }
+
+        std::int64_t get_compressed_messages(bool reset)
+        {
+            return util::get_and_reset_value(compressed_messages, reset);
+        }
+
+        std::int64_t get_uncompressed_messages(bool reset)
+        {
+            return util::get_and_reset_value(uncompressed_messages, reset);
+        }
+
+        // every message starts with a byte telling whether the data is
+        // compressed or stored as is
+        char const stored = 0;
+        char const compressed = 1;
+    }
+
+    void lz4_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t lz4_serialization_filter::init_data(
+        char const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        if (size == 0)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "lz4_serialization_filter::init_data",
+                "archive data bstream is too short");
+            return 0;
+        }
+
+        buffer_.resize(buffer_size);
+        current_ = 0;
+
+        if (buffer[0] == detail::stored)
+        {
+            if (size - 1 != buffer_size)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "lz4_serialization_filter::init_data",
+                    "unexpected size of uncompressed archive data");
+                return 0;
+            }
+            std::memcpy(buffer_.data(), buffer + 1, buffer_size);
+        }
+        else
+        {
+            int decompressed = LZ4_decompress_safe(buffer + 1,
+                buffer_.data(), static_cast<int>(size - 1),
+                static_cast<int>(buffer_size));
+            if (decompressed < 0 ||
+                static_cast<std::size_t>(decompressed) != buffer_size)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "lz4_serialization_filter::init_data",
+                    "decompression failure, corrupted archive data");
+                return 0;
+            }
+        }
+        return buffer_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void lz4_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (current_+dst_count > buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                    "lz4_serialization_filter::load",
+                    "archive data bstream is too short");
+            return;
+        }
+
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void lz4_serialization_filter::save(void const* src,
+        std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        std::copy(src_begin, src_begin+src_count, std::back_inserter(buffer_));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool lz4_serialization_filter::flush(void* dst, std::size_t dst_count,
+        std::size_t& written)
+    {
+        // make sure we have enough memory
+        std::size_t size = buffer_.size();
+        std::size_t needed =
+            1 + LZ4_compressBound(static_cast<int>(size));
+        if (needed > dst_count)
+        {
+            written = 0;
+            return false;
+        }
+
+        detail::lz4_settings const& settings = detail::get_settings();
+        char* dst_begin = static_cast<char*>(dst);
+
+        // small messages are not worth the compression effort
+        if (!settings.adaptive_ || size >= settings.min_size_)
+        {
+            std::int64_t start = util::high_resolution_clock::now();
+            int compressed_size = LZ4_compress_default(buffer_.data(),
+                dst_begin + 1, static_cast<int>(size),
+                static_cast<int>(dst_count - 1));
+            detail::compression_time +=
+                util::high_resolution_clock::now() - start;
+
+            if (compressed_size <= 0)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "lz4_serialization_filter::flush",
+                    "compression failure, flushing did not reach end of data");
+                return false;
+            }
+
+            // keep the compressed data only if it is sufficiently smaller
+            bool compressible = !settings.adaptive_ ||
+                std::size_t(compressed_size) * 100 <=
+                    size * settings.max_ratio_;
+
+            if (state_ != nullptr && settings.adaptive_)
+            {
+                if (compressible)
+                {
+                    state_->incompressible_.store(0,
+                        boost::memory_order_relaxed);
+                }
+                else if (++state_->incompressible_ >=
+                    detail::max_incompressible)
+                {
+                    // suspend the compression of messages of this action
+                    state_->incompressible_.store(0,
+                        boost::memory_order_relaxed);
+                    state_->skip_.store(settings.probe_interval_,
+                        boost::memory_order_relaxed);
+                }
+            }
+
+            if (compressible)
+            {
+                dst_begin[0] = detail::compressed;
+                written = std::size_t(compressed_size) + 1;
+
+                detail::bytes_saved +=
+                    std::int64_t(size) - std::int64_t(compressed_size);
+                ++detail::compressed_messages;
+                return true;
+            }
+        }
+
+        dst_begin[0] = detail::stored;
+        std::memcpy(dst_begin + 1, buffer_.data(), size);
+        written = size + 1;
+
+        ++detail::uncompressed_messages;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // This function will be registered as a startup function for HPX below.
+    void startup()
+    {
+        using namespace hpx::performance_counters;
+        using util::placeholders::_1;
+        using util::placeholders::_2;
+
+        generic_counter_type_data const counter_types[] =
+        {
+            { "/compression/lz4/count/bytes-saved", counter_raw,
+              "returns the number of bytes saved by compressing messages "
+              "using the LZ4 serialization filter",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&locality_raw_counter_creator, _1,
+                  &detail::get_bytes_saved, _2),
+              &locality_counter_discoverer,
+              ""
+            },
+            { "/compression/lz4/time/compression", counter_raw,
+              "returns the overall time spent compressing messages using "
+              "the LZ4 serialization filter",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&locality_raw_counter_creator, _1,
+                  &detail::get_compression_time, _2),
+              &locality_counter_discoverer,
+              "ns"
+            },
+            { "/compression/lz4/count/compressed-messages", counter_raw,
+              "returns the number of messages sent compressed by the LZ4 "
+              "serialization filter",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&locality_raw_counter_creator, _1,
+                  &detail::get_compressed_messages, _2),
+              &locality_counter_discoverer,
+              ""
+            },
+            { "/compression/lz4/count/uncompressed-messages", counter_raw,
+              "returns the number of messages the LZ4 serialization filter "
+              "sent uncompressed as they were too small or did not compress "
+              "well",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&locality_raw_counter_creator, _1,
+                  &detail::get_uncompressed_messages, _2),
+              &locality_counter_discoverer,
+              ""
+            }
+        };
+
+        install_counter_types(counter_types,
+            sizeof(counter_types)/sizeof(counter_types[0]));
+    }
+
+    bool get_startup(hpx::startup_function_type& startup_func,
+        bool& pre_startup)
+    {
+        startup_func = startup;   // function to run during startup
+        pre_startup = true;       // run 'startup' as pre-startup function
+        return true;
+    }
+}}}
+
+///////////////////////////////////////////////////////////////////////////////
+// Register a startup function which will be called as a HPX-thread during
+// runtime startup. We use this function to register our performance counter
+// types.
+HPX_REGISTER_STARTUP_MODULE_DYNAMIC(hpx::plugins::compression::get_startup);
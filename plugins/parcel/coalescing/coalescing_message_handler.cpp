@@ -40,6 +40,8 @@ namespace hpx { namespace traits
     //      ...
     //      num_messages = 50
     //      interval = 100
+    //      allow_background_flush = 1
+    //      adaptive = 0
     //
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
@@ -48,7 +50,8 @@ namespace hpx { namespace traits
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   "adaptive = 0";
         }
     };
 }}
@@ -84,6 +87,13 @@ namespace hpx { namespace plugins { namespace parcel
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+        bool get_adaptive()
+        {
+            std::string value = hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.adaptive", "0");
+            return !value.empty() && value[0] != '0';
+        }
     }
 
     coalescing_message_handler::coalescing_message_handler(
@@ -93,13 +103,15 @@ namespace hpx { namespace plugins { namespace parcel
         num_coalesced_parcels_(detail::get_num_messages(num)),
         interval_(detail::get_interval(interval)),
         buffer_(num_coalesced_parcels_),
-        timer_(
+        flush_control_(
             util::bind(&coalescing_message_handler::timer_flush, this_()),
             util::bind(&coalescing_message_handler::flush_terminate, this_()),
-            std::string(action_name) + "_timer"),
-        stopped_(false),
-        allow_background_flush_(detail::get_background_flush()),
+            std::string(action_name) + "_timer",
+            detail::get_background_flush()),
         action_name_(action_name),
+        adaptive_(detail::get_adaptive()),
+        adaptive_num_(num_coalesced_parcels_),
+        average_time_between_parcels_(0),
         num_parcels_(0), reset_num_parcels_(0),
             reset_num_parcels_per_message_parcels_(0),
         num_messages_(0), reset_num_messages_(0),
@@ -143,13 +155,22 @@ namespace hpx { namespace plugins { namespace parcel
         if (time_between_parcels_)
             (*time_between_parcels_)(time_since_last_parcel);
 
+        // moving average of the time between parcels, the histogram above
+        // is available only if its counter was requested
+        average_time_between_parcels_ +=
+            (time_since_last_parcel - average_time_between_parcels_) / 8;
+
         std::chrono::microseconds interval(detail::get_interval(interval_));
 
         // just send parcel if the coalescing was stopped or the buffer is
         // empty and time since last parcel is larger than coalescing interval.
-        if (stopped_ ||
+        // In adaptive mode we also back off to sending parcels immediately
+        // if the traffic for this action is sparse on average.
+        if (flush_control_.stopped() ||
             (buffer_.empty() &&
-                std::chrono::nanoseconds(time_since_last_parcel) > interval
+                (std::chrono::nanoseconds(time_since_last_parcel) > interval ||
+                    (adaptive_ && std::chrono::nanoseconds(
+                        average_time_between_parcels_) > interval))
            ))
         {
             ++num_messages_;
@@ -165,18 +186,24 @@ namespace hpx { namespace plugins { namespace parcel
 
         switch(s) {
         case detail::message_buffer::first_message:
-            // start deadline timer to flush buffer
-            l.unlock();
-            timer_.start(interval);
+            {
+                // start deadline timer to flush buffer
+                interval = get_flush_interval(interval);
+                l.unlock();
+                flush_control_.start_timer(interval);
+            }
             break;
 
         case detail::message_buffer::normal:
-            if (timer_.is_started())
-                break;
+            {
+                if (flush_control_.is_timer_started())
+                    break;
 
-            // start deadline timer to flush buffer
-            l.unlock();
-            timer_.start(interval);
+                // start deadline timer to flush buffer
+                interval = get_flush_interval(interval);
+                l.unlock();
+                flush_control_.start_timer(interval);
+            }
             break;
 
         case detail::message_buffer::buffer_now_full:
@@ -231,39 +258,84 @@ namespace hpx { namespace plugins { namespace parcel
     {
         HPX_ASSERT(l.owns_lock());
 
-        // proceed with background work only if explicitly allowed
-        if (!allow_background_flush_ &&
-            mode == parcelset::policies::message_handler::flush_mode_background_work)
-        {
+        if (!flush_control_.prepare_flush(mode, stop_buffering, cancel_timer) ||
+            buffer_.empty())
             return false;
-        }
 
-        if (!stopped_ && stop_buffering)
-        {
-            stopped_ = true;
-            timer_.stop();              // interrupt timer
-        }
-        else if (cancel_timer)
+        HPX_ASSERT(nullptr != pp_);
+
+        // adjust the size of the batch before creating the buffer for the
+        // next one, the number of parcels still waiting for a connection to
+        // the destination tells us whether the network keeps up with our
+        // traffic
+        if (adaptive_)
         {
-            timer_.stop();              // interrupt timer
+            adapt(mode, buffer_.size(),
+                pp_->get_pending_parcels_count(buffer_.destination()));
         }
 
-        if (buffer_.empty())
-            return false;
-
-        detail::message_buffer buff (
-            detail::get_num_messages(num_coalesced_parcels_));
+        detail::message_buffer buff (adaptive_ ?
+            adaptive_num_ : detail::get_num_messages(num_coalesced_parcels_));
         std::swap(buff, buffer_);
 
         ++num_messages_;
         l.unlock();
 
-        HPX_ASSERT(nullptr != pp_);
         buff(pp_);                   // 'invoke' the buffer
-
         return true;
     }
 
+    void coalescing_message_handler::adapt(
+        parcelset::policies::message_handler::flush_mode mode,
+        std::size_t num_flushed, std::size_t queue_depth)
+    {
+        HPX_ASSERT(adaptive_);
+
+        std::size_t max_num = detail::get_num_messages(num_coalesced_parcels_);
+        switch (mode)
+        {
+        case parcelset::policies::message_handler::flush_mode_buffer_full:
+            // the batch filled up before the timer fired, grow it quickly if
+            // parcels are queueing up for the destination anyways
+            adaptive_num_ = queue_depth != 0 ? 2 * adaptive_num_ :
+                adaptive_num_ + 1;
+            break;
+
+        case parcelset::policies::message_handler::flush_mode_timer:
+            // the timer fired on a mostly empty batch, shrink it unless the
+            // destination is backed up
+            if (queue_depth == 0 && 2 * num_flushed < adaptive_num_)
+                adaptive_num_ /= 2;
+            break;
+
+        default:
+            break;
+        }
+
+        if (adaptive_num_ < 1)
+            adaptive_num_ = 1;
+        else if (adaptive_num_ > max_num)
+            adaptive_num_ = max_num;
+    }
+
+    std::chrono::microseconds coalescing_message_handler::get_flush_interval(
+        std::chrono::microseconds interval) const
+    {
+        if (!adaptive_)
+            return interval;
+
+        // wait for about as long as it takes to fill the remaining slots of
+        // the current batch, but never longer than the configured interval
+        std::size_t size = buffer_.size();
+        std::size_t remaining = adaptive_num_ > size ? adaptive_num_ - size : 1;
+
+        std::chrono::microseconds expected(
+            (average_time_between_parcels_ * std::int64_t(remaining)) / 1000);
+        if (expected < std::chrono::microseconds(1))
+            return std::chrono::microseconds(1);
+        return expected < interval ? expected : interval;
+    }
+
     // performance counter values
     std::int64_t
     coalescing_message_handler::get_average_time_between_parcels(bool reset)
@@ -0,0 +1,375 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// hpxinspect:nodeprecatedinclude:boost/chrono/chrono.hpp
+// hpxinspect:nodeprecatedname:boost::chrono
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/plugins/parcelport/shmem/connection_handler.hpp>
+#include <hpx/plugins/parcelport/shmem/receiver.hpp>
+#include <hpx/plugins/parcelport/shmem/ring_buffer.hpp>
+#include <hpx/plugins/parcelport/shmem/sender.hpp>
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/bind.hpp>
+#include <hpx/util/runtime_configuration.hpp>
+
+#include <boost/asio/ip/host_name.hpp>
+#include <boost/atomic.hpp>
+#include <boost/chrono/chrono.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include <unistd.h>
+
+namespace hpx
+{
+    bool is_starting();
+}
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    parcelset::locality parcelport_address(util::runtime_configuration const&)
+    {
+        // the process id identifies the locality on this host
+        return parcelset::locality(
+            locality(
+                boost::asio::ip::host_name()
+              , "/hpx.shmem." + std::to_string(::getpid())
+            )
+        );
+    }
+
+    void add_sender(connection_handler& handler, std::shared_ptr<sender> const& s)
+    {
+        handler.add_sender(s);
+    }
+
+    namespace detail
+    {
+        std::size_t get_ring_size(util::runtime_configuration const& ini)
+        {
+            std::size_t size = hpx::util::get_entry_as<std::size_t>(
+                ini, "hpx.parcel.shmem.ring_size", "262144");
+
+            // the ring size has to be a power of two
+            std::size_t result = 4096;
+            while (result < size)
+                result *= 2;
+            return result;
+        }
+    }
+
+    connection_handler::connection_handler(util::runtime_configuration const& ini,
+            util::function_nonser<void(std::size_t, char const*)> const& on_start_thread,
+            util::function_nonser<void()> const& on_stop_thread)
+      : base_type(ini, parcelport_address(ini), on_start_thread, on_stop_thread)
+      , num_channels_((std::min)((std::max)(
+            hpx::util::get_entry_as<std::size_t>(
+                ini, "hpx.parcel.shmem.num_channels", "64"), std::size_t(1)),
+            max_channels))
+      , ring_size_(detail::get_ring_size(ini))
+      , bulk_threshold_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.shmem.bulk_threshold", "65536"))
+      , stopped_(false)
+      , has_unreachable_(false)
+    {
+        if (here_.type() != std::string("shmem")) {
+            HPX_THROW_EXCEPTION(network_error, "shmem::parcelport::parcelport",
+                "this parcelport was instantiated to represent an unexpected "
+                "locality type: " + std::string(here_.type()));
+        }
+    }
+
+    connection_handler::~connection_handler()
+    {
+        receivers_.clear();
+        segment_.close();
+    }
+
+    bool connection_handler::do_run()
+    {
+        locality const& here = here_.get<locality>();
+
+        segment_.create(here.segment(), segment_size(num_channels_, ring_size_));
+        init_segment(segment_.data(), num_channels_, ring_size_);
+
+        receivers_.reserve(num_channels_);
+        for (std::size_t i = 0; i != num_channels_; ++i)
+        {
+            receivers_.emplace_back(new receiver<connection_handler>(*this,
+                here.segment(), get_channel(segment_.data(), ring_size_, i),
+                ring_size_, i));
+        }
+
+        for (std::size_t i = 0; i != io_service_pool_.size(); ++i)
+        {
+            io_service_pool_.get_io_service(int(i)).post(
+                hpx::util::bind(&connection_handler::io_service_work, this));
+        }
+        return true;
+    }
+
+    void connection_handler::do_stop()
+    {
+        // flush the messages still in flight, give up if no progress was made
+        // for a while (the receiver might be gone already)
+        std::size_t idle = 0;
+        while (has_pending_senders() && idle != HPX_MAX_NETWORK_RETRIES)
+        {
+            if (background_work(0))
+            {
+                idle = 0;
+                continue;
+            }
+
+            ++idle;
+            if (threads::get_self_ptr())
+            {
+                hpx::this_thread::suspend(hpx::threads::pending,
+                    "shmem::connection_handler::do_stop");
+            }
+            else
+            {
+                boost::this_thread::sleep_for(
+                    boost::chrono::milliseconds(HPX_NETWORK_RETRIES_SLEEP));
+            }
+        }
+        background_work(0);
+        stopped_ = true;
+
+        // no new connections can be established from now on, the mapping
+        // stays valid for senders still holding on to it
+        segment_.unlink();
+    }
+
+    std::string connection_handler::get_locality_name() const
+    {
+        return boost::asio::ip::host_name();
+    }
+
+    bool connection_handler::can_connect(parcelset::locality const& l,
+        bool use_alternative_parcelport)
+    {
+        locality const& dest = l.get<locality>();
+        return use_alternative_parcelport &&
+            dest.host() == here_.get<locality>().host() &&
+            !is_unreachable(dest.segment());
+    }
+
+    void connection_handler::set_unreachable(std::string const& segment)
+    {
+        std::lock_guard<mutex_type> l(unreachable_mtx_);
+        unreachable_.insert(segment);
+        has_unreachable_ = true;
+    }
+
+    bool connection_handler::is_unreachable(std::string const& segment)
+    {
+        if (!has_unreachable_.load(boost::memory_order_acquire))
+            return false;
+
+        std::lock_guard<mutex_type> l(unreachable_mtx_);
+        return unreachable_.find(segment) != unreachable_.end();
+    }
+
+    std::shared_ptr<sender> connection_handler::create_connection(
+        parcelset::locality const& l, error_code& ec)
+    {
+        std::string const& name = l.get<locality>().segment();
+
+        // The destination might not have created its segment yet, retry if
+        // needed
+        shared_memory segment;
+        for (std::size_t i = 0; i < HPX_MAX_NETWORK_RETRIES; ++i)
+        {
+            if (stopped_)
+                return std::shared_ptr<sender>();
+
+            error_code lec(lightweight);
+            segment.open(name, lec);
+            if (!lec && segment.size() >= sizeof(segment_header))
+            {
+                segment_header const* hdr =
+                    static_cast<segment_header const*>(segment.data());
+                if (hdr->magic_ == segment_header::magic)
+                {
+                    boost::atomic_thread_fence(boost::memory_order_acquire);
+                    break;
+                }
+            }
+            segment.close();
+
+            // wait for a really short amount of time
+            if (hpx::threads::get_self_ptr()) {
+                this_thread::suspend(hpx::threads::pending,
+                    "shmem::connection_handler::create_connection");
+            }
+            else {
+                boost::this_thread::sleep_for(
+                    boost::chrono::milliseconds(HPX_NETWORK_RETRIES_SLEEP));
+            }
+        }
+
+        if (!segment)
+        {
+            // send the parcels to this destination through the next
+            // parcelport from now on
+            set_unreachable(name);
+
+            HPX_THROWS_IF(ec, network_error,
+                "shmem::connection_handler::create_connection",
+                "unable to open the shared memory segment '" + name +
+                    "' of the destination locality");
+            return std::shared_ptr<sender>();
+        }
+
+        // claim a free channel of the destination
+        std::size_t channel = claim_channel(segment.data());
+        if (channel != std::size_t(-1))
+        {
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return std::make_shared<sender>(*this, l, this,
+                std::move(segment), channel, bulk_threshold_);
+        }
+
+        // all channels are taken by other localities, send the parcels to
+        // this destination through the next parcelport from now on
+        set_unreachable(name);
+
+        HPX_THROWS_IF(ec, network_error,
+            "shmem::connection_handler::create_connection",
+            "all channels of the shared memory segment '" + name +
+                "' are in use");
+        return std::shared_ptr<sender>();
+    }
+
+    parcelset::locality connection_handler::agas_locality(
+        util::runtime_configuration const&) const
+    {
+        // this parcelport can't be used for bootstrapping
+        return parcelset::locality(locality());
+    }
+
+    parcelset::locality connection_handler::create_locality() const
+    {
+        return parcelset::locality(locality());
+    }
+
+    bool connection_handler::background_work(std::size_t num_thread)
+    {
+        if (stopped_ || receivers_.empty())
+            return false;
+
+        bool has_work = send_messages();
+        return receive_messages(num_thread) || has_work;
+    }
+
+    void connection_handler::add_sender(sender_ptr const& s)
+    {
+        std::lock_guard<mutex_type> l(senders_mtx_);
+        senders_.push_back(s);
+    }
+
+    bool connection_handler::has_pending_senders()
+    {
+        std::lock_guard<mutex_type> l(senders_mtx_);
+        return !senders_.empty();
+    }
+
+    bool connection_handler::send_messages()
+    {
+        sender_list senders;
+        {
+            std::unique_lock<mutex_type> l(senders_mtx_, std::try_to_lock);
+            if (!l.owns_lock() || senders_.empty())
+                return false;
+            std::swap(senders, senders_);
+        }
+
+        // only report progress if data was written or a message completed,
+        // connections waiting for room in a full ring are no work
+        bool has_work = false;
+        sender_list::iterator end = std::remove_if(
+            senders.begin(), senders.end(),
+            [&has_work](sender_ptr const& s) -> bool
+            {
+                std::uint64_t bytes_written = s->bytes_written();
+                if (s->send())
+                {
+                    error_code ec;
+                    s->postprocess(ec);
+                    has_work = true;
+                    return true;
+                }
+                if (s->bytes_written() != bytes_written)
+                    has_work = true;
+                return false;
+            });
+
+        // give back the connections which are still in progress
+        if (senders.begin() != end)
+        {
+            std::lock_guard<mutex_type> l(senders_mtx_);
+            senders_.insert(senders_.end(),
+                std::make_move_iterator(senders.begin()),
+                std::make_move_iterator(end));
+        }
+        return has_work;
+    }
+
+    bool connection_handler::receive_messages(std::size_t num_thread)
+    {
+        // look only at the channels the senders have written to
+        std::uint64_t ready = take_ready_channels(segment_.data());
+
+        bool has_work = false;
+        for (std::size_t i = 0; ready != 0; ++i, ready >>= 1)
+        {
+            if (!(ready & 1))
+                continue;
+
+            receiver<connection_handler>& r = *receivers_[i];
+            has_work = r.receive(num_thread) || has_work;
+
+            // the channel was busy, have it looked at again later
+            if (r.has_data())
+                notify_channel(segment_.data(), i);
+        }
+        return has_work;
+    }
+
+    void connection_handler::io_service_work()
+    {
+        std::size_t k = 0;
+        // We only execute work on the IO service while HPX is starting
+        while (hpx::is_starting())
+        {
+            if (background_work(0))
+            {
+                k = 0;
+            }
+            else
+            {
+                ++k;
+                hpx::lcos::local::spinlock::yield(k);
+            }
+        }
+    }
+}}}}
+
+#endif
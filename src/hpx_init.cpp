@@ -919,7 +919,8 @@ namespace hpx
                 local_queue_policy;
             local_queue_policy::init_parameter_type init(
                 cfg.num_threads_, num_high_priority_queues, 1000,
-                numa_sensitive, "core-local_priority_queue_scheduler");
+                numa_sensitive, "core-local_priority_queue_scheduler",
+                cfg.hierarchical_stealing_, cfg.max_steal_attempts_);
             threads::policies::init_affinity_data affinity_init(
                 pu_offset, pu_step, affinity_domain, affinity_desc);
 
@@ -969,6 +970,98 @@ namespace hpx
 #endif
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // priority Chase-Lev scheduler: local priority work-stealing deques
+        // for each OS thread, the owning OS thread pops from the bottom while
+        // other OS threads steal from the top of each.
+        int run_priority_chase_lev(startup_function_type startup,
+            shutdown_function_type shutdown,
+            util::command_line_handling& cfg, bool blocking)
+        {
+#if defined(HPX_HAVE_CHASE_LEV_SCHEDULER)
+            ensure_hierarchy_arity_compatibility(cfg.vm_);
+
+            std::size_t num_high_priority_queues =
+                get_num_high_priority_queues(cfg);
+            std::size_t pu_offset = get_pu_offset(cfg);
+            std::size_t pu_step = get_pu_step(cfg);
+            std::string affinity_domain = get_affinity_domain(cfg);
+            std::string affinity_desc;
+            std::size_t numa_sensitive =
+                get_affinity_description(cfg, affinity_desc);
+
+            // scheduling policy
+            typedef hpx::threads::policies::chase_lev_priority_queue_scheduler
+                chase_lev_priority_queue_policy;
+            chase_lev_priority_queue_policy::init_parameter_type init(
+                cfg.num_threads_, num_high_priority_queues, 1000,
+                numa_sensitive, "core-chase_lev_priority_queue_scheduler",
+                cfg.hierarchical_stealing_, cfg.max_steal_attempts_);
+            threads::policies::init_affinity_data affinity_init(
+                pu_offset, pu_step, affinity_domain, affinity_desc);
+
+            // Build and configure this runtime instance.
+            typedef hpx::runtime_impl<chase_lev_priority_queue_policy>
+                runtime_type;
+            std::unique_ptr<hpx::runtime> rt(
+                new runtime_type(cfg.rtcfg_, cfg.mode_, cfg.num_threads_, init,
+                    affinity_init));
+
+            return run_or_start(blocking, std::move(rt), cfg,
+                std::move(startup), std::move(shutdown));
+#else
+            throw detail::command_line_error("Command line option "
+                "--hpx:queuing=chase-lev-priority "
+                "is not configured in this build. Please rebuild with "
+                "'cmake -DHPX_WITH_THREAD_SCHEDULERS=chase-lev-priority'.");
+#endif
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // deadline scheduler: one deadline ordered queue for each OS thread
+        // plus separate queues for high and low priority HPX-threads, threads
+        // are stolen based on their deadline
+        int run_deadline(startup_function_type startup,
+            shutdown_function_type shutdown,
+            util::command_line_handling& cfg, bool blocking)
+        {
+#if defined(HPX_HAVE_DEADLINE_SCHEDULER)
+            ensure_hierarchy_arity_compatibility(cfg.vm_);
+
+            std::size_t num_high_priority_queues =
+                get_num_high_priority_queues(cfg);
+            std::size_t pu_offset = get_pu_offset(cfg);
+            std::size_t pu_step = get_pu_step(cfg);
+            std::string affinity_domain = get_affinity_domain(cfg);
+            std::string affinity_desc;
+            std::size_t numa_sensitive =
+                get_affinity_description(cfg, affinity_desc);
+
+            // scheduling policy
+            typedef hpx::threads::policies::deadline_queue_scheduler<>
+                deadline_queue_policy;
+            deadline_queue_policy::init_parameter_type init(
+                cfg.num_threads_, num_high_priority_queues, 1000,
+                numa_sensitive, "core-deadline_queue_scheduler");
+            threads::policies::init_affinity_data affinity_init(
+                pu_offset, pu_step, affinity_domain, affinity_desc);
+
+            // Build and configure this runtime instance.
+            typedef hpx::runtime_impl<deadline_queue_policy> runtime_type;
+            std::unique_ptr<hpx::runtime> rt(
+                new runtime_type(cfg.rtcfg_, cfg.mode_, cfg.num_threads_, init,
+                    affinity_init));
+
+            return run_or_start(blocking, std::move(rt), cfg,
+                std::move(startup), std::move(shutdown));
+#else
+            throw detail::command_line_error("Command line option "
+                "--hpx:queuing=deadline "
+                "is not configured in this build. Please rebuild with "
+                "'cmake -DHPX_WITH_THREAD_SCHEDULERS=deadline'.");
+#endif
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // hierarchical scheduler: The thread queues are built up hierarchically
         // this avoids contention during work stealing
@@ -1132,6 +1225,24 @@ namespace hpx
                     result = run_priority_abp(std::move(startup),
                         std::move(shutdown), cfg, blocking);
                 }
+                else if (0 == std::string("chase-lev-priority").find(cfg.queuing_))
+                {
+                    // local scheduler with priority work-stealing deques (one
+                    // Chase-Lev deque for each OS thread plus separate queues
+                    // for high and low priority HPX-threads)
+                    cfg.queuing_ = "chase-lev-priority";
+                    result = run_priority_chase_lev(std::move(startup),
+                        std::move(shutdown), cfg, blocking);
+                }
+                else if (0 == std::string("deadline").find(cfg.queuing_))
+                {
+                    // earliest-deadline-first scheduler (one deadline ordered
+                    // queue for each OS thread plus separate queues for high
+                    // and low priority HPX-threads)
+                    cfg.queuing_ = "deadline";
+                    result = run_deadline(std::move(startup),
+                        std::move(shutdown), cfg, blocking);
+                }
                 else if (0 == std::string("hierarchy").find(cfg.queuing_))
                 {
                     // hierarchy scheduler: tree of queues, with work
@@ -42,17 +42,21 @@
 #include <hpx/performance_counters/counter_creators.hpp>
 #include <hpx/performance_counters/manage_counter_type.hpp>
 #include <hpx/lcos/wait_all.hpp>
+#include <hpx/lcos/when_all.hpp>
 #include <hpx/lcos/broadcast.hpp>
 
+#include <boost/exception_ptr.hpp>
 #include <boost/format.hpp>
 #include <boost/icl/closed_interval.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -124,13 +128,63 @@ struct addressing_service::gva_cache_key
     }
 }; // }}}
 
+struct addressing_service::gva_cache_shard
+{
+    gva_cache_shard(std::size_t max_size)
+      : cache_(max_size)
+    {}
+
+    mutable mutex_type mtx_;
+    gva_cache_type cache_;
+};
+
+namespace detail
+{
+    // Consecutive ids falling into the same block of this size are cached in
+    // the same shard of the gva cache. An entry for a range of ids spanning
+    // several blocks is stored in an additional shard instead.
+    std::uint64_t const gva_cache_block_size = 0x10000;
+
+    // Distribute the configured cache size evenly over the shards.
+    std::size_t gva_cache_shard_size(std::size_t cache_size,
+        std::size_t num_shards)
+    {
+        return cache_size / num_shards + (cache_size % num_shards ? 1 : 0);
+    }
+
+    template <typename F>
+    std::uint64_t accumulate_gva_cache(
+        addressing_service::gva_cache_shards_type const& shards, F && f)
+    {
+        std::uint64_t result = 0;
+        for (auto const& shard : shards)
+        {
+            std::lock_guard<addressing_service::mutex_type> lock(shard->mtx_);
+            result += f(shard->cache_);
+        }
+        return result;
+    }
+
+    // Wait for all per-locality requests of a bulk operation, propagating
+    // the first exception any of them might have raised.
+    template <typename T>
+    std::vector<T> get_bulk_results(
+        hpx::future<std::vector<hpx::future<void> > > f
+      , std::shared_ptr<std::vector<T> > const& results)
+    {
+        std::vector<hpx::future<void> > requests = f.get();
+        for (hpx::future<void>& r : requests)
+            r.get();
+        return std::move(*results);
+    }
+}
+
 addressing_service::addressing_service(
     parcelset::parcelhandler& ph
   , util::runtime_configuration const& ini_
   , runtime_mode runtime_type_
     )
-  : gva_cache_(new gva_cache_type)
-  , console_cache_(naming::invalid_locality_id)
+  : console_cache_(naming::invalid_locality_id)
   , max_refcnt_requests_(ini_.get_agas_max_pending_refcnt_requests())
   , refcnt_requests_count_(0)
   , enable_refcnt_caching_(true)
@@ -139,18 +193,37 @@ addressing_service::addressing_service(
   , runtime_type(runtime_type_)
   , caching_(ini_.get_agas_caching_mode())
   , range_caching_(caching_ ? ini_.get_agas_range_caching_mode() : false)
+  , cache_prefetch_(caching_ ? ini_.get_agas_local_cache_prefetch() : 0)
   , action_priority_(ini_.get_agas_dedicated_server() ?
         threads::thread_priority_normal : threads::thread_priority_boost)
   , rts_lva_(0)
   , mem_lva_(0)
+  , primary_ns_(ini_.get_agas_primary_namespace_partitions())
   , state_(state_starting)
   , locality_()
 { // {{{
+    gva_cache_has_ranges_.store(false);
+
     std::shared_ptr<parcelset::parcelport> pp = ph.get_bootstrap_parcelport();
     create_big_boot_barrier(pp ? pp.get() : nullptr, ph.endpoints(), ini_);
 
-    if (caching_)
-        gva_cache_->reserve(ini_.get_agas_local_cache_size());
+    // add a shard for the ranges spanning several blocks, which is not
+    // needed if there is only one shard
+    std::size_t num_shards =
+        caching_ ? ini_.get_agas_local_cache_shards() : 1;
+    if (num_shards > 1)
+        ++num_shards;
+
+    std::size_t const shard_size = caching_ ?
+        detail::gva_cache_shard_size(
+            ini_.get_agas_local_cache_size(), num_shards) : 0;
+
+    gva_cache_shards_.reserve(num_shards);
+    for (std::size_t i = 0; i != num_shards; ++i)
+    {
+        gva_cache_shards_.push_back(
+            std::make_shared<gva_cache_shard>(shard_size));
+    }
 
     if (service_type == service_mode_bootstrap)
     {
@@ -271,8 +344,16 @@ void addressing_service::adjust_local_cache_size(std::size_t cache_size)
     // create the hierarchy based on the topology
     if (caching_)
     {
-        std::size_t previous = gva_cache_->size();
-            gva_cache_->reserve(cache_size);
+        std::size_t previous = 0;
+        std::size_t const shard_size = detail::gva_cache_shard_size(
+            cache_size, gva_cache_shards_.size());
+
+        for (auto const& shard : gva_cache_shards_)
+        {
+            std::lock_guard<mutex_type> lock(shard->mtx_);
+            previous += shard->cache_.capacity();
+            shard->cache_.reserve(shard_size);
+        }
 
         LAGAS_(info) << (boost::format(
             "addressing_service::adjust_local_cache_size, previous size: %1%, "
@@ -756,6 +837,97 @@ hpx::future<bool> addressing_service::bind_range_async(
         ));
 }
 
+void addressing_service::bind_bulk_postproc(
+    future<std::vector<primary_namespace::bind_gid_response_type> > f
+  , std::vector<primary_namespace::bind_gid_request_type> const& requests
+  , std::vector<std::size_t> const& indices
+  , std::shared_ptr<std::vector<bool> > const& results
+    )
+{
+    using hpx::util::get;
+
+    std::vector<primary_namespace::bind_gid_response_type> rep = f.get();
+    HPX_ASSERT(rep.size() == requests.size());
+
+    // the successful requests are cached even if another one failed, the
+    // first error is reported afterwards
+    boost::exception_ptr error;
+    for (std::size_t i = 0; i != requests.size(); ++i)
+    {
+        if (get<1>(rep[i]))
+        {
+            if (!error)
+                error = get<1>(rep[i]);
+            continue;
+        }
+
+        // the cache is updated for rebinds as well, just like bind_postproc
+        // does, all of the ids are bound individually, so caching the range
+        // is the same as caching the first id
+        (*results)[indices[i]] = get<0>(rep[i]);
+        update_cache_entry(get<1>(requests[i]), get<0>(requests[i]));
+    }
+
+    if (error)
+        boost::rethrow_exception(error);
+}
+
+hpx::future<std::vector<bool> > addressing_service::bind_bulk(
+    std::vector<naming::gid_type> const& ids
+  , std::vector<naming::address> const& addrs
+  , naming::gid_type const& locality
+    )
+{
+    if (ids.size() != addrs.size())
+    {
+        HPX_THROW_EXCEPTION(bad_parameter,
+            "addressing_service::bind_bulk",
+            "the number of ids and addresses must match");
+        return make_ready_future(std::vector<bool>());
+    }
+
+    // group the requests by the primary namespace instance managing the ids
+    typedef std::pair<
+            std::vector<primary_namespace::bind_gid_request_type>
+          , std::vector<std::size_t>
+        > request_group;
+    std::map<std::uint32_t, request_group> groups;
+
+    for (std::size_t i = 0; i != ids.size(); ++i)
+    {
+        naming::gid_type id(
+            naming::detail::get_stripped_gid_except_dont_cache(ids[i]));
+        gva const g(addrs[i].locality_, addrs[i].type_, 1,
+            addrs[i].address_, 0);
+
+        request_group& group = groups[naming::get_locality_id_from_gid(id)];
+        group.first.emplace_back(g, id, locality);
+        group.second.push_back(i);
+    }
+
+    std::shared_ptr<std::vector<bool> > results =
+        std::make_shared<std::vector<bool> >(ids.size(), false);
+    if (groups.empty())
+        return make_ready_future(std::move(*results));
+
+    std::vector<future<void> > requests;
+    requests.reserve(groups.size());
+    for (auto& group : groups)
+    {
+        future<std::vector<primary_namespace::bind_gid_response_type> > f =
+            primary_ns_.bind_gid_bulk(group.second.first);
+
+        requests.push_back(f.then(util::bind(
+            util::one_shot(&addressing_service::bind_bulk_postproc),
+            this, _1, std::move(group.second.first),
+            std::move(group.second.second), results)));
+    }
+
+    return hpx::when_all(requests).then(util::bind(
+            util::one_shot(&detail::get_bulk_results<bool>), _1, results
+        ));
+}
+
 hpx::future<naming::address> addressing_service::unbind_range_async(
     naming::gid_type const& lower_id
   , std::uint64_t count
@@ -764,6 +936,86 @@ hpx::future<naming::address> addressing_service::unbind_range_async(
     return primary_ns_.unbind_gid_async(count, lower_id);
 }
 
+void addressing_service::unbind_bulk_postproc(
+    future<std::vector<primary_namespace::unbind_gid_response_type> > f
+  , std::vector<primary_namespace::unbind_gid_request_type> const& requests
+  , std::vector<std::size_t> const& indices
+  , std::shared_ptr<std::vector<naming::address> > const& addrs
+    )
+{
+    using hpx::util::get;
+
+    std::vector<primary_namespace::unbind_gid_response_type> rep = f.get();
+    HPX_ASSERT(rep.size() == requests.size());
+
+    boost::exception_ptr error;
+    std::vector<naming::gid_type> unbound;
+    unbound.reserve(requests.size());
+
+    for (std::size_t i = 0; i != requests.size(); ++i)
+    {
+        if (get<1>(rep[i]))
+        {
+            if (!error)
+                error = get<1>(rep[i]);
+            continue;
+        }
+
+        (*addrs)[indices[i]] = get<0>(rep[i]);
+        if (get<0>(rep[i]))
+            unbound.push_back(get<1>(requests[i]));
+    }
+
+    // drop all of the unbound ids from the cache at once
+    remove_cache_entries(unbound);
+
+    if (error)
+        boost::rethrow_exception(error);
+}
+
+hpx::future<std::vector<naming::address> > addressing_service::unbind_bulk(
+    std::vector<naming::gid_type> const& ids
+    )
+{
+    // group the requests by the primary namespace instance managing the ids
+    typedef std::pair<
+            std::vector<primary_namespace::unbind_gid_request_type>
+          , std::vector<std::size_t>
+        > request_group;
+    std::map<std::uint32_t, request_group> groups;
+
+    for (std::size_t i = 0; i != ids.size(); ++i)
+    {
+        request_group& group =
+            groups[naming::get_locality_id_from_gid(ids[i])];
+        group.first.emplace_back(std::uint64_t(1), ids[i]);
+        group.second.push_back(i);
+    }
+
+    std::shared_ptr<std::vector<naming::address> > addrs =
+        std::make_shared<std::vector<naming::address> >(ids.size());
+    if (groups.empty())
+        return make_ready_future(std::move(*addrs));
+
+    std::vector<future<void> > requests;
+    requests.reserve(groups.size());
+    for (auto& group : groups)
+    {
+        future<std::vector<primary_namespace::unbind_gid_response_type> > f =
+            primary_ns_.unbind_gid_bulk(group.second.first);
+
+        requests.push_back(f.then(util::bind(
+            util::one_shot(&addressing_service::unbind_bulk_postproc),
+            this, _1, std::move(group.second.first),
+            std::move(group.second.second), addrs)));
+    }
+
+    return hpx::when_all(requests).then(util::bind(
+            util::one_shot(&detail::get_bulk_results<naming::address>),
+            _1, addrs
+        ));
+}
+
 bool addressing_service::unbind_range_local(
     naming::gid_type const& lower_id
   , std::uint64_t count
@@ -1160,12 +1412,18 @@ hpx::future<naming::id_type> addressing_service::get_colocation_id_async(
 naming::address addressing_service::resolve_full_postproc(
     future<primary_namespace::resolved_type> f, naming::gid_type const& id
     )
+{
+    return resolve_full_update_cache(f.get(), id);
+}
+
+naming::address addressing_service::resolve_full_update_cache(
+    primary_namespace::resolved_type const& rep, naming::gid_type const& id
+    )
 {
     using hpx::util::get;
 
     naming::address addr;
 
-    auto rep = f.get();
     if (get<0>(rep) == naming::invalid_gid || get<2>(rep) == naming::invalid_gid)
     {
         HPX_THROW_EXCEPTION(bad_parameter,
@@ -1214,17 +1472,161 @@ hpx::future<naming::address> addressing_service::resolve_full_async(
         return make_ready_future(naming::address());
     }
 
+    using util::placeholders::_1;
+
+    if (cache_prefetch_ != 0 && naming::detail::store_in_cache(gid))
+    {
+        // speculatively resolve the ids following the requested one using
+        // the same request, stopping short of leaving the locality's id space
+        std::vector<naming::gid_type> ids;
+        ids.reserve(cache_prefetch_ + 1);
+        ids.push_back(gid);
+
+        naming::gid_type const id = naming::detail::get_stripped_gid(gid);
+        for (std::uint64_t i = 1; i <= cache_prefetch_; ++i)
+        {
+            if (id.get_lsb() + i < id.get_lsb())
+                break;
+            ids.push_back(id + i);
+        }
+
+        // neighbours which are being migrated are not waited for
+        future<std::vector<primary_namespace::resolved_type> > f =
+            primary_ns_.resolve_full_prefetch(ids);
+
+        return f.then(util::bind(
+                util::one_shot(&addressing_service::resolve_prefetch_postproc),
+                this, _1, std::move(ids)
+            ));
+    }
+
     // ask server
     future<primary_namespace::resolved_type> f =
         primary_ns_.resolve_full(gid);
 
-    using util::placeholders::_1;
     return f.then(util::bind(
             util::one_shot(&addressing_service::resolve_full_postproc),
             this, _1, gid
         ));
 }
 
+naming::address addressing_service::resolve_prefetch_postproc(
+    future<std::vector<primary_namespace::resolved_type> > f
+  , std::vector<naming::gid_type> const& ids
+    )
+{
+    using hpx::util::get;
+
+    std::vector<primary_namespace::resolved_type> rep = f.get();
+    HPX_ASSERT(!rep.empty() && rep.size() == ids.size());
+
+    // this throws if the requested id itself could not be resolved
+    naming::address addr = resolve_full_update_cache(rep[0], ids[0]);
+
+    // Cache the prefetched ids which are bound to the same component type,
+    // objects of other types might not be allowed to be cached (for instance
+    // if they support migration). Ids reported as unresolved are skipped,
+    // including those being migrated. Ranges are cached only once.
+    naming::gid_type last_base = get<0>(rep[0]);
+    for (std::size_t i = 1; i != rep.size(); ++i)
+    {
+        if (get<0>(rep[i]) == naming::invalid_gid ||
+            get<2>(rep[i]) == naming::invalid_gid ||
+            get<1>(rep[i]).type != get<1>(rep[0]).type)
+        {
+            continue;
+        }
+
+        if (range_caching_ && get<0>(rep[i]) == last_base)
+            continue;
+
+        last_base = get<0>(rep[i]);
+        resolve_full_update_cache(rep[i], ids[i]);
+    }
+
+    return addr;
+}
+
+void addressing_service::resolve_bulk_postproc(
+    future<std::vector<primary_namespace::resolved_type> > f
+  , std::vector<naming::gid_type> const& ids
+  , std::vector<std::size_t> const& indices
+  , std::shared_ptr<std::vector<naming::address> > const& addrs
+    )
+{
+    std::vector<primary_namespace::resolved_type> rep = f.get();
+    HPX_ASSERT(rep.size() == ids.size());
+
+    for (std::size_t i = 0; i != ids.size(); ++i)
+        (*addrs)[indices[i]] = resolve_full_update_cache(rep[i], ids[i]);
+}
+
+hpx::future<std::vector<naming::address> > addressing_service::resolve_bulk(
+    std::vector<naming::gid_type> const& ids
+    )
+{
+    std::shared_ptr<std::vector<naming::address> > addrs =
+        std::make_shared<std::vector<naming::address> >(ids.size());
+
+    // group all ids not found in the cache by the primary namespace instance
+    // managing them
+    typedef std::pair<
+            std::vector<naming::gid_type>, std::vector<std::size_t>
+        > request_group;
+    std::map<std::uint32_t, request_group> groups;
+
+    for (std::size_t i = 0; i != ids.size(); ++i)
+    {
+        if (!ids[i])
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "addressing_service::resolve_bulk",
+                "invalid reference id");
+            return make_ready_future(std::vector<naming::address>());
+        }
+
+        if (caching_)
+        {
+            error_code ec;
+            if (resolve_cached(ids[i], (*addrs)[i], ec))
+                continue;
+
+            if (ec)
+            {
+                return hpx::make_exceptional_future<
+                        std::vector<naming::address>
+                    >(hpx::detail::access_exception(ec));
+            }
+        }
+
+        request_group& group =
+            groups[naming::get_locality_id_from_gid(ids[i])];
+        group.first.push_back(ids[i]);
+        group.second.push_back(i);
+    }
+
+    if (groups.empty())
+        return make_ready_future(std::move(*addrs));
+
+    std::vector<future<void> > requests;
+    requests.reserve(groups.size());
+    for (auto& group : groups)
+    {
+        future<std::vector<primary_namespace::resolved_type> > f =
+            primary_ns_.resolve_full_bulk(group.second.first);
+
+        requests.push_back(f.then(util::bind(
+            util::one_shot(&addressing_service::resolve_bulk_postproc),
+            this, _1, std::move(group.second.first),
+            std::move(group.second.second), addrs)));
+    }
+
+    return hpx::when_all(requests).then(util::bind(
+            util::one_shot(&detail::get_bulk_results<naming::address>),
+            _1, addrs
+        ));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 bool addressing_service::resolve_full_local(
     naming::gid_type const* gids
@@ -1742,6 +2144,47 @@ bool check_for_collisions(
         || (new_key.get_count() != old_key.get_count());
 }
 
+std::size_t addressing_service::get_gva_cache_shard_index(
+    naming::gid_type const& id
+    ) const
+{
+    // all but the last shard are responsible for blocks of ids
+    std::size_t const num_shards = gva_cache_shards_.size();
+    if (num_shards == 1)
+        return 0;
+
+    naming::gid_type const gid = naming::detail::get_stripped_gid(id);
+
+    std::uint64_t hash = gid.get_msb() * 0x9e3779b97f4a7c15ull;
+    hash ^= gid.get_lsb() / detail::gva_cache_block_size;
+    hash ^= hash >> 32;
+
+    return std::size_t(hash % (num_shards - 1));
+}
+
+addressing_service::gva_cache_shard&
+addressing_service::get_gva_cache_shard(naming::gid_type const& id) const
+{
+    return *gva_cache_shards_[get_gva_cache_shard_index(id)];
+}
+
+std::size_t addressing_service::get_gva_cache_shard_index(
+    naming::gid_type const& id
+  , std::uint64_t count
+    ) const
+{
+    naming::gid_type const lower = naming::detail::get_stripped_gid(id);
+    naming::gid_type const upper = lower + (count - 1);
+
+    if (lower.get_msb() == upper.get_msb() &&
+        lower.get_lsb() / detail::gva_cache_block_size ==
+            upper.get_lsb() / detail::gva_cache_block_size)
+    {
+        return get_gva_cache_shard_index(lower);
+    }
+    return get_gva_cache_range_shard_index();
+}
+
 void addressing_service::update_cache_entry(
     naming::gid_type const& id
   , gva const& g
@@ -1806,9 +2249,15 @@ void addressing_service::update_cache_entry(
 
         const gva_cache_key key(gid, count);
 
+        std::size_t const shard_index = get_gva_cache_shard_index(gid, count);
+        if (shard_index == get_gva_cache_range_shard_index())
+            gva_cache_has_ranges_.store(true);
+
         {
-            std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-            if (!gva_cache_->update_if(key, g, check_for_collisions))
+            gva_cache_shard& shard = *gva_cache_shards_[shard_index];
+
+            std::lock_guard<mutex_type> lock(shard.mtx_);
+            if (!shard.cache_.update_if(key, g, check_for_collisions))
             {
                 if (LAGAS_ENABLED(warning))
                 {
@@ -1816,7 +2265,7 @@ void addressing_service::update_cache_entry(
                     addressing_service::gva_cache_key idbase;
                     addressing_service::gva_cache_type::entry_type e;
 
-                    if (!gva_cache_->get_entry(key, idbase, e))
+                    if (!shard.cache_.get_entry(key, idbase, e))
                     {
                         // This is impossible under sane conditions.
                         HPX_THROWS_IF(ec, invalid_data
@@ -1859,25 +2308,43 @@ bool addressing_service::get_cache_entry(
     gva_cache_key k(gid);
     gva_cache_key idbase_key;
 
-    std::unique_lock<mutex_type> lock(gva_cache_mtx_);
-    if(gva_cache_->get_entry(k, idbase_key, gva))
+    // look for ranges spanning several blocks only if the id is not found
+    // in the shard responsible for its block
+    std::size_t const shard_index = get_gva_cache_shard_index(gid);
+    if (!get_cache_entry(*gva_cache_shards_[shard_index], k, idbase_key, gva))
     {
-        const std::uint64_t id_msb =
-            naming::detail::strip_internal_bits_from_gid(gid.get_msb());
-
-        if (HPX_UNLIKELY(id_msb != idbase_key.get_gid().get_msb()))
+        std::size_t const range_shard_index = get_gva_cache_range_shard_index();
+        if (range_shard_index == shard_index || !gva_cache_has_ranges_.load() ||
+            !get_cache_entry(*gva_cache_shards_[range_shard_index], k,
+                idbase_key, gva))
         {
-            lock.unlock();
-            HPX_THROWS_IF(ec, internal_server_error
-              , "addressing_service::get_cache_entry"
-              , "bad entry in cache, MSBs of GID base and GID do not match");
             return false;
         }
-        idbase = idbase_key.get_gid();
-        return true;
     }
 
-    return false;
+    const std::uint64_t id_msb =
+        naming::detail::strip_internal_bits_from_gid(gid.get_msb());
+
+    if (HPX_UNLIKELY(id_msb != idbase_key.get_gid().get_msb()))
+    {
+        HPX_THROWS_IF(ec, internal_server_error
+          , "addressing_service::get_cache_entry"
+          , "bad entry in cache, MSBs of GID base and GID do not match");
+        return false;
+    }
+    idbase = idbase_key.get_gid();
+    return true;
+}
+
+bool addressing_service::get_cache_entry(
+    gva_cache_shard& shard
+  , gva_cache_key const& k
+  , gva_cache_key& idbase_key
+  , gva& gva
+    )
+{
+    std::lock_guard<mutex_type> lock(shard.mtx_);
+    return shard.cache_.get_entry(k, idbase_key, gva);
 }
 
 
@@ -1896,9 +2363,11 @@ void addressing_service::clear_cache(
     try {
         LAGAS_(warning) << "addressing_service::clear_cache, clearing cache";
 
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
-        gva_cache_->clear();
+        for (auto const& shard : gva_cache_shards_)
+        {
+            std::lock_guard<mutex_type> lock(shard->mtx_);
+            shard->cache_.clear();
+        }
 
         if (&ec != &throws)
             ec = make_success_code();
@@ -1943,13 +2412,25 @@ void addressing_service::remove_cache_entry(
     try {
         LAGAS_(warning) << "addressing_service::remove_cache_entry";
 
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
-        gva_cache_->erase(
-            [&gid](std::pair<gva_cache_key, gva> const& p)
+        auto erase_entry =
+            [&gid](gva_cache_shard& shard)
             {
-                return gid == p.first.get_gid();
-            });
+                std::lock_guard<mutex_type> lock(shard.mtx_);
+                shard.cache_.erase(
+                    [&gid](std::pair<gva_cache_key, gva> const& p)
+                    {
+                        return gid == p.first.get_gid();
+                    });
+            };
+
+        // the entry is stored either in the shard responsible for the block
+        // of the id or in the shard holding the ranges spanning several blocks
+        std::size_t const shard_index = get_gva_cache_shard_index(gid);
+        erase_entry(*gva_cache_shards_[shard_index]);
+
+        std::size_t const range_shard_index = get_gva_cache_range_shard_index();
+        if (range_shard_index != shard_index && gva_cache_has_ranges_.load())
+            erase_entry(*gva_cache_shards_[range_shard_index]);
 
         if (&ec != &throws)
             ec = make_success_code();
@@ -1959,6 +2440,82 @@ void addressing_service::remove_cache_entry(
     }
 }
 
+void addressing_service::remove_cache_entries(
+    std::vector<naming::gid_type> const& ids
+  , error_code& ec
+    )
+{
+    // If caching is disabled, we silently pretend success.
+    if (!caching_)
+    {
+        if (&ec != &throws)
+            ec = make_success_code();
+        return;
+    }
+
+    // group the cached ids by the shard responsible for their block, the
+    // same filters as for remove_cache_entry apply
+    std::map<std::size_t, std::set<naming::gid_type> > shard_ids;
+    for (naming::gid_type const& id : ids)
+    {
+        if (!naming::detail::store_in_cache(id))
+            continue;
+
+        naming::gid_type gid = naming::detail::get_stripped_gid(id);
+        if (naming::get_locality_id_from_gid(gid) ==
+            naming::get_locality_id_from_gid(locality_))
+        {
+            continue;
+        }
+
+        shard_ids[get_gva_cache_shard_index(gid)].insert(gid);
+    }
+
+    if (shard_ids.empty())
+    {
+        if (&ec != &throws)
+            ec = make_success_code();
+        return;
+    }
+
+    try {
+        LAGAS_(warning) << "addressing_service::remove_cache_entries";
+
+        // erase all entries of a shard in a single pass
+        auto erase_entries =
+            [](gva_cache_shard& shard, std::set<naming::gid_type> const& gids)
+            {
+                std::lock_guard<mutex_type> lock(shard.mtx_);
+                shard.cache_.erase(
+                    [&gids](std::pair<gva_cache_key, gva> const& p)
+                    {
+                        return gids.find(p.first.get_gid()) != gids.end();
+                    });
+            };
+
+        std::size_t const range_shard_index = get_gva_cache_range_shard_index();
+        std::set<naming::gid_type> range_gids;
+
+        for (auto const& entry : shard_ids)
+        {
+            erase_entries(*gva_cache_shards_[entry.first], entry.second);
+            if (entry.first != range_shard_index)
+                range_gids.insert(entry.second.begin(), entry.second.end());
+        }
+
+        // the shard holding the ranges spanning several blocks is visited
+        // only once for all ids
+        if (!range_gids.empty() && gva_cache_has_ranges_.load())
+            erase_entries(*gva_cache_shards_[range_shard_index], range_gids);
+
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+    catch (hpx::exception const& e) {
+        HPX_RETHROWS_IF(ec, e, "addressing_service::remove_cache_entries");
+    }
+}
+
 // Disable refcnt caching during shutdown
 void addressing_service::start_shutdown(error_code& ec)
 {
@@ -2094,81 +2651,120 @@ namespace detail
 // Helper functions to access the current cache statistics
 std::uint64_t addressing_service::get_cache_entries(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->size();
+    return detail::accumulate_gva_cache(gva_cache_shards_,
+        [&](gva_cache_type& cache) -> std::uint64_t
+        {
+            return cache.size();
+        });
 }
 
 std::uint64_t addressing_service::get_cache_hits(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().hits(reset);
+    return detail::accumulate_gva_cache(gva_cache_shards_,
+        [&](gva_cache_type& cache) -> std::uint64_t
+        {
+            return cache.get_statistics().hits(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_misses(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().misses(reset);
+    return detail::accumulate_gva_cache(gva_cache_shards_,
+        [&](gva_cache_type& cache) -> std::uint64_t
+        {
+            return cache.get_statistics().misses(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_evictions(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().evictions(reset);
+    return detail::accumulate_gva_cache(gva_cache_shards_,
+        [&](gva_cache_type& cache) -> std::uint64_t
+        {
+            return cache.get_statistics().evictions(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_insertions(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().insertions(reset);
+    return detail::accumulate_gva_cache(gva_cache_shards_,
+        [&](gva_cache_type& cache) -> std::uint64_t
+        {
+            return cache.get_statistics().insertions(reset);
+        });
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 std::uint64_t addressing_service::get_cache_get_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_get_entry_count(reset);
+    return detail::accumulate_gva_cache(gva_cache_shards_,
+        [&](gva_cache_type& cache) -> std::uint64_t
+        {
+            return cache.get_statistics().get_get_entry_count(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_insertion_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_insert_entry_count(reset);
+    return detail::accumulate_gva_cache(gva_cache_shards_,
+        [&](gva_cache_type& cache) -> std::uint64_t
+        {
+            return cache.get_statistics().get_insert_entry_count(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_update_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_update_entry_count(reset);
+    return detail::accumulate_gva_cache(gva_cache_shards_,
+        [&](gva_cache_type& cache) -> std::uint64_t
+        {
+            return cache.get_statistics().get_update_entry_count(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_erase_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_erase_entry_count(reset);
+    return detail::accumulate_gva_cache(gva_cache_shards_,
+        [&](gva_cache_type& cache) -> std::uint64_t
+        {
+            return cache.get_statistics().get_erase_entry_count(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_get_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_get_entry_time(reset);
+    return detail::accumulate_gva_cache(gva_cache_shards_,
+        [&](gva_cache_type& cache) -> std::uint64_t
+        {
+            return cache.get_statistics().get_get_entry_time(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_insertion_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_insert_entry_time(reset);
+    return detail::accumulate_gva_cache(gva_cache_shards_,
+        [&](gva_cache_type& cache) -> std::uint64_t
+        {
+            return cache.get_statistics().get_insert_entry_time(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_update_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_update_entry_time(reset);
+    return detail::accumulate_gva_cache(gva_cache_shards_,
+        [&](gva_cache_type& cache) -> std::uint64_t
+        {
+            return cache.get_statistics().get_update_entry_time(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_erase_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_erase_entry_time(reset);
+    return detail::accumulate_gva_cache(gva_cache_shards_,
+        [&](gva_cache_type& cache) -> std::uint64_t
+        {
+            return cache.get_statistics().get_erase_entry_time(reset);
+        });
 }
 
 /// Install performance counter types exposing properties from the local cache.
@@ -15,12 +15,15 @@
 #include <hpx/runtime/applier/apply_callback.hpp>
 #include <hpx/runtime/components/component_factory.hpp>
 #include <hpx/runtime/serialization/vector.hpp>
+#include <hpx/util/assert.hpp>
 
 #include <boost/format.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <utility>
+#include <vector>
 
 using hpx::components::component_agas_primary_namespace;
 
@@ -42,6 +45,11 @@ HPX_REGISTER_ACTION_ID(
     primary_namespace_bind_gid_action,
     hpx::actions::primary_namespace_bind_gid_action_id)
 
+HPX_REGISTER_ACTION_ID(
+    primary_namespace::bind_gid_bulk_action,
+    primary_namespace_bind_gid_bulk_action,
+    hpx::actions::primary_namespace_bind_gid_bulk_action_id)
+
 HPX_REGISTER_ACTION_ID(
     primary_namespace::begin_migration_action,
     primary_namespace_begin_migration_action,
@@ -67,6 +75,16 @@ HPX_REGISTER_ACTION_ID(
     primary_namespace_resolve_gid_action,
     hpx::actions::primary_namespace_resolve_gid_action_id)
 
+HPX_REGISTER_ACTION_ID(
+    primary_namespace::resolve_gid_bulk_action,
+    primary_namespace_resolve_gid_bulk_action,
+    hpx::actions::primary_namespace_resolve_gid_bulk_action_id)
+
+HPX_REGISTER_ACTION_ID(
+    primary_namespace::resolve_gid_prefetch_action,
+    primary_namespace_resolve_gid_prefetch_action,
+    hpx::actions::primary_namespace_resolve_gid_prefetch_action_id)
+
 HPX_REGISTER_ACTION_ID(
     primary_namespace::colocate_action,
     primary_namespace_colocate_action,
@@ -77,6 +95,11 @@ HPX_REGISTER_ACTION_ID(
     primary_namespace_unbind_gid_action,
     hpx::actions::primary_namespace_unbind_gid_action_id)
 
+HPX_REGISTER_ACTION_ID(
+    primary_namespace::unbind_gid_bulk_action,
+    primary_namespace_unbind_gid_bulk_action,
+    hpx::actions::primary_namespace_unbind_gid_bulk_action_id)
+
 HPX_REGISTER_ACTION_ID(
     primary_namespace::route_action,
     primary_namespace_route_action,
@@ -119,8 +142,8 @@ namespace hpx { namespace agas {
             == HPX_AGAS_PRIMARY_NS_MSB;
     }
 
-    primary_namespace::primary_namespace()
-      : server_(new server::primary_namespace())
+    primary_namespace::primary_namespace(std::size_t num_partitions)
+      : server_(new server::primary_namespace(num_partitions))
     {}
 
     primary_namespace::~primary_namespace()
@@ -190,6 +213,23 @@ namespace hpx { namespace agas {
         return hpx::async(action, std::move(dest), g, id, locality);
     }
 
+    future<std::vector<primary_namespace::bind_gid_response_type> >
+    primary_namespace::bind_gid_bulk(
+        std::vector<bind_gid_request_type> const& requests)
+    {
+        HPX_ASSERT(!requests.empty());
+
+        naming::id_type dest = naming::id_type(
+            get_service_instance(hpx::util::get<1>(requests.front())),
+            naming::id_type::unmanaged);
+        if (naming::get_locality_from_gid(dest.get_gid()) == hpx::get_locality())
+        {
+            return hpx::make_ready_future(server_->bind_gid_bulk(requests));
+        }
+        server::primary_namespace::bind_gid_bulk_action action;
+        return hpx::async(action, std::move(dest), requests);
+    }
+
     void primary_namespace::route(parcelset::parcel && p,
         util::function_nonser<void(boost::system::error_code const&,
         parcelset::parcel const&)> && f)
@@ -232,6 +272,38 @@ namespace hpx { namespace agas {
         return hpx::async(action, std::move(dest), id);
     }
 
+    future<std::vector<primary_namespace::resolved_type> >
+    primary_namespace::resolve_full_bulk(
+        std::vector<naming::gid_type> const& ids)
+    {
+        HPX_ASSERT(!ids.empty());
+
+        naming::id_type dest = naming::id_type(
+            get_service_instance(ids.front()), naming::id_type::unmanaged);
+        if (naming::get_locality_from_gid(dest.get_gid()) == hpx::get_locality())
+        {
+            return hpx::make_ready_future(server_->resolve_gid_bulk(ids));
+        }
+        server::primary_namespace::resolve_gid_bulk_action action;
+        return hpx::async(action, std::move(dest), ids);
+    }
+
+    future<std::vector<primary_namespace::resolved_type> >
+    primary_namespace::resolve_full_prefetch(
+        std::vector<naming::gid_type> const& ids)
+    {
+        HPX_ASSERT(!ids.empty());
+
+        naming::id_type dest = naming::id_type(
+            get_service_instance(ids.front()), naming::id_type::unmanaged);
+        if (naming::get_locality_from_gid(dest.get_gid()) == hpx::get_locality())
+        {
+            return hpx::make_ready_future(server_->resolve_gid_prefetch(ids));
+        }
+        server::primary_namespace::resolve_gid_prefetch_action action;
+        return hpx::async(action, std::move(dest), ids);
+    }
+
     hpx::future<id_type> primary_namespace::colocate(naming::gid_type id)
     {
         naming::id_type dest = naming::id_type(get_service_instance(id),
@@ -258,6 +330,32 @@ namespace hpx { namespace agas {
         return hpx::async(action, std::move(dest), count, stripped_id);
     }
 
+    future<std::vector<primary_namespace::unbind_gid_response_type> >
+    primary_namespace::unbind_gid_bulk(
+        std::vector<unbind_gid_request_type> const& requests)
+    {
+        HPX_ASSERT(!requests.empty());
+
+        naming::id_type dest = naming::id_type(
+            get_service_instance(hpx::util::get<1>(requests.front())),
+            naming::id_type::unmanaged);
+
+        std::vector<unbind_gid_request_type> stripped;
+        stripped.reserve(requests.size());
+        for (unbind_gid_request_type const& r : requests)
+        {
+            stripped.emplace_back(hpx::util::get<0>(r),
+                naming::detail::get_stripped_gid(hpx::util::get<1>(r)));
+        }
+
+        if (naming::get_locality_from_gid(dest.get_gid()) == hpx::get_locality())
+        {
+            return hpx::make_ready_future(server_->unbind_gid_bulk(stripped));
+        }
+        server::primary_namespace::unbind_gid_bulk_action action;
+        return hpx::async(action, std::move(dest), std::move(stripped));
+    }
+
     naming::address
     primary_namespace::unbind_gid(std::uint64_t count, naming::gid_type id)
     {
@@ -30,8 +30,10 @@
 #include <hpx/lcos/wait_all.hpp>
 
 #include <boost/atomic.hpp>
+#include <boost/exception_ptr.hpp>
 #include <boost/format.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <list>
@@ -220,6 +222,104 @@ serialization::binary_filter* primary_namespace::get_serialization_filter(
     return routed_p.get_serialization_filter();
 }
 
+///////////////////////////////////////////////////////////////////////////////
+namespace
+{
+    // Number of consecutive ids mapped onto the same partition of the tables.
+    // Bindings of ranges of ids which don't fit into a single block are
+    // stored in the range partition.
+    std::uint64_t const partition_block_size = 0x100;
+}
+
+primary_namespace::primary_namespace(std::size_t num_partitions)
+  : base_type(HPX_AGAS_PRIMARY_NS_MSB, HPX_AGAS_PRIMARY_NS_LSB)
+  , num_partitions_(num_partitions > 1 ? num_partitions + 1 : 1)
+  , partitions_(new partition[num_partitions_])
+  , has_range_bindings_(false)
+  , instance_name_()
+  , next_id_(naming::invalid_gid)
+  , locality_(naming::invalid_gid)
+{}
+
+std::size_t primary_namespace::get_partition_index(
+    naming::gid_type const& id
+    ) const
+{
+    // all but the last partition are responsible for blocks of ids
+    if (num_partitions_ == 1)
+        return 0;
+
+    std::uint64_t const msb =
+        naming::detail::strip_internal_bits_from_gid(id.get_msb());
+
+    std::uint64_t hash = msb * 0x9e3779b97f4a7c15ull;
+    hash ^= id.get_lsb() / partition_block_size;
+    hash ^= hash >> 32;
+
+    return std::size_t(hash % (num_partitions_ - 1));
+}
+
+primary_namespace::partition& primary_namespace::get_partition(
+    naming::gid_type const& id
+    )
+{
+    return partitions_[get_partition_index(id)];
+}
+
+std::size_t primary_namespace::get_partition_index(
+    naming::gid_type const& id
+  , std::uint64_t count
+    ) const
+{
+    std::uint64_t const last = id.get_lsb() + (count - 1);
+    if (last >= id.get_lsb() &&
+        id.get_lsb() / partition_block_size == last / partition_block_size)
+    {
+        return get_partition_index(id);
+    }
+    return get_range_partition_index();
+}
+
+std::vector<std::size_t> primary_namespace::get_partitions(
+    naming::gid_type const& id
+  , std::uint64_t count
+    ) const
+{
+    std::vector<std::size_t> result;
+    result.reserve(2);
+    result.push_back(get_partition_index(id));
+
+    // the range partition has the highest index, it needs to be looked at
+    // only if it holds any bindings or if the given range is stored there
+    std::size_t const range_index = get_range_partition_index();
+    if (result[0] != range_index &&
+        (has_range_bindings_.load() ||
+            get_partition_index(id, count) == range_index))
+    {
+        result.push_back(range_index);
+    }
+    return result;
+}
+
+primary_namespace::gva_table_type::const_iterator
+primary_namespace::find_binding(
+    gva_table_type const& gvas
+  , naming::gid_type const& id
+    )
+{
+    gva_table_type::const_iterator it = gvas.upper_bound(id);
+    if (it == gvas.begin())
+        return gvas.end();
+
+    // the binding with the largest id not larger than the given one either
+    // matches exactly or covers the given id with its range
+    --it;
+    if (it->first == id || (it->first + it->second.first.count) > id)
+        return it;
+
+    return gvas.end();
+}
+
 // start migration of the given object
 std::pair<naming::id_type, naming::address>
 primary_namespace::begin_migration(naming::gid_type id)
@@ -230,9 +330,10 @@ primary_namespace::begin_migration(naming::gid_type id)
     counter_data_.increment_begin_migration_count();
     using hpx::util::get;
 
-    std::unique_lock<mutex_type> l(mutex_);
+    partition& part = get_partition(id);
+    std::unique_lock<mutex_type> l(part.mutex_);
 
-    resolved_type r = resolve_gid_locked(l, id, hpx::throws);
+    resolved_type r = resolve_gid_locked(l, part, id, hpx::throws);
     if (get<0>(r) == naming::invalid_gid)
     {
         l.unlock();
@@ -244,11 +345,11 @@ primary_namespace::begin_migration(naming::gid_type id)
         return std::make_pair(naming::invalid_id, naming::address());
     }
 
-    migration_table_type::iterator it = migrating_objects_.find(id);
-    if (it == migrating_objects_.end())
+    migration_table_type::iterator it = part.migrating_objects_.find(id);
+    if (it == part.migrating_objects_.end())
     {
         std::pair<migration_table_type::iterator, bool> p =
-            migrating_objects_.emplace(std::piecewise_construct,
+            part.migrating_objects_.emplace(std::piecewise_construct,
                 std::forward_as_tuple(id), std::forward_as_tuple());
         HPX_ASSERT(p.second);
         it = p.first;
@@ -271,12 +372,13 @@ bool primary_namespace::end_migration(naming::gid_type id)
     );
     counter_data_.increment_end_migration_count();
 
-    std::lock_guard<mutex_type> l(mutex_);
+    partition& part = get_partition(id);
+    std::lock_guard<mutex_type> l(part.mutex_);
 
     using hpx::util::get;
 
-    migration_table_type::iterator it = migrating_objects_.find(id);
-    if (it == migrating_objects_.end() || !get<0>(it->second))
+    migration_table_type::iterator it = part.migrating_objects_.find(id);
+    if (it == part.migrating_objects_.end() || !get<0>(it->second))
         return false;
 
     get<2>(it->second).notify_all(hpx::throws);
@@ -287,9 +389,22 @@ bool primary_namespace::end_migration(naming::gid_type id)
     return true;
 }
 
+// return whether the given object is currently being migrated
+bool primary_namespace::is_migrating_locked(
+    std::unique_lock<mutex_type>& l
+  , partition& part
+  , naming::gid_type id)
+{
+    HPX_ASSERT_OWNS_LOCK(l);
+
+    migration_table_type::const_iterator it = part.migrating_objects_.find(id);
+    return it != part.migrating_objects_.end() && hpx::util::get<0>(it->second);
+}
+
 // wait if given object is currently being migrated
 void primary_namespace::wait_for_migration_locked(
     std::unique_lock<mutex_type>& l
+  , partition& part
   , naming::gid_type id
   , error_code& ec)
 {
@@ -297,15 +412,15 @@ void primary_namespace::wait_for_migration_locked(
 
     using hpx::util::get;
 
-    migration_table_type::iterator it = migrating_objects_.find(id);
-    if (it != migrating_objects_.end() && get<0>(it->second))
+    migration_table_type::iterator it = part.migrating_objects_.find(id);
+    if (it != part.migrating_objects_.end() && get<0>(it->second))
     {
         ++get<1>(it->second);
 
         get<2>(it->second).wait(l, ec);
 
         if (--get<1>(it->second) == 0 && !get<0>(it->second))
-            migrating_objects_.erase(it);
+            part.migrating_objects_.erase(it);
     }
 }
 
@@ -323,85 +438,102 @@ bool primary_namespace::bind_gid(
 
     naming::detail::strip_internal_bits_from_gid(id);
 
-    std::unique_lock<mutex_type> l(mutex_);
+    // A binding covering the new id might be stored in the partition of its
+    // block or in the range partition, lock both (in ascending order to avoid
+    // deadlocks).
+    std::size_t const home = get_partition_index(id, g.count ? g.count : 1);
+    std::vector<std::size_t> const parts =
+        get_partitions(id, g.count ? g.count : 1);
 
-    gva_table_type::iterator it = gvas_.lower_bound(id)
-                           , begin = gvas_.begin()
-                           , end = gvas_.end();
+    std::vector<std::unique_lock<mutex_type> > locks;
+    locks.reserve(parts.size());
+    for (std::size_t i : parts)
+        locks.emplace_back(partitions_[i].mutex_);
 
-    if (it != end)
+    bool update_binding = false;
+    for (std::size_t i : parts)
     {
-        // If we got an exact match, this is a request to update an existing
-        // binding (e.g. move semantics).
-        if (it->first == id)
-        {
-            gva& gaddr = it->second.first;
-            naming::gid_type& loc = it->second.second;
+        gva_table_type& gvas = partitions_[i].gvas_;
+        gva_table_type::iterator it = gvas.lower_bound(id)
+                               , begin = gvas.begin()
+                               , end = gvas.end();
 
-            // Check for count mismatch (we can't change block sizes of
-            // existing bindings).
-            if (HPX_UNLIKELY(gaddr.count != g.count))
+        if (it != end)
+        {
+            // If we got an exact match, this is a request to update an
+            // existing binding (e.g. move semantics).
+            if (it->first == id)
             {
-                // REVIEW: Is this the right error code to use?
-                l.unlock();
+                gva& gaddr = it->second.first;
 
-                HPX_THROW_EXCEPTION(bad_parameter
-                  , "primary_namespace::bind_gid"
-                  , "cannot change block size of existing binding");
-            }
+                // Check for count mismatch (we can't change block sizes of
+                // existing bindings).
+                if (HPX_UNLIKELY(gaddr.count != g.count))
+                {
+                    // REVIEW: Is this the right error code to use?
+                    locks.clear();
 
-            if (HPX_UNLIKELY(components::component_invalid == g.type))
-            {
-                l.unlock();
+                    HPX_THROW_EXCEPTION(bad_parameter
+                      , "primary_namespace::bind_gid"
+                      , "cannot change block size of existing binding");
+                }
 
-                HPX_THROW_EXCEPTION(bad_parameter
-                  , "primary_namespace::bind_gid"
-                  , boost::str(boost::format(
-                        "attempt to update a GVA with an invalid type, "
-                        "gid(%1%), gva(%2%), locality(%3%)")
-                        % id % g % locality));
-            }
+                if (HPX_UNLIKELY(components::component_invalid == g.type))
+                {
+                    locks.clear();
 
-            if (HPX_UNLIKELY(!locality))
-            {
-                l.unlock();
+                    HPX_THROW_EXCEPTION(bad_parameter
+                      , "primary_namespace::bind_gid"
+                      , boost::str(boost::format(
+                            "attempt to update a GVA with an invalid type, "
+                            "gid(%1%), gva(%2%), locality(%3%)")
+                            % id % g % locality));
+                }
 
-                HPX_THROW_EXCEPTION(bad_parameter
-                  , "primary_namespace::bind_gid"
-                  , boost::str(boost::format(
-                        "attempt to update a GVA with an invalid locality id, "
-                        "gid(%1%), gva(%2%), locality(%3%)")
-                        % id % g % locality));
-            }
+                if (HPX_UNLIKELY(!locality))
+                {
+                    locks.clear();
 
-            // Store the new endpoint and offset
-            gaddr.prefix = g.prefix;
-            gaddr.type   = g.type;
-            gaddr.lva(g.lva());
-            gaddr.offset = g.offset;
-            loc = locality;
+                    HPX_THROW_EXCEPTION(bad_parameter
+                      , "primary_namespace::bind_gid"
+                      , boost::str(boost::format(
+                            "attempt to update a GVA with an invalid locality "
+                            "id, gid(%1%), gva(%2%), locality(%3%)")
+                            % id % g % locality));
+                }
 
-            l.unlock();
+                update_binding = true;
+                continue;
+            }
 
-            LAGAS_(info) << (boost::format(
-                "primary_namespace::bind_gid, gid(%1%), gva(%2%), "
-                "locality(%3%), response(repeated_request)")
-                % id % g % locality);
+            // We're about to decrement the iterator it - first, we
+            // check that it's safe to do this.
+            else if (it != begin)
+            {
+                --it;
+
+                // Check that a previous range doesn't cover the new id.
+                if (HPX_UNLIKELY((it->first + it->second.first.count) > id))
+                {
+                    // REVIEW: Is this the right error code to use?
+                    locks.clear();
 
-            return false;
+                    HPX_THROW_EXCEPTION(bad_parameter
+                      , "primary_namespace::bind_gid"
+                      , "the new GID is contained in an existing range");
+                }
+            }
         }
 
-        // We're about to decrement the iterator it - first, we
-        // check that it's safe to do this.
-        else if (it != begin)
+        else if (HPX_LIKELY(!gvas.empty()))
         {
             --it;
 
             // Check that a previous range doesn't cover the new id.
-            if (HPX_UNLIKELY((it->first + it->second.first.count) > id))
+            if ((it->first + it->second.first.count) > id)
             {
                 // REVIEW: Is this the right error code to use?
-                l.unlock();
+                locks.clear();
 
                 HPX_THROW_EXCEPTION(bad_parameter
                   , "primary_namespace::bind_gid"
@@ -410,27 +542,38 @@ bool primary_namespace::bind_gid(
         }
     }
 
-    else if (HPX_LIKELY(!gvas_.empty()))
+    if (update_binding)
     {
-        --it;
-
-        // Check that a previous range doesn't cover the new id.
-        if ((it->first + it->second.first.count) > id)
+        // Store the new endpoint and offset
+        for (std::size_t i : parts)
         {
-            // REVIEW: Is this the right error code to use?
-            l.unlock();
+            gva_table_type::iterator it = partitions_[i].gvas_.find(id);
+            if (it == partitions_[i].gvas_.end())
+                continue;
 
-            HPX_THROW_EXCEPTION(bad_parameter
-              , "primary_namespace::bind_gid"
-              , "the new GID is contained in an existing range");
+            gva& gaddr = it->second.first;
+            gaddr.prefix = g.prefix;
+            gaddr.type   = g.type;
+            gaddr.lva(g.lva());
+            gaddr.offset = g.offset;
+            it->second.second = locality;
         }
+
+        locks.clear();
+
+        LAGAS_(info) << (boost::format(
+            "primary_namespace::bind_gid, gid(%1%), gva(%2%), "
+            "locality(%3%), response(repeated_request)")
+            % id % g % locality);
+
+        return false;
     }
 
     naming::gid_type upper_bound(id + (g.count - 1));
 
     if (HPX_UNLIKELY(id.get_msb() != upper_bound.get_msb()))
     {
-        l.unlock();
+        locks.clear();
 
         HPX_THROW_EXCEPTION(internal_server_error
           , "primary_namespace::bind_gid"
@@ -439,7 +582,7 @@ bool primary_namespace::bind_gid(
 
     if (HPX_UNLIKELY(components::component_invalid == g.type))
     {
-        l.unlock();
+        locks.clear();
 
         HPX_THROW_EXCEPTION(bad_parameter
           , "primary_namespace::bind_gid"
@@ -449,11 +592,14 @@ bool primary_namespace::bind_gid(
                 % id % g % locality));
     }
 
-    // Insert a GID -> GVA entry into the GVA table.
-    if (HPX_UNLIKELY(!util::insert_checked(gvas_.insert(
+    // Insert a GID -> GVA entry into the GVA table of its partition.
+    if (home == get_range_partition_index())
+        has_range_bindings_.store(true);
+
+    if (HPX_UNLIKELY(!util::insert_checked(partitions_[home].gvas_.insert(
             std::make_pair(id, std::make_pair(g, locality))))))
     {
-        l.unlock();
+        locks.clear();
 
         HPX_THROW_EXCEPTION(lock_error
           , "primary_namespace::bind_gid"
@@ -463,7 +609,7 @@ bool primary_namespace::bind_gid(
                 % id % g % locality));
     }
 
-    l.unlock();
+    locks.clear();
 
     LAGAS_(info) << (boost::format(
         "primary_namespace::bind_gid, gid(%1%), gva(%2%), locality(%3%)")
@@ -483,13 +629,14 @@ primary_namespace::resolved_type primary_namespace::resolve_gid(naming::gid_type
     resolved_type r;
 
     {
-        std::unique_lock<mutex_type> l(mutex_);
+        partition& part = get_partition(id);
+        std::unique_lock<mutex_type> l(part.mutex_);
 
         // wait for any migration to be completed
-        wait_for_migration_locked(l, id, hpx::throws);
+        wait_for_migration_locked(l, part, id, hpx::throws);
 
         // now, resolve the id
-        r = resolve_gid_locked(l, id, hpx::throws);
+        r = resolve_gid_locked(l, part, id, hpx::throws);
     }
 
     if (get<0>(r) == naming::invalid_gid)
@@ -527,27 +674,43 @@ naming::address primary_namespace::unbind_gid(
 
     naming::detail::strip_internal_bits_from_gid(id);
 
-    std::unique_lock<mutex_type> l(mutex_);
+    std::vector<std::size_t> const parts = get_partitions(id, count ? count : 1);
 
-    gva_table_type::iterator it = gvas_.find(id)
-                           , end = gvas_.end();
+    std::vector<std::unique_lock<mutex_type> > locks;
+    locks.reserve(parts.size());
+    for (std::size_t i : parts)
+        locks.emplace_back(partitions_[i].mutex_);
 
-    if (it != end)
+    // The binding is stored either in the partition of the block of the id
+    // or in the range partition, verify the block size before removing it.
+    gva_table_data_type data;
+    bool found = false;
+    for (std::size_t i : parts)
     {
+        gva_table_type::iterator it = partitions_[i].gvas_.find(id);
+        if (it == partitions_[i].gvas_.end())
+            continue;
+
         if (HPX_UNLIKELY(it->second.first.count != count))
         {
-            l.unlock();
+            locks.clear();
 
             HPX_THROW_EXCEPTION(bad_parameter
               , "primary_namespace::unbind_gid"
               , "block sizes must match");
         }
 
-        gva_table_data_type data = it->second;
+        data = it->second;
+        found = true;
+    }
+
+    if (found)
+    {
+        for (std::size_t i : parts)
+            partitions_[i].gvas_.erase(id);
 
-        gvas_.erase(it);
+        locks.clear();
 
-        l.unlock();
         LAGAS_(info) << (boost::format(
             "primary_namespace::unbind_gid, gid(%1%), count(%2%), gva(%3%), "
             "locality_id(%4%)")
@@ -557,7 +720,7 @@ naming::address primary_namespace::unbind_gid(
         return naming::address(g.prefix, g.type, g.lva());
     }
 
-    l.unlock();
+    locks.clear();
 
     LAGAS_(info) << (boost::format(
         "primary_namespace::unbind_gid, gid(%1%), count(%2%), "
@@ -567,6 +730,109 @@ naming::address primary_namespace::unbind_gid(
     return naming::address();
 } // }}}
 
+std::vector<primary_namespace::bind_gid_response_type>
+primary_namespace::bind_gid_bulk(
+    std::vector<bind_gid_request_type> const& requests
+    )
+{ // {{{ bind_gid_bulk implementation
+    using hpx::util::get;
+
+    std::vector<bind_gid_response_type> result;
+    result.reserve(requests.size());
+
+    // every request is accounted for separately by bind_gid, a failing
+    // request must not prevent the remaining ones from being handled
+    for (bind_gid_request_type const& r : requests)
+    {
+        try {
+            result.emplace_back(bind_gid(get<0>(r), get<1>(r), get<2>(r)),
+                boost::exception_ptr());
+        }
+        catch (...) {
+            result.emplace_back(false, boost::current_exception());
+        }
+    }
+
+    return result;
+} // }}}
+
+std::vector<primary_namespace::resolved_type>
+primary_namespace::resolve_gid_bulk(
+    std::vector<naming::gid_type> const& ids
+    )
+{ // {{{ resolve_gid_bulk implementation
+    std::vector<resolved_type> result;
+    result.reserve(ids.size());
+
+    for (naming::gid_type const& id : ids)
+        result.push_back(resolve_gid(id));
+
+    return result;
+} // }}}
+
+std::vector<primary_namespace::resolved_type>
+primary_namespace::resolve_gid_prefetch(
+    std::vector<naming::gid_type> const& ids
+    )
+{ // {{{ resolve_gid_prefetch implementation
+    HPX_ASSERT(!ids.empty());
+
+    std::vector<resolved_type> result;
+    result.reserve(ids.size());
+
+    // the requested id waits for any migration to be completed
+    result.push_back(resolve_gid(ids.front()));
+
+    for (std::size_t i = 1; i != ids.size(); ++i)
+    {
+        partition& part = get_partition(ids[i]);
+        std::unique_lock<mutex_type> l(part.mutex_);
+
+        // Don't wait for the migration of a neighbour, report it as
+        // unresolved instead to prevent it from being cached. Neighbours
+        // which can't be resolved are reported as unresolved as well.
+        error_code ec(lightweight);
+        resolved_type r;
+        if (!is_migrating_locked(l, part, ids[i]))
+            r = resolve_gid_locked(l, part, ids[i], ec);
+
+        if (ec || hpx::util::get<0>(r) == naming::invalid_gid)
+        {
+            result.emplace_back(naming::invalid_gid, gva(),
+                naming::invalid_gid);
+            continue;
+        }
+
+        result.push_back(r);
+    }
+
+    return result;
+} // }}}
+
+std::vector<primary_namespace::unbind_gid_response_type>
+primary_namespace::unbind_gid_bulk(
+    std::vector<unbind_gid_request_type> const& requests
+    )
+{ // {{{ unbind_gid_bulk implementation
+    using hpx::util::get;
+
+    std::vector<unbind_gid_response_type> result;
+    result.reserve(requests.size());
+
+    for (unbind_gid_request_type const& r : requests)
+    {
+        try {
+            result.emplace_back(unbind_gid(get<0>(r), get<1>(r)),
+                boost::exception_ptr());
+        }
+        catch (...) {
+            result.emplace_back(naming::address(), boost::current_exception());
+        }
+    }
+
+    return result;
+} // }}}
+
 std::int64_t primary_namespace::increment_credit(
     std::int64_t credits
   , naming::gid_type lower
@@ -658,17 +924,22 @@ std::pair<naming::gid_type, naming::gid_type> primary_namespace::allocate(
 
     std::uint64_t const real_count = (count) ? (count - 1) : (0);
 
+    std::unique_lock<mutex_type> l(allocate_mutex_);
+
     // Just return the prefix
     // REVIEW: Should this be an error?
     if (0 == count)
     {
+        naming::gid_type const next_id = next_id_;
+        l.unlock();
+
         LAGAS_(info) << (boost::format(
             "primary_namespace::allocate, count(%1%), "
             "lower(%1%), upper(%3%), prefix(%4%), response(repeated_request)")
-            % count % next_id_ % next_id_
-            % naming::get_locality_id_from_gid(next_id_));
+            % count % next_id % next_id
+            % naming::get_locality_id_from_gid(next_id));
 
-        return std::make_pair(next_id_, next_id_);
+        return std::make_pair(next_id, next_id);
     }
 
     // Compute the new allocation.
@@ -685,6 +956,8 @@ std::pair<naming::gid_type, naming::gid_type> primary_namespace::allocate(
                 naming::gid_type::virtual_memory_mask)
            )
         {
+            l.unlock();
+
             HPX_THROW_EXCEPTION(internal_server_error
                 , "locality_namespace::allocate"
                 , "primary namespace has been exhausted");
@@ -698,6 +971,8 @@ std::pair<naming::gid_type, naming::gid_type> primary_namespace::allocate(
     // Store the new upper bound.
     next_id_ = upper;
 
+    l.unlock();
+
     // Set the initial credit count.
     naming::detail::set_credit_for_gid(lower, std::int64_t(HPX_GLOBALCREDIT_INITIAL));
     naming::detail::set_credit_for_gid(upper, std::int64_t(HPX_GLOBALCREDIT_INITIAL));
@@ -712,7 +987,8 @@ std::pair<naming::gid_type, naming::gid_type> primary_namespace::allocate(
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     void primary_namespace::dump_refcnt_matches(
-        refcnt_table_type::iterator lower_it
+        partition& part
+      , refcnt_table_type::iterator lower_it
       , refcnt_table_type::iterator upper_it
       , naming::gid_type const& lower
       , naming::gid_type const& upper
@@ -722,7 +998,7 @@ std::pair<naming::gid_type, naming::gid_type> primary_namespace::allocate(
     { // dump_refcnt_matches implementation
         HPX_ASSERT(l.owns_lock());
 
-        if (lower_it == refcnts_.end() && upper_it == refcnts_.end())
+        if (lower_it == part.refcnts_.end() && upper_it == part.refcnts_.end())
             // We got nothing, bail - our caller is probably about to throw.
             return;
 
@@ -754,19 +1030,20 @@ void primary_namespace::increment(
   , error_code& ec
     )
 { // {{{ increment implementation
-    std::unique_lock<mutex_type> l(mutex_);
-
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     if (LAGAS_ENABLED(debug))
     {
         typedef refcnt_table_type::iterator iterator;
 
+        partition& part = get_partition(lower);
+        std::unique_lock<mutex_type> l(part.mutex_);
+
         // Find the mappings that we're about to touch.
-        refcnt_table_type::iterator lower_it = refcnts_.find(lower);
+        refcnt_table_type::iterator lower_it = part.refcnts_.find(lower);
         refcnt_table_type::iterator upper_it;
         if (lower != upper)
         {
-            upper_it = refcnts_.find(upper);
+            upper_it = part.refcnts_.find(upper);
         }
         else
         {
@@ -774,7 +1051,7 @@ void primary_namespace::increment(
             ++upper_it;
         }
 
-        dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
+        dump_refcnt_matches(part, lower_it, upper_it, lower, upper, l,
             "primary_namespace::increment");
     }
 #endif
@@ -791,14 +1068,18 @@ void primary_namespace::increment(
 
     for (naming::gid_type raw = lower; raw != upper; ++raw)
     {
-        refcnt_table_type::iterator it = refcnts_.find(raw);
-        if (it == refcnts_.end())
+        partition& part = get_partition(raw);
+        std::unique_lock<mutex_type> l(part.mutex_);
+
+        refcnt_table_type::iterator it = part.refcnts_.find(raw);
+        if (it == part.refcnts_.end())
         {
             std::int64_t count =
                 std::int64_t(HPX_GLOBALCREDIT_INITIAL) + credits;
 
             std::pair<refcnt_table_type::iterator, bool> p =
-                refcnts_.insert(refcnt_table_type::value_type(raw, count));
+                part.refcnts_.insert(
+                    refcnt_table_type::value_type(raw, count));
             if (!p.second)
             {
                 l.unlock();
@@ -831,6 +1112,7 @@ void primary_namespace::increment(
 ///////////////////////////////////////////////////////////////////////////////
 void primary_namespace::resolve_free_list(
     std::unique_lock<mutex_type>& l
+  , partition& part
   , std::list<refcnt_table_type::iterator> const& free_list
   , std::list<free_entry>& free_entry_list
   , naming::gid_type const& lower
@@ -852,10 +1134,10 @@ void primary_namespace::resolve_free_list(
         key_type gid = it->first;
 
         // wait for any migration to be completed
-        wait_for_migration_locked(l, gid, ec);
+        wait_for_migration_locked(l, part, gid, ec);
 
         // Resolve the query GID.
-        resolved_type r = resolve_gid_locked(l, gid, ec);
+        resolved_type r = resolve_gid_locked(l, part, gid, ec);
         if (ec) return;
 
         naming::gid_type& raw = get<0>(r);
@@ -914,7 +1196,7 @@ void primary_namespace::resolve_free_list(
         free_entry_list.push_back(free_entry(resolved, gid, get<2>(r)));
 
         // remove this entry from the refcnt table
-        refcnts_.erase(it);
+        part.refcnts_.erase(it);
     }
 }
 
@@ -934,109 +1216,115 @@ void primary_namespace::decrement_sweep(
 
     free_entry_list.clear();
 
-    {
-        std::unique_lock<mutex_type> l(mutex_);
-
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-        if (LAGAS_ENABLED(debug))
-        {
-            typedef refcnt_table_type::iterator iterator;
+    if (LAGAS_ENABLED(debug))
+    {
+        typedef refcnt_table_type::iterator iterator;
 
-            // Find the mappings that we just added or modified.
-            refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-            refcnt_table_type::iterator upper_it;
-            if (lower != upper)
-            {
-                upper_it = refcnts_.find(upper);
-            }
-            else
-            {
-                upper_it = lower_it;
-                ++upper_it;
-            }
+        partition& part = get_partition(lower);
+        std::unique_lock<mutex_type> l(part.mutex_);
 
-            dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-                "primary_namespace::decrement_sweep");
+        // Find the mappings that we just added or modified.
+        refcnt_table_type::iterator lower_it = part.refcnts_.find(lower);
+        refcnt_table_type::iterator upper_it;
+        if (lower != upper)
+        {
+            upper_it = part.refcnts_.find(upper);
         }
-#endif
-
-        ///////////////////////////////////////////////////////////////////////
-        // Apply the decrement across the entire key space (e.g. [lower, upper]).
-
-        // The third parameter we pass here is the default data to use in case
-        // the key is not mapped. We don't insert GIDs into the refcnt table
-        // when we allocate/bind them, so if a GID is not in the refcnt table,
-        // we know that it's global reference count is the initial global
-        // reference count.
-
-        std::list<refcnt_table_type::iterator> free_list;
-        for (naming::gid_type raw = lower; raw != upper; ++raw)
+        else
         {
-            refcnt_table_type::iterator it = refcnts_.find(raw);
-            if (it == refcnts_.end())
-            {
-                if (credits > std::int64_t(HPX_GLOBALCREDIT_INITIAL))
-                {
-                    l.unlock();
+            upper_it = lower_it;
+            ++upper_it;
+        }
 
-                    HPX_THROWS_IF(ec, invalid_data
-                      , "primary_namespace::decrement_sweep"
-                      , boost::str(boost::format(
-                            "negative entry in reference count table, raw(%1%), "
-                            "refcount(%2%)")
-                            % raw
-                            % (std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits)));
-                    return;
-                }
+        dump_refcnt_matches(part, lower_it, upper_it, lower, upper, l,
+            "primary_namespace::decrement_sweep");
+    }
+#endif
 
-                std::int64_t count =
-                    std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits;
+    ///////////////////////////////////////////////////////////////////////////
+    // Apply the decrement across the entire key space (e.g. [lower, upper]).
 
-                std::pair<refcnt_table_type::iterator, bool> p =
-                    refcnts_.insert(refcnt_table_type::value_type(raw, count));
-                if (!p.second)
-                {
-                    l.unlock();
+    // The third parameter we pass here is the default data to use in case
+    // the key is not mapped. We don't insert GIDs into the refcnt table
+    // when we allocate/bind them, so if a GID is not in the refcnt table,
+    // we know that it's global reference count is the initial global
+    // reference count.
 
-                    HPX_THROWS_IF(ec, invalid_data
-                      , "primary_namespace::decrement_sweep"
-                      , boost::str(boost::format(
-                            "couldn't create entry in reference count table, "
-                            "raw(%1%), ref-count(%3%)")
-                            % raw % count));
-                    return;
-                }
+    for (naming::gid_type raw = lower; raw != upper; ++raw)
+    {
+        partition& part = get_partition(raw);
+        std::unique_lock<mutex_type> l(part.mutex_);
 
-                it = p.first;
-            }
-            else
+        refcnt_table_type::iterator it = part.refcnts_.find(raw);
+        if (it == part.refcnts_.end())
+        {
+            if (credits > std::int64_t(HPX_GLOBALCREDIT_INITIAL))
             {
-                it->second -= credits;
+                l.unlock();
+
+                HPX_THROWS_IF(ec, invalid_data
+                  , "primary_namespace::decrement_sweep"
+                  , boost::str(boost::format(
+                        "negative entry in reference count table, raw(%1%), "
+                        "refcount(%2%)")
+                        % raw
+                        % (std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits)));
+                return;
             }
 
-            // Sanity check.
-            if (it->second < 0)
+            std::int64_t count =
+                std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits;
+
+            std::pair<refcnt_table_type::iterator, bool> p =
+                part.refcnts_.insert(
+                    refcnt_table_type::value_type(raw, count));
+            if (!p.second)
             {
                 l.unlock();
 
                 HPX_THROWS_IF(ec, invalid_data
                   , "primary_namespace::decrement_sweep"
                   , boost::str(boost::format(
-                        "negative entry in reference count table, raw(%1%), "
-                        "refcount(%2%)")
-                        % raw % it->second));
+                        "couldn't create entry in reference count table, "
+                        "raw(%1%), ref-count(%3%)")
+                        % raw % count));
                 return;
             }
 
-            // this objects needs to be deleted
-            if (it->second == 0)
-                free_list.push_back(it);
+            it = p.first;
+        }
+        else
+        {
+            it->second -= credits;
+        }
+
+        // Sanity check.
+        if (it->second < 0)
+        {
+            l.unlock();
+
+            HPX_THROWS_IF(ec, invalid_data
+              , "primary_namespace::decrement_sweep"
+              , boost::str(boost::format(
+                    "negative entry in reference count table, raw(%1%), "
+                    "refcount(%2%)")
+                    % raw % it->second));
+            return;
         }
 
-        // Resolve the objects which have to be deleted.
-        resolve_free_list(l, free_list, free_entry_list, lower, upper, ec);
+        // this objects needs to be deleted, resolve it while still holding
+        // the lock of its partition
+        if (it->second == 0)
+        {
+            std::list<refcnt_table_type::iterator> free_list;
+            free_list.push_back(it);
 
-    } // Unlock the mutex.
+            resolve_free_list(l, part, free_list, free_entry_list, lower,
+                upper, ec);
+            if (ec) return;
+        }
+    }
 
     if (&ec != &throws)
         ec = make_success_code();
@@ -1105,6 +1393,7 @@ void primary_namespace::free_components_sync(
 
 primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
     std::unique_lock<mutex_type>& l
+  , partition& part
   , naming::gid_type const& gid
   , error_code& ec
     )
@@ -1115,60 +1404,12 @@ primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
     naming::gid_type id = gid;
     naming::detail::strip_internal_bits_from_gid(id);
 
-    gva_table_type::const_iterator it = gvas_.lower_bound(id)
-                                 , begin = gvas_.begin()
-                                 , end = gvas_.end();
-
-    if (it != end)
-    {
-        // Check for exact match
-        if (it->first == id)
-        {
-            if (&ec != &throws)
-                ec = make_success_code();
-
-            gva_table_data_type const& data = it->second;
-            return resolved_type(it->first, data.first, data.second);
-        }
-
-        // We need to decrement the iterator, first we check that it's safe
-        // to do this.
-        else if (it != begin)
+    auto resolved =
+        [&](gva_table_type::const_iterator it) -> resolved_type
         {
-            --it;
-
             // Found the GID in a range
-            gva_table_data_type const& data = it->second;
-            if ((it->first + data.first.count) > id)
-            {
-                if (HPX_UNLIKELY(id.get_msb() != it->first.get_msb()))
-                {
-                    l.unlock();
-
-                    HPX_THROWS_IF(ec, internal_server_error
-                      , "primary_namespace::resolve_gid_locked"
-                      , "MSBs of lower and upper range bound do not match");
-                    return resolved_type(naming::invalid_gid, gva(),
-                        naming::invalid_gid);
-                }
-
-                if (&ec != &throws)
-                    ec = make_success_code();
-
-                return resolved_type(it->first, data.first, data.second);
-            }
-        }
-    }
-
-    else if (HPX_LIKELY(!gvas_.empty()))
-    {
-        --it;
-
-        // Found the GID in a range
-        gva_table_data_type const& data = it->second;
-        if ((it->first + data.first.count) > id)
-        {
-            if (HPX_UNLIKELY(id.get_msb() != it->first.get_msb()))
+            if (HPX_UNLIKELY(it->first != id &&
+                id.get_msb() != it->first.get_msb()))
             {
                 l.unlock();
 
@@ -1182,8 +1423,24 @@ primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
             if (&ec != &throws)
                 ec = make_success_code();
 
+            gva_table_data_type const& data = it->second;
             return resolved_type(it->first, data.first, data.second);
-        }
+        };
+
+    gva_table_type::const_iterator it = find_binding(part.gvas_, id);
+    if (it != part.gvas_.end())
+        return resolved(it);
+
+    // The id might be covered by a range spanning several blocks. The range
+    // partition is always locked after the partition of the id.
+    partition& range_part = partitions_[get_range_partition_index()];
+    if (&range_part != &part && has_range_bindings_.load())
+    {
+        std::lock_guard<mutex_type> range_l(range_part.mutex_);
+
+        it = find_binding(range_part.gvas_, id);
+        if (it != range_part.gvas_.end())
+            return resolved(it);
     }
 
     if (&ec != &throws)
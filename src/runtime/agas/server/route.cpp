@@ -41,12 +41,13 @@ namespace hpx { namespace agas { namespace server
         // resolve destination addresses, we should be able to resolve all of
         // them, otherwise it's an error
         {
-            std::unique_lock<mutex_type> l(mutex_);
+            partition& part = get_partition(gid);
+            std::unique_lock<mutex_type> l(part.mutex_);
 
             // wait for any migration to be completed
-            wait_for_migration_locked(l, gid, ec);
+            wait_for_migration_locked(l, part, gid, ec);
 
-            cache_address = resolve_gid_locked(l, gid, ec);
+            cache_address = resolve_gid_locked(l, part, gid, ec);
 
             if (ec || hpx::util::get<0>(cache_address) == naming::invalid_gid)
             {
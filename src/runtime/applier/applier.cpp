@@ -50,18 +50,21 @@ namespace hpx { namespace applier
         return threads::thread_result_type(threads::terminated, nullptr);
     }
 
-    static inline threads::thread_result_type thread_function_nullary(
-        util::unique_function_nonser<void()> func)
+    namespace detail
     {
-        // execute the actual thread function
-        func();
+        threads::thread_result_type thread_function_nullary(
+            util::unique_function_nonser<void()> func)
+        {
+            // execute the actual thread function
+            func();
 
-        // Verify that there are no more registered locks for this
-        // OS-thread. This will throw if there are still any locks
-        // held.
-        util::force_error_on_lock();
+            // Verify that there are no more registered locks for this
+            // OS-thread. This will throw if there are still any locks
+            // held.
+            util::force_error_on_lock();
 
-        return threads::thread_result_type(threads::terminated, nullptr);
+            return threads::thread_result_type(threads::terminated, nullptr);
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -85,7 +88,8 @@ namespace hpx { namespace applier
             desc ? desc : util::thread_description(func, "register_thread_nullary");
 
         threads::thread_init_data data(
-            util::bind(util::one_shot(&thread_function_nullary), std::move(func)),
+            util::bind(util::one_shot(&detail::thread_function_nullary),
+                std::move(func)),
             d, 0, priority, os_thread, threads::get_stack_size(stacksize));
 
         threads::thread_id_type id = threads::invalid_thread_id;
@@ -93,6 +97,41 @@ namespace hpx { namespace applier
         return id;
     }
 
+    void register_thread_nullary_bulk(
+        std::vector<util::unique_function_nonser<void()> > && funcs,
+        util::thread_description const& desc,
+        threads::thread_state_enum state, threads::thread_priority priority,
+        std::size_t os_thread, threads::thread_stacksize stacksize,
+        error_code& ec)
+    {
+        hpx::applier::applier* app = hpx::applier::get_applier_ptr();
+        if (nullptr == app)
+        {
+            HPX_THROWS_IF(ec, invalid_status,
+                "hpx::applier::register_thread_nullary_bulk",
+                "global applier object is not accessible");
+            return;
+        }
+
+        // stage all thread descriptions contiguously
+        std::vector<threads::thread_init_data> data;
+        data.reserve(funcs.size());
+
+        std::ptrdiff_t stack_size = threads::get_stack_size(stacksize);
+        for (util::unique_function_nonser<void()>& func : funcs)
+        {
+            util::thread_description d = desc ? desc :
+                util::thread_description(func, "register_thread_nullary_bulk");
+
+            data.emplace_back(
+                util::bind(util::one_shot(&detail::thread_function_nullary),
+                    std::move(func)),
+                d, 0, priority, os_thread, stack_size);
+        }
+
+        app->get_thread_manager().register_thread_bulk(data, state, ec);
+    }
+
     threads::thread_id_type register_thread(
         util::unique_function_nonser<void(threads::thread_state_ex_enum)> && func,
         util::thread_description const& desc, threads::thread_state_enum state,
@@ -185,7 +224,8 @@ namespace hpx { namespace applier
             desc ? desc : util::thread_description(func, "register_thread_nullary");
 
         threads::thread_init_data data(
-            util::bind(util::one_shot(&thread_function_nullary), std::move(func)),
+            util::bind(util::one_shot(&detail::thread_function_nullary),
+                std::move(func)),
             d, 0, priority, os_thread, threads::get_stack_size(stacksize));
 
         app->get_thread_manager().register_work(data, state, ec);
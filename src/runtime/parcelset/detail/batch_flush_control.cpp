@@ -0,0 +1,53 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/parcelset/detail/batch_flush_control.hpp>
+#include <hpx/runtime/parcelset/policies/message_handler.hpp>
+#include <hpx/util/function.hpp>
+#include <hpx/util/steady_clock.hpp>
+
+#include <string>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    batch_flush_control::batch_flush_control(
+            util::function_nonser<bool()> const& on_timer,
+            util::function_nonser<void()> const& on_terminate,
+            std::string const& description, bool allow_background_flush)
+      : timer_(on_timer, on_terminate, description),
+        stopped_(false),
+        allow_background_flush_(allow_background_flush)
+    {}
+
+    void batch_flush_control::start_timer(
+        util::steady_duration const& interval)
+    {
+        if (!timer_.is_started())
+            timer_.start(interval);
+    }
+
+    bool batch_flush_control::prepare_flush(
+        policies::message_handler::flush_mode mode, bool stop_buffering,
+        bool cancel_timer)
+    {
+        // proceed with background work only if explicitly allowed, the batch
+        // is always flushed if buffering has to stop
+        if (!allow_background_flush_ && !stop_buffering &&
+            mode == policies::message_handler::flush_mode_background_work)
+        {
+            return false;
+        }
+
+        if (!stopped_ && stop_buffering)
+        {
+            stopped_ = true;
+            timer_.stop();              // interrupt timer
+        }
+        else if (cancel_timer)
+        {
+            timer_.stop();              // interrupt timer
+        }
+        return true;
+    }
+}}}
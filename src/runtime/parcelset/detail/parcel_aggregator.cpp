@@ -0,0 +1,158 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/parcelset/detail/parcel_aggregator.hpp>
+#include <hpx/runtime/parcelset/parcelport.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/bind.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    parcel_aggregator::parcel_aggregator(parcelport* pp, locality const& dest,
+            std::size_t max_parcels, std::size_t interval,
+            bool allow_background_flush)
+      : pp_(pp),
+        dest_(dest),
+        max_parcels_(max_parcels),
+        interval_(interval),
+        flush_control_(
+            util::bind(&parcel_aggregator::timer_flush, this),
+            util::bind(&parcel_aggregator::flush_terminate, this),
+            "parcel_aggregator_timer", allow_background_flush),
+        last_parcel_time_(util::high_resolution_clock::now()),
+        num_parcels_(0),
+        num_messages_(0)
+    {
+        parcels_.reserve(max_parcels_);
+        handlers_.reserve(max_parcels_);
+    }
+
+    void parcel_aggregator::put_parcel(locality const& dest, parcel p,
+        write_handler_type f)
+    {
+        HPX_ASSERT(dest == dest_);
+
+        std::unique_lock<mutex_type> l(mtx_);
+        ++num_parcels_;
+
+        std::int64_t parcel_time = util::high_resolution_clock::now();
+        std::int64_t time_since_last_parcel = parcel_time - last_parcel_time_;
+        last_parcel_time_ = parcel_time;
+
+        std::chrono::microseconds interval(interval_);
+
+        // there is nothing to aggregate with if the traffic to this
+        // destination is sparse
+        if (flush_control_.stopped() ||
+            (parcels_.empty() &&
+                std::chrono::nanoseconds(time_since_last_parcel) > interval))
+        {
+            ++num_messages_;
+            l.unlock();
+
+            pp_->put_parcel(dest, std::move(p), std::move(f));
+            return;
+        }
+
+        parcels_.push_back(std::move(p));
+        handlers_.push_back(std::move(f));
+
+        if (parcels_.size() >= max_parcels_)
+        {
+            flush_locked(l, policies::message_handler::flush_mode_buffer_full,
+                false, true);
+            return;
+        }
+
+        if (parcels_.size() == 1 || !flush_control_.is_timer_started())
+        {
+            // start deadline timer to flush the batch
+            l.unlock();
+            flush_control_.start_timer(interval);
+        }
+    }
+
+    bool parcel_aggregator::timer_flush()
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+        if (!parcels_.empty())
+        {
+            flush_locked(l, policies::message_handler::flush_mode_timer,
+                false, false);
+        }
+
+        // do not restart timer, will be restarted on next parcel
+        return false;
+    }
+
+    void parcel_aggregator::flush_terminate()
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+        flush_locked(l, policies::message_handler::flush_mode_timer,
+            true, true);
+    }
+
+    bool parcel_aggregator::flush(
+        policies::message_handler::flush_mode mode, bool stop_buffering)
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+        return flush_locked(l, mode, stop_buffering, true);
+    }
+
+    bool parcel_aggregator::flush_locked(std::unique_lock<mutex_type>& l,
+        policies::message_handler::flush_mode mode,
+        bool stop_buffering, bool cancel_timer)
+    {
+        HPX_ASSERT(l.owns_lock());
+
+        if (!flush_control_.prepare_flush(mode, stop_buffering, cancel_timer) ||
+            parcels_.empty())
+            return false;
+
+        std::vector<parcel> parcels;
+        std::vector<write_handler_type> handlers;
+        parcels.reserve(max_parcels_);
+        handlers.reserve(max_parcels_);
+
+        std::swap(parcels, parcels_);
+        std::swap(handlers, handlers_);
+
+        ++num_messages_;
+        l.unlock();
+
+        HPX_ASSERT(nullptr != pp_);
+        if (parcels.size() == 1)
+        {
+            pp_->put_parcel(dest_, std::move(parcels[0]),
+                std::move(handlers[0]));
+        }
+        else
+        {
+            pp_->put_parcels(dest_, std::move(parcels), std::move(handlers));
+        }
+        return true;
+    }
+
+    std::int64_t parcel_aggregator::get_parcels_count(bool reset)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return util::get_and_reset_value(num_parcels_, reset);
+    }
+
+    std::int64_t parcel_aggregator::get_messages_count(bool reset)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return util::get_and_reset_value(num_messages_, reset);
+    }
+}}}
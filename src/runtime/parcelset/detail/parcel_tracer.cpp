@@ -0,0 +1,248 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/actions/action_support.hpp>
+#include <hpx/runtime/get_config_entry.hpp>
+#include <hpx/runtime/get_locality_id.hpp>
+#include <hpx/runtime/get_os_thread_count.hpp>
+#include <hpx/runtime/get_worker_thread_num.hpp>
+#include <hpx/runtime/parcelset/detail/parcel_tracer.hpp>
+#include <hpx/runtime/parcelset/parcel.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/safe_lexical_cast.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    namespace
+    {
+        char const* const stage_names[] =
+        {
+            "enqueue", "encode", "send", "receive", "decode", "schedule"
+        };
+
+        // action names are C++ type names, make sure they don't break the
+        // JSON output nevertheless
+        std::string escape_json(char const* str)
+        {
+            std::string result;
+            for (/**/; str != nullptr && *str != '\0'; ++str)
+            {
+                if (*str == '"' || *str == '\\')
+                    result += '\\';
+                result += *str;
+            }
+            return result;
+        }
+    }
+
+    parcel_tracer::parcel_tracer()
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+      : enabled_(util::safe_lexical_cast<int>(
+            get_config_entry("hpx.parcel.tracing", "0"), 0) != 0)
+#else
+      : enabled_(false)
+#endif
+      , capacity_((std::max)(util::safe_lexical_cast<std::size_t>(
+            get_config_entry("hpx.parcel.tracing_buffer_size", "65536"),
+                65536), std::size_t(1)))
+      , filename_(get_config_entry("hpx.parcel.tracing_file", ""))
+      , num_buffers_(enabled_ ? get_os_thread_count() + 1 : 1)
+      , buffers_(new event_buffer[num_buffers_])
+    {
+        if (enabled_)
+        {
+            for (std::size_t i = 0; i != num_buffers_; ++i)
+                buffers_[i].events_.reserve(get_buffer_capacity());
+        }
+    }
+
+    parcel_tracer& parcel_tracer::instance()
+    {
+        hpx::util::static_<parcel_tracer, tag> tracer;
+        return tracer.get();
+    }
+
+    void parcel_tracer::record(parcel const& p, parcel_trace_stage stage,
+        std::size_t size, std::int64_t timestamp)
+    {
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        if (!enabled_)
+            return;
+
+        event e;
+        e.parcel_id_ = p.parcel_id();
+        e.action_ = p.get_action() ? p.get_action()->get_action_name() : "";
+        e.size_ = size;
+        e.timestamp_ = timestamp != 0 ?
+            timestamp : util::high_resolution_clock::now();
+        e.thread_ = get_worker_thread_num();
+        e.stage_ = stage;
+
+        get_buffer().record(e, get_buffer_capacity());
+#endif
+    }
+
+    // the capacity is split evenly between the buffers
+    std::size_t parcel_tracer::get_buffer_capacity() const
+    {
+        return (std::max)(capacity_ / num_buffers_, std::size_t(1));
+    }
+
+    parcel_tracer::event_buffer& parcel_tracer::get_buffer()
+    {
+        std::size_t num_thread = get_worker_thread_num();
+        if (num_thread >= num_buffers_ - 1)
+            return buffers_[num_buffers_ - 1];
+        return buffers_[num_thread];
+    }
+
+    void parcel_tracer::event_buffer::record(event const& e,
+        std::size_t capacity)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        if (events_.size() < capacity)
+        {
+            events_.push_back(e);
+        }
+        else
+        {
+            // overwrite the oldest event
+            events_[next_] = e;
+            next_ = (next_ + 1) % capacity;
+        }
+    }
+
+    void parcel_tracer::dump(std::ostream& os) const
+    {
+        std::vector<event> events;
+        for (std::size_t i = 0; i != num_buffers_; ++i)
+        {
+            event_buffer const& buffer = buffers_[i];
+
+            std::lock_guard<mutex_type> l(buffer.mtx_);
+            events.insert(events.end(), buffer.events_.begin(),
+                buffer.events_.end());
+        }
+
+        // the time a parcel spent in a stage is the time between the event
+        // for this stage and the previous event recorded for the same parcel
+        std::sort(events.begin(), events.end(),
+            [](event const& lhs, event const& rhs)
+            {
+                if (lhs.parcel_id_ != rhs.parcel_id_)
+                    return lhs.parcel_id_ < rhs.parcel_id_;
+                return lhs.timestamp_ < rhs.timestamp_;
+            });
+
+        std::uint32_t locality_id = get_locality_id();
+
+        os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+           << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":"
+           << locality_id << ",\"args\":{\"name\":\"locality#"
+           << locality_id << "\"}}";
+
+        os << std::fixed << std::setprecision(3);
+        for (std::size_t i = 0; i != events.size(); ++i)
+        {
+            event const& e = events[i];
+
+            std::ostringstream parcel_id;
+            parcel_id << e.parcel_id_;
+
+            os << ",\n{\"name\":\"" << stage_names[e.stage_]
+               << "\",\"cat\":\"parcel\",\"pid\":" << locality_id
+               << ",\"tid\":" << static_cast<std::int64_t>(e.thread_);
+
+            if (i != 0 && events[i - 1].parcel_id_ == e.parcel_id_)
+            {
+                std::int64_t start = events[i - 1].timestamp_;
+                os << ",\"ph\":\"X\",\"ts\":" << double(start) / 1000.
+                   << ",\"dur\":" << double(e.timestamp_ - start) / 1000.;
+            }
+            else
+            {
+                // first event recorded for this parcel on this locality
+                os << ",\"ph\":\"i\",\"s\":\"t\",\"ts\":"
+                   << double(e.timestamp_) / 1000.;
+            }
+
+            os << ",\"args\":{\"action\":\"" << escape_json(e.action_)
+               << "\",\"parcel\":\"" << escape_json(parcel_id.str().c_str())
+               << "\",\"size\":" << e.size_ << "}}";
+        }
+        os << "\n]}\n";
+    }
+
+    void parcel_tracer::dump(std::string const& filename, error_code& ec) const
+    {
+        std::ofstream out(filename.c_str());
+        if (!out)
+        {
+            HPX_THROWS_IF(ec, filesystem_error, "parcel_tracer::dump",
+                "could not open the parcel trace file: " + filename);
+            return;
+        }
+
+        dump(out);
+
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+
+    void parcel_tracer::dump_at_shutdown() const
+    {
+        if (!enabled_ || filename_.empty())
+            return;
+
+        error_code ec(lightweight);
+        dump(get_trace_filename(filename_, get_locality_id()), ec);
+    }
+
+    std::string parcel_tracer::get_trace_filename(std::string const& filename,
+        std::uint32_t locality_id)
+    {
+        // trace.json is turned into trace.<locality_id>.json
+        std::string::size_type ext = filename.find_last_of('.');
+        std::string::size_type dir = filename.find_last_of("/\\");
+        if (ext == std::string::npos || ext == 0 ||
+            (dir != std::string::npos && ext < dir + 2))
+        {
+            return filename + "." + std::to_string(locality_id);
+        }
+        return filename.substr(0, ext) + "." + std::to_string(locality_id) +
+            filename.substr(ext);
+    }
+
+    void parcel_tracer::clear()
+    {
+        for (std::size_t i = 0; i != num_buffers_; ++i)
+        {
+            event_buffer& buffer = buffers_[i];
+
+            std::lock_guard<mutex_type> l(buffer.mtx_);
+            buffer.events_.clear();
+            buffer.next_ = 0;
+        }
+    }
+}}}
+
+namespace hpx { namespace parcelset
+{
+    void dump_parcel_trace(std::string const& filename, error_code& ec)
+    {
+        detail::parcel_tracer::instance().dump(filename, ec);
+    }
+}}
@@ -0,0 +1,184 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/runtime.hpp>
+#include <hpx/runtime/get_config_entry.hpp>
+#include <hpx/runtime/get_worker_thread_num.hpp>
+#include <hpx/runtime/parcelset/detail/receive_buffer_pool.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/runtime/threads/topology.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+#include <hpx/util/safe_lexical_cast.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    namespace
+    {
+        // buffers are pooled in power of two size classes starting at 256
+        // bytes up to 16 MBytes
+        std::size_t const min_class_bits = 8;
+        std::size_t const max_class_bits = 24;
+
+        std::size_t floor_log2(std::size_t size)
+        {
+            std::size_t result = 0;
+            while (size >>= 1)
+                ++result;
+            return result;
+        }
+
+        // smallest class holding buffers which are at least of the given size
+        std::size_t get_size_class(std::size_t size)
+        {
+            std::size_t bits = floor_log2(size);
+            if (size & (size - 1))
+                ++bits;
+            return bits < min_class_bits ? 0 : bits - min_class_bits;
+        }
+
+        // largest class whose buffers are not larger than the given capacity
+        std::size_t get_capacity_class(std::size_t capacity)
+        {
+            return floor_log2(capacity) - min_class_bits;
+        }
+    }
+
+    receive_buffer_pool::receive_buffer_pool()
+      : enabled_(util::safe_lexical_cast<int>(
+            get_config_entry("hpx.parcel.receive_buffer_pool", "1"), 1) != 0)
+      , max_buffers_(util::safe_lexical_cast<std::size_t>(
+            get_config_entry("hpx.parcel.receive_buffer_pool_max_buffers",
+                "64"), 64))
+      , max_bytes_(util::safe_lexical_cast<std::size_t>(
+            get_config_entry("hpx.parcel.receive_buffer_pool_max_bytes",
+                "33554432"), 33554432))
+      , num_classes_(max_class_bits - min_class_bits + 1)
+    {
+        std::size_t num_domains = 1;
+        if (get_runtime_ptr() != nullptr)
+        {
+            num_domains = (std::max)(
+                threads::get_topology().get_number_of_numa_nodes(),
+                std::size_t(1));
+        }
+
+        domains_.reserve(num_domains);
+        for (std::size_t i = 0; i != num_domains; ++i)
+            domains_.emplace_back(new domain(num_classes_));
+    }
+
+    receive_buffer_pool& receive_buffer_pool::instance()
+    {
+        hpx::util::static_<receive_buffer_pool, tag> pool;
+        return pool.get();
+    }
+
+    receive_buffer_pool::domain& receive_buffer_pool::get_domain()
+    {
+        // threads not managed by HPX (like the io-service threads) use the
+        // buffers of the first domain
+        if (domains_.size() == 1 ||
+            get_worker_thread_num() == std::size_t(-1))
+        {
+            return *domains_[0];
+        }
+        return *domains_[threads::get_numa_node_number() % domains_.size()];
+    }
+
+    receive_buffer_pool::buffer_type
+    receive_buffer_pool::get_buffer(std::size_t size)
+    {
+        if (!enabled_ || size == 0)
+            return buffer_type(size);
+
+        std::size_t size_class = get_size_class(size);
+        domain& d = get_domain();
+
+        {
+            std::unique_lock<mutex_type> l(d.mtx_);
+            if (size_class < num_classes_ && !d.buffers_[size_class].empty())
+            {
+                buffer_type result(std::move(d.buffers_[size_class].back()));
+                d.buffers_[size_class].pop_back();
+                d.bytes_ -= result.capacity();
+                ++d.hits_;
+                l.unlock();
+
+                // the buffer keeps its previous size, no need to initialize
+                // the bytes it already holds
+                result.resize(size);
+                return result;
+            }
+            ++d.misses_;
+        }
+
+        buffer_type result;
+        if (size_class < num_classes_)
+            result.reserve(std::size_t(1) << (size_class + min_class_bits));
+        result.resize(size);
+        return result;
+    }
+
+    void receive_buffer_pool::reclaim_buffer(buffer_type && buffer)
+    {
+        std::size_t capacity = buffer.capacity();
+        if (!enabled_ || capacity < (std::size_t(1) << min_class_bits))
+            return;
+
+        std::size_t size_class = get_capacity_class(capacity);
+        if (size_class >= num_classes_)
+            return;
+
+        domain& d = get_domain();
+
+        std::lock_guard<mutex_type> l(d.mtx_);
+        std::vector<buffer_type>& buffers = d.buffers_[size_class];
+        if (buffers.size() < max_buffers_ && d.bytes_ + capacity <= max_bytes_)
+        {
+            d.bytes_ += capacity;
+            buffers.push_back(std::move(buffer));
+        }
+    }
+
+    void receive_buffer_pool::clear()
+    {
+        for (std::unique_ptr<domain>& d : domains_)
+        {
+            std::lock_guard<mutex_type> l(d->mtx_);
+            for (std::vector<buffer_type>& buffers : d->buffers_)
+                buffers.clear();
+            d->bytes_ = 0;
+        }
+    }
+
+    std::int64_t receive_buffer_pool::get_hits(bool reset)
+    {
+        std::int64_t result = 0;
+        for (std::unique_ptr<domain>& d : domains_)
+        {
+            std::lock_guard<mutex_type> l(d->mtx_);
+            result += util::get_and_reset_value(d->hits_, reset);
+        }
+        return result;
+    }
+
+    std::int64_t receive_buffer_pool::get_misses(bool reset)
+    {
+        std::int64_t result = 0;
+        for (std::unique_ptr<domain>& d : domains_)
+        {
+            std::lock_guard<mutex_type> l(d->mtx_);
+            result += util::get_and_reset_value(d->misses_, reset);
+        }
+        return result;
+    }
+}}}
@@ -12,6 +12,7 @@
 #include <hpx/runtime/parcelset/parcel.hpp>
 #include <hpx/runtime/parcelset/parcelhandler.hpp>
 #include <hpx/runtime/parcelset/detail/parcel_route_handler.hpp>
+#include <hpx/runtime/parcelset/detail/parcel_tracer.hpp>
 #include <hpx/runtime/serialization/access.hpp>
 #include <hpx/runtime/serialization/input_archive.hpp>
 #include <hpx/runtime/serialization/output_archive.hpp>
@@ -104,6 +105,8 @@ namespace hpx { namespace parcelset
         std::size_t num_thread)
     {
         load_data(ar);
+        detail::trace_parcel(*this, detail::trace_decode);
+
         // make sure this parcel destination matches the proper locality
         HPX_ASSERT(destination_locality() == data_.addr_.locality_);
 
@@ -135,6 +138,7 @@ namespace hpx { namespace parcelset
             // afterwards.
             action_->load_schedule(ar, std::move(data_.dest_), lva, num_thread);
         }
+        detail::trace_parcel(*this, detail::trace_schedule);
         return false;
     }
 
@@ -175,6 +179,7 @@ namespace hpx { namespace parcelset
             // afterwards.
             action_->schedule_thread(std::move(data_.dest_), lva, std::size_t(-1));
         }
+        detail::trace_parcel(*this, detail::trace_schedule);
     }
 
     void parcel::load_data(serialization::input_archive & ar)
@@ -209,9 +214,7 @@ namespace hpx { namespace parcelset
         ar & data_;
         ar & cont_;
 #if !defined(HPX_DEBUG)
-        const std::uint32_t id =
-            polymorphic_id_factory::get_id(
-                access::get_name(action_.get()));
+        const std::uint32_t id = access::get_id(action_.get());
         ar << id;
 #else
         std::string const name(access::get_name(action_.get()));
@@ -22,6 +22,8 @@
 #include <hpx/runtime/message_handler_fwd.hpp>
 #include <hpx/runtime/naming/resolver_client.hpp>
 #include <hpx/runtime/message_handler_fwd.hpp>
+#include <hpx/runtime/parcelset/detail/parcel_tracer.hpp>
+#include <hpx/runtime/parcelset/detail/receive_buffer_pool.hpp>
 #include <hpx/runtime/parcelset/parcelhandler.hpp>
 #include <hpx/runtime/parcelset/static_parcelports.hpp>
 #include <hpx/runtime/parcelset/policies/message_handler.hpp>
@@ -104,7 +106,17 @@ namespace hpx { namespace parcelset
         load_message_handlers_(
             util::get_entry_as<int>(cfg, "hpx.parcel.message_handlers", "0") != 0
         ),
+        aggregate_parcels_(
+            util::get_entry_as<int>(cfg, "hpx.parcel.aggregation", "0") != 0
+        ),
+        aggregation_max_parcels_((std::max)(util::get_entry_as<std::size_t>(
+            cfg, "hpx.parcel.aggregation_max_parcels", "64"), std::size_t(1))),
+        aggregation_interval_(util::get_entry_as<std::size_t>(
+            cfg, "hpx.parcel.aggregation_interval", "50")),
+        aggregation_background_flush_(util::get_entry_as<int>(
+            cfg, "hpx.parcel.aggregation_background_flush", "0") != 0),
         count_routed_(0),
+        count_loopback_(0),
         write_handler_(&default_write_handler)
     {
         for (plugins::parcelport_factory_base* factory : get_parcelport_factories())
@@ -261,6 +273,16 @@ namespace hpx { namespace parcelset
                             p->flush(mode, stop_buffering) || did_some_work;
                     }
                 }
+
+                parcel_aggregator_map::iterator aend = aggregators_.end();
+                for (parcel_aggregator_map::iterator it = aggregators_.begin();
+                     it != aend; ++it)
+                {
+                    std::shared_ptr<detail::parcel_aggregator> p((*it).second);
+                    util::unlock_guard<std::unique_lock<mutex_type> > ul(l);
+                    did_some_work =
+                        p->flush(mode, stop_buffering) || did_some_work;
+                }
             }
         }
 
@@ -279,6 +301,9 @@ namespace hpx { namespace parcelset
 
     void parcelhandler::stop(bool blocking)
     {
+        // write the parcel trace, if requested
+        detail::parcel_tracer::instance().dump_at_shutdown();
+
         // now stop all parcel ports
         for (pports_type::value_type& pp : pports_)
         {
@@ -290,6 +315,7 @@ namespace hpx { namespace parcelset
 
         // release all message handlers
         handlers_.clear();
+        aggregators_.clear();
     }
 
     naming::resolver_client& parcelhandler::get_resolver()
@@ -380,6 +406,9 @@ namespace hpx { namespace parcelset
                 hpx::detail::dijkstra_make_black();
             }
 
+            if (!ec)
+                trace_parcel(p, trace_send);
+
             // invoke the original handler
             f(ec, p);
         }
@@ -434,6 +463,7 @@ namespace hpx { namespace parcelset
             p.parcel_id() = parcelset::parcel::generate_unique_id();
         }
 #endif
+        detail::trace_parcel(p, detail::trace_enqueue);
 
         using util::placeholders::_1;
         using util::placeholders::_2;
@@ -444,6 +474,13 @@ namespace hpx { namespace parcelset
         // parcel directly to the destination.
         if (resolved_locally)
         {
+            // parcels destined for this locality never touch a parcelport
+            if (addr.locality_ == get_locality())
+            {
+                put_parcel_loopback(std::move(p), std::move(wrapped_f));
+                return;
+            }
+
             // dispatch to the message handler which is associated with the
             // encapsulated action
             typedef std::pair<std::shared_ptr<parcelport>, locality> destination_pair;
@@ -460,6 +497,19 @@ namespace hpx { namespace parcelset
                 }
             }
 
+            // combine the parcels of different actions sent to the same
+            // locality, high priority parcels are not delayed
+            if (aggregate_parcels_ && !hpx::is_starting() &&
+                !hpx::is_stopped_or_shutting_down() &&
+                !dest.first->is_priority_parcel(p))
+            {
+                detail::parcel_aggregator* pa =
+                    get_parcel_aggregator(dest.first.get(), dest.second);
+
+                pa->put_parcel(dest.second, std::move(p), std::move(wrapped_f));
+                return;
+            }
+
             dest.first->put_parcel(dest.second, std::move(p), std::move(wrapped_f));
             return;
         }
@@ -549,6 +599,7 @@ namespace hpx { namespace parcelset
                 p.parcel_id() = parcelset::parcel::generate_unique_id();
             }
 #endif
+            detail::trace_parcel(p, detail::trace_enqueue);
 
             bool resolved_locally = true;
             naming::address& addr = p.addr();
@@ -568,6 +619,13 @@ namespace hpx { namespace parcelset
             // the parcel directly to the destination.
             if (resolved_locally)
             {
+                // parcels destined for this locality never touch a parcelport
+                if (addr.locality_ == get_locality())
+                {
+                    put_parcel_loopback(std::move(p), std::move(f));
+                    continue;
+                }
+
                 // dispatch to the message handler which is associated with the
                 // encapsulated action
                 destination_pair dest = find_appropriate_destination(
@@ -621,6 +679,54 @@ namespace hpx { namespace parcelset
         }
     }
 
+    void parcelhandler::reroute_parcels(std::vector<parcel> parcels,
+        std::vector<write_handler_type> handlers)
+    {
+        if (parcels.empty())
+            return;
+
+        HPX_ASSERT(parcels.size() == handlers.size());
+        HPX_ASSERT(!!parcels[0].addr());
+
+        // the handlers have been wrapped already by put_parcel(s), hand the
+        // parcels directly to the parcelport
+        typedef std::pair<std::shared_ptr<parcelport>, locality>
+            destination_pair;
+        destination_pair dest = find_appropriate_destination(
+            parcels[0].addr().locality_);
+        dest.first->put_parcels(dest.second, std::move(parcels),
+            std::move(handlers));
+    }
+
+    void parcelhandler::put_parcel_loopback(parcel p, write_handler_type f)
+    {
+        ++count_loopback_;
+
+        // The parcel is considered to be sent once it was handed over to its
+        // destination. The action's arguments are moved into the new thread,
+        // nothing is serialized.
+        f(boost::system::error_code(), p);
+        p.schedule_action();
+    }
+
+    detail::parcel_aggregator* parcelhandler::get_parcel_aggregator(
+        parcelport* pp, locality const& loc)
+    {
+        std::lock_guard<mutex_type> l(handlers_mtx_);
+
+        parcel_aggregator_map::iterator it = aggregators_.find(loc);
+        if (it == aggregators_.end())
+        {
+            std::shared_ptr<detail::parcel_aggregator> p =
+                std::make_shared<detail::parcel_aggregator>(pp, loc,
+                    aggregation_max_parcels_, aggregation_interval_,
+                    aggregation_background_flush_);
+            it = aggregators_.insert(
+                parcel_aggregator_map::value_type(loc, p)).first;
+        }
+        return (*it).second.get();
+    }
+
     std::int64_t parcelhandler::get_outgoing_queue_length(bool reset) const
     {
         std::int64_t parcel_count = 0;
@@ -775,6 +881,34 @@ namespace hpx { namespace parcelset
         return util::get_and_reset_value(count_routed_, reset);
     }
 
+    // number of parcels short-circuited to this locality
+    std::int64_t parcelhandler::get_parcel_loopback_count(bool reset)
+    {
+        return util::get_and_reset_value(count_loopback_, reset);
+    }
+
+    // number of parcels passed through the parcel aggregation
+    std::int64_t parcelhandler::get_aggregated_parcels_count(bool reset)
+    {
+        std::int64_t result = 0;
+
+        std::lock_guard<mutex_type> l(handlers_mtx_);
+        for (parcel_aggregator_map::value_type const& pa : aggregators_)
+            result += pa.second->get_parcels_count(reset);
+        return result;
+    }
+
+    // number of messages sent by the parcel aggregation
+    std::int64_t parcelhandler::get_aggregated_messages_count(bool reset)
+    {
+        std::int64_t result = 0;
+
+        std::lock_guard<mutex_type> l(handlers_mtx_);
+        for (parcel_aggregator_map::value_type const& pa : aggregators_)
+            result += pa.second->get_messages_count(reset);
+        return result;
+    }
+
     // number of messages sent
     std::int64_t parcelhandler::get_message_send_count(
         std::string const& pp_type, bool reset) const
@@ -984,6 +1118,52 @@ namespace hpx { namespace parcelset
     }
 #endif
 
+    // bandwidth achieved while sending data to the given destination
+    std::int64_t parcelhandler::get_sent_bandwidth(std::string const& pp_type,
+        std::uint32_t locality_id, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_sent_bandwidth(locality_id, reset) : 0;
+    }
+
+    namespace detail
+    {
+        // Creation function for the send bandwidth counters, the optional
+        // counter parameter is the id of the destination locality
+        naming::gid_type sent_bandwidth_counter_creator(
+            performance_counters::counter_info const& info,
+            util::function_nonser<
+                std::int64_t(std::uint32_t, bool)
+            > const& counter_func,
+            error_code& ec)
+        {
+            performance_counters::counter_path_elements paths;
+            performance_counters::get_counter_path_elements(
+                info.fullname_, paths, ec);
+            if (ec) return naming::invalid_gid;
+
+            std::uint32_t locality_id = naming::invalid_locality_id;
+            if (!paths.parameters_.empty())
+            {
+                locality_id = util::safe_lexical_cast<std::uint32_t>(
+                    paths.parameters_, naming::invalid_locality_id);
+                if (locality_id == naming::invalid_locality_id)
+                {
+                    HPX_THROWS_IF(ec, bad_parameter,
+                        "sent_bandwidth_counter_creator",
+                        "invalid counter parameter (must be the id of the "
+                        "destination locality): " + paths.parameters_);
+                    return naming::invalid_gid;
+                }
+            }
+
+            using util::placeholders::_1;
+            return performance_counters::locality_raw_counter_creator(info,
+                util::bind(counter_func, locality_id, _1), ec);
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     void parcelhandler::register_counter_types()
     {
@@ -1004,6 +1184,18 @@ namespace hpx { namespace parcelset
             util::bind(&parcelhandler::get_outgoing_queue_length, this, _1));
         util::function_nonser<std::int64_t(bool)> outgoing_routed_count(
             util::bind(&parcelhandler::get_parcel_routed_count, this, _1));
+        util::function_nonser<std::int64_t(bool)> loopback_count(
+            util::bind(&parcelhandler::get_parcel_loopback_count, this, _1));
+        util::function_nonser<std::int64_t(bool)> aggregated_parcels_count(
+            util::bind(&parcelhandler::get_aggregated_parcels_count, this, _1));
+        util::function_nonser<std::int64_t(bool)> aggregated_messages_count(
+            util::bind(&parcelhandler::get_aggregated_messages_count, this, _1));
+        util::function_nonser<std::int64_t(bool)> receive_buffer_pool_hits(
+            util::bind(&detail::receive_buffer_pool::get_hits,
+                &detail::receive_buffer_pool::instance(), _1));
+        util::function_nonser<std::int64_t(bool)> receive_buffer_pool_misses(
+            util::bind(&detail::receive_buffer_pool::get_misses,
+                &detail::receive_buffer_pool::instance(), _1));
 
         performance_counters::generic_counter_type_data const counter_types[] =
         {
@@ -1036,6 +1228,58 @@ namespace hpx { namespace parcelset
                   _1, outgoing_routed_count, _2),
               &performance_counters::locality_counter_discoverer,
               ""
+            },
+            { "/parcels/count/loopback",
+              performance_counters::counter_raw,
+              "returns the number of (outbound) parcels destined for the "
+                  "sending locality which were scheduled without being "
+                  "serialized",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, loopback_count, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { "/parcels/count/aggregated",
+              performance_counters::counter_raw,
+              "returns the number of (outbound) parcels which were passed "
+                  "through the parcel aggregation",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, aggregated_parcels_count, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { "/messages/count/aggregated",
+              performance_counters::counter_raw,
+              "returns the number of (outbound) messages the aggregated "
+                  "parcels were sent in",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, aggregated_messages_count, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { "/parcels/count/receive-buffer-pool-hits",
+              performance_counters::counter_raw,
+              "returns the number of receive buffers which were taken from "
+                  "the pool of receive buffers",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, receive_buffer_pool_hits, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { "/parcels/count/receive-buffer-pool-misses",
+              performance_counters::counter_raw,
+              "returns the number of receive buffers which had to be "
+                  "allocated as no suitable buffer was available from the "
+                  "pool of receive buffers",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, receive_buffer_pool_misses, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
             }
         };
         performance_counters::install_counter_types(
@@ -1154,6 +1398,10 @@ namespace hpx { namespace parcelset
             util::bind(&parcelhandler::get_buffer_allocate_time_received, this,
                 pp_type, _1));
 
+        util::function_nonser<std::int64_t(std::uint32_t, bool)>
+            sent_bandwidth(util::bind(&parcelhandler::get_sent_bandwidth,
+                this, pp_type, _1, _2));
+
         performance_counters::generic_counter_type_data const counter_types[] =
         {
             { boost::str(boost::format("/parcels/count/%s/sent") % pp_type),
@@ -1336,6 +1584,19 @@ namespace hpx { namespace parcelset
               &performance_counters::locality_counter_discoverer,
               "bytes"
             },
+            { boost::str(boost::format("/data/bandwidth/%s/sent") % pp_type),
+              performance_counters::counter_raw,
+              boost::str(boost::format(
+                  "returns the bandwidth achieved while sending data using "
+                  "the %s connection type by the referenced locality, "
+                  "optionally only to the destination locality given as the "
+                  "counter parameter") % pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&detail::sent_bandwidth_counter_creator,
+                  _1, std::move(sent_bandwidth), _2),
+              &performance_counters::locality_counter_discoverer,
+              "bytes/s"
+            },
             { boost::str(boost::format(
                   "/serialize/count/%s/sent") % pp_type),
               performance_counters::counter_raw,
@@ -1551,6 +1812,10 @@ namespace hpx { namespace parcelset
             "max_connections_per_locality = "
                 "${HPX_PARCEL_MAX_CONNECTIONS_PER_LOCALITY:"
                 BOOST_PP_STRINGIZE(HPX_PARCEL_MAX_CONNECTIONS_PER_LOCALITY) "}",
+            "send_pipeline_depth = ${HPX_PARCEL_SEND_PIPELINE_DEPTH:"
+                "$[hpx.parcel.max_connections_per_locality]}",
+            "send_pipeline_threshold = ${HPX_PARCEL_SEND_PIPELINE_THRESHOLD:"
+                "1048576}",
             "max_message_size = ${HPX_PARCEL_MAX_MESSAGE_SIZE:"
                 BOOST_PP_STRINGIZE(HPX_PARCEL_MAX_MESSAGE_SIZE) "}",
             "max_outbound_message_size = ${HPX_PARCEL_MAX_OUTBOUND_MESSAGE_SIZE:"
@@ -1565,6 +1830,20 @@ namespace hpx { namespace parcelset
                 "$[hpx.parcel.array_optimization]}",
             "enable_security = ${HPX_PARCEL_ENABLE_SECURITY:0}",
             "async_serialization = ${HPX_PARCEL_ASYNC_SERIALIZATION:1}",
+            "priority_lanes = ${HPX_PARCEL_PRIORITY_LANES:0}",
+            "aggregation = ${HPX_PARCEL_AGGREGATION:0}",
+            "aggregation_max_parcels = ${HPX_PARCEL_AGGREGATION_MAX_PARCELS:64}",
+            "aggregation_interval = ${HPX_PARCEL_AGGREGATION_INTERVAL:50}",
+            "aggregation_background_flush = "
+                "${HPX_PARCEL_AGGREGATION_BACKGROUND_FLUSH:0}",
+            "tracing = ${HPX_PARCEL_TRACING:0}",
+            "tracing_buffer_size = ${HPX_PARCEL_TRACING_BUFFER_SIZE:65536}",
+            "tracing_file = ${HPX_PARCEL_TRACING_FILE}",
+            "receive_buffer_pool = ${HPX_PARCEL_RECEIVE_BUFFER_POOL:1}",
+            "receive_buffer_pool_max_buffers = "
+                "${HPX_PARCEL_RECEIVE_BUFFER_POOL_MAX_BUFFERS:64}",
+            "receive_buffer_pool_max_bytes = "
+                "${HPX_PARCEL_RECEIVE_BUFFER_POOL_MAX_BYTES:33554432}",
 #if defined(HPX_HAVE_PARCEL_COALESCING)
             "message_handlers = ${HPX_PARCEL_MESSAGE_HANDLERS:1}"
 #else
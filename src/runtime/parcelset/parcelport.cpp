@@ -12,8 +12,10 @@
 #include <hpx/state.hpp>
 #include <hpx/runtime_fwd.hpp>
 #include <hpx/runtime/applier/applier.hpp>
+#include <hpx/runtime/parcelset/parcelhandler.hpp>
 #include <hpx/runtime/parcelset/parcelport.hpp>
 #include <hpx/runtime/threads/thread.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
 #include <hpx/util/io_service_pool.hpp>
 #include <hpx/util/runtime_configuration.hpp>
 #include <hpx/util/safe_lexical_cast.hpp>
@@ -22,6 +24,7 @@
 #include <cstdint>
 #include <cstddef>
 #include <cstdint>
+#include <initializer_list>
 #include <string>
 #include <utility>
 
@@ -38,6 +41,8 @@ namespace hpx { namespace parcelset
         allow_zero_copy_optimizations_(true),
         enable_security_(false),
         async_serialization_(false),
+        priority_lanes_(hpx::util::get_entry_as<int>(ini,
+            "hpx.parcel.priority_lanes", "0") != 0),
         priority_(hpx::util::get_entry_as<int>(ini,
             "hpx.parcel." + type + ".priority", "0")),
         type_(type)
@@ -204,10 +209,134 @@ namespace hpx { namespace parcelset
         return parcels_received_.total_buffer_allocate_time(reset);
     }
 
+    namespace detail
+    {
+        template <typename Entry>
+        std::size_t num_pending_parcels(Entry const& e)
+        {
+#if defined(HPX_PARCELSET_PENDING_PARCELS_WORKAROUND)
+            return util::get<0>(e) ? util::get<0>(e)->size() : 0;
+#else
+            return util::get<0>(e).size();
+#endif
+        }
+    }
+
     std::int64_t parcelport::get_pending_parcels_count(bool /*reset*/)
     {
         std::lock_guard<lcos::local::spinlock> l(mtx_);
-        return pending_parcels_.size();
+
+        // count the parcels of both lanes
+        std::int64_t result = 0;
+        for (pending_parcels_map const* pending :
+            { &pending_parcels_, &pending_priority_parcels_ })
+        {
+            for (pending_parcels_map::value_type const& e : *pending)
+                result += detail::num_pending_parcels(e.second);
+        }
+        return result;
+    }
+
+    std::size_t parcelport::get_pending_parcels_count(locality const& dest) const
+    {
+        std::lock_guard<lcos::local::spinlock> l(mtx_);
+
+        std::size_t result = 0;
+        for (pending_parcels_map const* pending :
+            { &pending_parcels_, &pending_priority_parcels_ })
+        {
+            pending_parcels_map::const_iterator it = pending->find(dest);
+            if (it != pending->end())
+                result += detail::num_pending_parcels(it->second);
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        template <typename Data>
+        void send_started(Data& data, std::int64_t now)
+        {
+            if (data.in_flight_++ == 0)
+                data.busy_start_ = now;
+        }
+
+        template <typename Data>
+        void send_completed(Data& data, std::size_t bytes, std::int64_t now)
+        {
+            HPX_ASSERT(data.in_flight_ != 0);
+
+            data.bytes_ += bytes;
+            if (--data.in_flight_ == 0)
+                data.busy_time_ += now - data.busy_start_;
+        }
+
+        template <typename Data>
+        std::int64_t bandwidth(Data& data, bool reset, std::int64_t now)
+        {
+            std::int64_t busy_time = data.busy_time_;
+            if (data.in_flight_ != 0)
+                busy_time += now - data.busy_start_;
+
+            std::int64_t result = 0;
+            if (busy_time != 0)
+            {
+                result = static_cast<std::int64_t>(
+                    double(data.bytes_) * 1e9 / double(busy_time));
+            }
+
+            if (reset)
+            {
+                data.bytes_ = 0;
+                data.busy_time_ = 0;
+                data.busy_start_ = now;
+            }
+            return result;
+        }
+    }
+
+    void parcelport::reroute_parcels(std::vector<parcel>&& parcels,
+        std::vector<write_handler_type>&& handlers)
+    {
+        HPX_ASSERT(applier_ != nullptr);
+        applier_->get_parcel_handler().reroute_parcels(
+            std::move(parcels), std::move(handlers));
+    }
+
+    void parcelport::add_send_started(std::uint32_t locality_id)
+    {
+        std::int64_t now = util::high_resolution_clock::now();
+
+        std::lock_guard<lcos::local::spinlock> l(bandwidth_mtx_);
+        detail::send_started(sent_bandwidth_[locality_id], now);
+        detail::send_started(total_sent_bandwidth_, now);
+    }
+
+    void parcelport::add_send_completed(std::uint32_t locality_id,
+        std::size_t bytes)
+    {
+        std::int64_t now = util::high_resolution_clock::now();
+
+        std::lock_guard<lcos::local::spinlock> l(bandwidth_mtx_);
+        detail::send_completed(sent_bandwidth_[locality_id], bytes, now);
+        detail::send_completed(total_sent_bandwidth_, bytes, now);
+    }
+
+    std::int64_t parcelport::get_sent_bandwidth(std::uint32_t locality_id,
+        bool reset)
+    {
+        std::int64_t now = util::high_resolution_clock::now();
+
+        std::lock_guard<lcos::local::spinlock> l(bandwidth_mtx_);
+        if (locality_id == naming::invalid_locality_id)
+            return detail::bandwidth(total_sent_bandwidth_, reset, now);
+
+        bandwidth_map::iterator it = sent_bandwidth_.find(locality_id);
+        if (it == sent_bandwidth_.end())
+            return 0;
+
+        return detail::bandwidth(it->second, reset, now);
     }
 
     ///////////////////////////////////////////////////////////////////////////
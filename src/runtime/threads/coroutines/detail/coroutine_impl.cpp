@@ -72,54 +72,61 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
     }
 #endif
 
-    void coroutine_impl::operator()()
+    coroutine_impl::context_exit_status coroutine_impl::invoke_function(
+        boost::exception_ptr& tinfo)
     {
-        typedef super_type::context_exit_status context_exit_status;
         context_exit_status status = super_type::ctx_exited_return;
 
-        // loop as long this coroutine has been rebound
-        do
+        try
         {
-            boost::exception_ptr tinfo;
-            try
+            this->check_exit_state();
+
+            HPX_ASSERT(this->count() > 0);
+
             {
-                this->check_exit_state();
+                coroutine_self* old_self = coroutine_self::get_self();
+                coroutine_self self(this, old_self);
+                reset_self_on_exit on_exit(&self, old_self);
 
-                HPX_ASSERT(this->count() > 0);
+                this->m_result_last = m_fun(*this->args());
 
-                {
-                    coroutine_self* old_self = coroutine_self::get_self();
-                    coroutine_self self(this, old_self);
-                    reset_self_on_exit on_exit(&self, old_self);
+                // if this thread returned 'terminated' we need to reset
+                // the functor and the bound arguments
+                if (this->m_result_last.first == terminated)
+                    this->reset();
+            }
 
-                    this->m_result_last = m_fun(*this->args());
+            // return value to other side of the fence
+            this->bind_result(&this->m_result_last);
+        }
+        catch (exit_exception const&) {
+            status = super_type::ctx_exited_exit;
+            tinfo = boost::current_exception();
+            this->reset();            // reset functor
+        } catch (boost::exception const&) {
+            status = super_type::ctx_exited_abnormally;
+            tinfo = boost::current_exception();
+            this->reset();
+        } catch (std::exception const&) {
+            status = super_type::ctx_exited_abnormally;
+            tinfo = boost::current_exception();
+            this->reset();
+        } catch (...) {
+            status = super_type::ctx_exited_abnormally;
+            tinfo = boost::current_exception();
+            this->reset();
+        }
 
-                    // if this thread returned 'terminated' we need to reset
-                    // the functor and the bound arguments
-                    if (this->m_result_last.first == terminated)
-                        this->reset();
-                }
+        return status;
+    }
 
-                // return value to other side of the fence
-                this->bind_result(&this->m_result_last);
-            }
-            catch (exit_exception const&) {
-                status = super_type::ctx_exited_exit;
-                tinfo = boost::current_exception();
-                this->reset();            // reset functor
-            } catch (boost::exception const&) {
-                status = super_type::ctx_exited_abnormally;
-                tinfo = boost::current_exception();
-                this->reset();
-            } catch (std::exception const&) {
-                status = super_type::ctx_exited_abnormally;
-                tinfo = boost::current_exception();
-                this->reset();
-            } catch (...) {
-                status = super_type::ctx_exited_abnormally;
-                tinfo = boost::current_exception();
-                this->reset();
-            }
+    void coroutine_impl::operator()()
+    {
+        // loop as long this coroutine has been rebound
+        do
+        {
+            boost::exception_ptr tinfo;
+            context_exit_status status = invoke_function(tinfo);
 
             this->do_return(status, std::move(tinfo));
 
@@ -129,6 +136,16 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
         HPX_ASSERT(this->m_state == super_type::ctx_running);
     }
 
+    void coroutine_impl::invoke_stackless()
+    {
+        // the function is run directly on the stack of the caller, there is
+        // nothing to switch back from once it returns
+        boost::exception_ptr tinfo;
+        context_exit_status status = invoke_function(tinfo);
+
+        this->set_exited(status, std::move(tinfo));
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // the memory for the threads is managed by a lockfree caching_freelist
     struct coroutine_heap
@@ -170,6 +187,7 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
     struct heap_tag_medium {};
     struct heap_tag_large {};
     struct heap_tag_huge {};
+    struct heap_tag_nostack {};
 
     template <std::size_t NumHeaps, typename Tag>
     static coroutine_heap& get_heap(std::size_t i)
@@ -181,6 +199,12 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
 
     static coroutine_heap& get_heap(std::size_t i, std::ptrdiff_t stacksize)
     {
+        // stackless coroutines must never be handed out for threads which
+        // need a stack (and vice versa)
+        if (stacksize == 0)
+            return get_heap<HPX_COROUTINE_NUM_HEAPS,
+            heap_tag_nostack>(i % HPX_COROUTINE_NUM_HEAPS);
+
         // FIXME: This should check the sizes in runtime_configuration, not the
         // default macro sizes
         if (stacksize > HPX_MEDIUM_STACK_SIZE)
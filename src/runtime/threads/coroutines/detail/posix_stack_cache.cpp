@@ -0,0 +1,403 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_UNISTD_H)
+#include <unistd.h>
+#endif
+
+#if defined(_POSIX_VERSION)
+#include <hpx/runtime/threads/coroutines/detail/posix_utility.hpp>
+
+#if defined(HPX_HAVE_THREAD_STACK_CACHE)
+#include <hpx/runtime/threads/topology.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/spinlock.hpp>
+#include <hpx/util/thread_specific_ptr.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+#include <sys/mman.h>
+
+namespace hpx { namespace threads { namespace coroutines { namespace detail {
+namespace posix
+{
+    ///////////////////////////////////////////////////////////////////////////
+    bool use_stack_cache = false;
+    bool use_huge_pages = false;
+    std::size_t stack_cache_slab_size = 32;
+
+    namespace
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // Every slab starts with a header page, followed by its stack slots.
+        // A slab is aligned to the smallest power of two not smaller than the
+        // slab, which allows to find the header of any of its stacks.
+        struct slab_header
+        {
+            explicit slab_header(std::size_t numa_node, std::size_t count)
+              : numa_node_(numa_node), mapped_(count)
+            {}
+
+            std::size_t numa_node_;             // NUMA domain of the slab
+            boost::atomic<std::size_t> mapped_; // number of slots still mapped
+        };
+
+        std::size_t get_guard_size()
+        {
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+            if (use_guard_pages)
+                return EXEC_PAGESIZE;
+#endif
+            return 0;
+        }
+
+        std::size_t get_slab_count()
+        {
+            return stack_cache_slab_size != 0 ? stack_cache_slab_size : 1;
+        }
+
+        // Each stack is preceded by its guard page, slots are page aligned.
+        std::size_t get_slot_size(std::size_t size)
+        {
+            std::size_t const page_size = EXEC_PAGESIZE;
+            return ((size + get_guard_size() + page_size - 1) / page_size) *
+                page_size;
+        }
+
+        std::size_t get_slab_size(std::size_t size)
+        {
+            return EXEC_PAGESIZE + get_slot_size(size) * get_slab_count();
+        }
+
+        std::size_t get_slab_alignment(std::size_t size)
+        {
+            std::size_t const slab_size = get_slab_size(size);
+
+            std::size_t alignment = EXEC_PAGESIZE;
+            while (alignment < slab_size)
+                alignment <<= 1;
+            return alignment;
+        }
+
+        slab_header* get_slab_header(void* stack, std::size_t size)
+        {
+            return reinterpret_cast<slab_header*>(
+                reinterpret_cast<std::size_t>(stack) &
+                    ~(get_slab_alignment(size) - 1));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Free stacks of one particular size
+        struct stack_list
+        {
+            explicit stack_list(std::size_t size)
+              : size_(size)
+            {}
+
+            std::size_t size_;
+            std::vector<void*> stacks_;
+        };
+
+        // A set of free stacks, grouped by size. There are only very few
+        // different stack sizes, so a linear search is sufficient.
+        struct stack_cache
+        {
+            explicit stack_cache(std::size_t numa_node)
+              : numa_node_(numa_node)
+            {}
+
+            std::vector<void*>& get_stacks(std::size_t size)
+            {
+                for (stack_list& l : lists_)
+                {
+                    if (l.size_ == size)
+                        return l.stacks_;
+                }
+                lists_.push_back(stack_list(size));
+                return lists_.back().stacks_;
+            }
+
+            std::size_t numa_node_;
+            std::vector<stack_list> lists_;
+        };
+
+        // The caches shared by all threads of one NUMA domain receive the
+        // stacks released by threads running on a different NUMA domain and
+        // the surplus of the caches of the threads running on this domain.
+        // The cache for std::size_t(-1) holds all stacks which are not bound
+        // to any NUMA domain.
+        struct shared_stack_cache
+        {
+            shared_stack_cache()
+              : cache_(std::size_t(-1))
+            {}
+
+            hpx::util::spinlock mtx_;
+            stack_cache cache_;
+        };
+
+        enum { max_numa_domains = 64 };
+
+        shared_stack_cache& get_shared_cache(std::size_t numa_node)
+        {
+            static shared_stack_cache caches[max_numa_domains + 1];
+            if (numa_node >= max_numa_domains)
+                return caches[max_numa_domains];
+            return caches[numa_node];
+        }
+
+        struct stack_cache_tag {};
+        hpx::util::thread_specific_ptr<stack_cache, stack_cache_tag> local_cache;
+
+        ///////////////////////////////////////////////////////////////////////
+        // Return the memory of a stack to the system, the header of the slab
+        // is unmapped together with the last of its stacks.
+        void release_stacks(std::vector<void*> const& stacks, std::size_t size)
+        {
+            std::size_t const guard_size = get_guard_size();
+            std::size_t const slot_size = get_slot_size(size);
+
+            for (void* stack : stacks)
+            {
+                slab_header* header = get_slab_header(stack, size);
+                ::munmap(static_cast<char*>(stack) - guard_size, slot_size);
+
+                if (--header->mapped_ == 0)
+                {
+                    header->~slab_header();
+                    ::munmap(header, EXEC_PAGESIZE);
+                }
+            }
+        }
+
+        // Move the stacks beyond the given count from the end of the list
+        // into the given vector.
+        void split_stacks(std::vector<void*>& stacks, std::size_t count,
+            std::vector<void*>& surplus)
+        {
+            if (stacks.size() <= count)
+                return;
+
+            surplus.insert(surplus.end(), stacks.begin() + count, stacks.end());
+            stacks.resize(count);
+        }
+
+        // Hand stacks over to the cache shared by the threads of their NUMA
+        // domain. Stacks beyond the capacity of that cache are returned to the
+        // system.
+        void free_shared_stacks(std::vector<void*>& stacks, std::size_t size,
+            std::size_t numa_node)
+        {
+            std::vector<void*> surplus;
+            {
+                shared_stack_cache& shared = get_shared_cache(numa_node);
+                std::lock_guard<hpx::util::spinlock> l(shared.mtx_);
+
+                std::vector<void*>& cached = shared.cache_.get_stacks(size);
+                cached.insert(cached.end(), stacks.begin(), stacks.end());
+                split_stacks(cached, 4 * get_slab_count(), surplus);
+            }
+            release_stacks(surplus, size);
+        }
+
+        // Take up to one slab worth of stacks from the cache shared by the
+        // threads of the given NUMA domain.
+        void alloc_shared_stacks(std::vector<void*>& stacks, std::size_t size,
+            std::size_t numa_node)
+        {
+            shared_stack_cache& shared = get_shared_cache(numa_node);
+            std::lock_guard<hpx::util::spinlock> l(shared.mtx_);
+
+            std::vector<void*>& cached = shared.cache_.get_stacks(size);
+            std::size_t const count = (std::min)(cached.size(), get_slab_count());
+            stacks.insert(stacks.end(), cached.end() - count, cached.end());
+            cached.resize(cached.size() - count);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Reserve a slab holding stack_cache_slab_size stacks of the given
+        // size using a single mmap.
+        void create_slab(std::size_t size, std::size_t numa_node,
+            std::vector<void*>& stacks)
+        {
+            std::size_t const guard_size = get_guard_size();
+            std::size_t const slot_size = get_slot_size(size);
+            std::size_t const count = get_slab_count();
+            std::size_t const slab_size = get_slab_size(size);
+            std::size_t const alignment = get_slab_alignment(size);
+
+            // over-allocate to be able to align the slab
+            void* region = ::mmap(nullptr,
+                slab_size + alignment,
+                PROT_EXEC | PROT_READ | PROT_WRITE,
+#if defined(__APPLE__)
+                MAP_PRIVATE | MAP_ANON | MAP_NORESERVE,
+#else
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+#endif
+                -1,
+                0
+                );
+
+            if (region == MAP_FAILED)
+            {
+                if (ENOMEM == errno)
+                    throw std::runtime_error("mmap() failed to allocate thread "
+                        "stack slab due to insufficient resources, "
+                        "decrease hpx.stacks.slab_size or add "
+                        "-Ihpx.stacks.use_stack_cache=0 to the command line");
+                else
+                    throw std::runtime_error(
+                        "mmap() failed to allocate thread stack slab");
+            }
+
+            // unmap the parts of the region outside of the aligned slab
+            char* begin = static_cast<char*>(region);
+            char* slab = reinterpret_cast<char*>(
+                (reinterpret_cast<std::size_t>(begin) + alignment - 1) &
+                    ~(alignment - 1));
+            char* end = begin + slab_size + alignment;
+
+            if (slab != begin)
+                ::munmap(begin, slab - begin);
+            if (slab + slab_size != end)
+                ::munmap(slab + slab_size, end - (slab + slab_size));
+
+#if defined(MADV_HUGEPAGE)
+            // this is only a hint, failures are not fatal
+            if (use_huge_pages)
+                ::madvise(slab, slab_size, MADV_HUGEPAGE);
+#endif
+
+            // bind the slab before any of its pages has been touched
+            if (numa_node != std::size_t(-1))
+            {
+                threads::get_topology().set_area_membind_nodeset(
+                    slab, slab_size, numa_node);
+            }
+
+            new (slab) slab_header(numa_node, count);
+
+            char* slot = slab + EXEC_PAGESIZE;
+            stacks.reserve(stacks.size() + count);
+            for (std::size_t i = 0; i != count; ++i, slot += slot_size)
+            {
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+                if (guard_size != 0 &&
+                    ::mprotect(slot, guard_size, PROT_NONE) != 0)
+                {
+                    int const error = errno;
+                    stacks.resize(stacks.size() - i);
+                    ::munmap(slab, slab_size);
+
+                    if (ENOMEM == error)
+                        throw std::runtime_error("mprotect() failed to install "
+                            "the guard page of a thread stack due to "
+                            "insufficient resources, increase "
+                            "hpx.stacks.slab_size or add "
+                            "-Ihpx.stacks.use_guard_pages=0 to the command "
+                            "line");
+                    else
+                        throw std::runtime_error("mprotect() failed to "
+                            "install the guard page of a thread stack");
+                }
+#endif
+                stacks.push_back(slot + guard_size);
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void init_stack_cache(std::size_t numa_node)
+    {
+        HPX_ASSERT(local_cache.get() == nullptr);
+        local_cache.reset(new stack_cache(numa_node));
+    }
+
+    void release_stack_cache()
+    {
+        stack_cache* cache = local_cache.get();
+        if (cache == nullptr)
+            return;
+
+        for (stack_list& list : cache->lists_)
+            free_shared_stacks(list.stacks_, list.size_, cache->numa_node_);
+
+        local_cache.reset();
+    }
+
+    // Each worker thread keeps up to two slabs worth of stacks of each size.
+    // Surplus stacks and stacks bound to a different NUMA domain are handed
+    // over to the cache shared by the threads of their NUMA domain, which in
+    // turn returns the stacks it can't hold to the system.
+    void* alloc_cached_stack(std::size_t size)
+    {
+        stack_cache* cache = local_cache.get();
+        std::size_t const numa_node =
+            cache != nullptr ? cache->numa_node_ : std::size_t(-1);
+
+        if (cache != nullptr)
+        {
+            std::vector<void*>& stacks = cache->get_stacks(size);
+            if (stacks.empty())
+            {
+                alloc_shared_stacks(stacks, size, numa_node);
+                if (stacks.empty())
+                    create_slab(size, numa_node, stacks);
+            }
+
+            void* stack = stacks.back();
+            stacks.pop_back();
+            return stack;
+        }
+
+        shared_stack_cache& shared = get_shared_cache(numa_node);
+        std::lock_guard<hpx::util::spinlock> l(shared.mtx_);
+
+        std::vector<void*>& stacks = shared.cache_.get_stacks(size);
+        if (stacks.empty())
+            create_slab(size, numa_node, stacks);
+
+        void* stack = stacks.back();
+        stacks.pop_back();
+        return stack;
+    }
+
+    void free_cached_stack(void* stack, std::size_t size)
+    {
+        std::size_t const numa_node = get_slab_header(stack, size)->numa_node_;
+
+        stack_cache* cache = local_cache.get();
+        if (cache != nullptr && cache->numa_node_ == numa_node)
+        {
+            std::vector<void*>& stacks = cache->get_stacks(size);
+            stacks.push_back(stack);
+
+            std::size_t const count = get_slab_count();
+            if (stacks.size() > 2 * count)
+            {
+                std::vector<void*> surplus;
+                split_stacks(stacks, count, surplus);
+                free_shared_stacks(surplus, size, numa_node);
+            }
+            return;
+        }
+
+        std::vector<void*> stacks(1, stack);
+        free_shared_stacks(stacks, size, numa_node);
+    }
+}
+}}}}
+
+#endif
+#endif
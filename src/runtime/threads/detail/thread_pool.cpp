@@ -25,6 +25,13 @@
 #include <hpx/util/high_resolution_clock.hpp>
 #include <hpx/util/unlock_guard.hpp>
 
+#if defined(HPX_HAVE_UNISTD_H)
+#include <unistd.h>
+#endif
+#if defined(_POSIX_VERSION)
+#include <hpx/runtime/threads/coroutines/detail/posix_utility.hpp>
+#endif
+
 #include <boost/atomic.hpp>
 #include <boost/exception_ptr.hpp>
 #include <boost/system/system_error.hpp>
@@ -165,6 +172,46 @@ namespace hpx { namespace threads { namespace detail
         sched_.Scheduler::on_error(num, e);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Scheduler>
+    std::size_t thread_pool<Scheduler>::get_active_os_thread_count() const
+    {
+        return sched_.Scheduler::get_active_thread_count();
+    }
+
+    template <typename Scheduler>
+    void thread_pool<Scheduler>::set_active_os_thread_count(std::size_t count,
+        error_code& ec)
+    {
+        if (!sched_.Scheduler::supports_retiring_workers())
+        {
+            HPX_THROWS_IF(ec, invalid_status,
+                "thread_pool<Scheduler>::set_active_os_thread_count",
+                "the scheduler " + Scheduler::get_scheduler_name() +
+                " does not support changing the number of active worker "
+                "threads");
+            return;
+        }
+
+        if (count == 0 || count > threads_.size())
+        {
+            HPX_THROWS_IF(ec, bad_parameter,
+                "thread_pool<Scheduler>::set_active_os_thread_count",
+                "the number of active worker threads must be between 1 and "
+                "the number of worker threads");
+            return;
+        }
+
+        LTM_(info) //-V128
+            << "thread_pool::set_active_os_thread_count: " << pool_name_
+            << " " << count << " active OS thread(s)"; //-V128
+
+        sched_.Scheduler::set_active_thread_count(count);
+
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Scheduler>
     void thread_pool<Scheduler>::create_thread(thread_init_data& data,
@@ -201,6 +248,24 @@ namespace hpx { namespace threads { namespace detail
         detail::create_work(&sched_, data, initial_state, ec); //-V601
     }
 
+    template <typename Scheduler>
+    void thread_pool<Scheduler>::create_threads(
+        std::vector<thread_init_data>& data, thread_state_enum initial_state,
+        error_code& ec)
+    {
+        // verify state
+        if (thread_count_ == 0 && !sched_.is_state(state_running))
+        {
+            // thread-manager is not currently running
+            HPX_THROWS_IF(ec, invalid_status,
+                "thread_pool<Scheduler>::create_threads",
+                "invalid state: thread pool is not running");
+            return;
+        }
+
+        detail::create_threads(&sched_, data, initial_state, ec); //-V601
+    }
+
     template <typename Scheduler>
     thread_state thread_pool<Scheduler>::set_state(
         thread_id_type const& id, thread_state_enum new_state,
@@ -361,6 +426,9 @@ namespace hpx { namespace threads { namespace detail
         reset_idle_rate_time_.resize(num_threads);
         reset_idle_rate_time_total_.resize(num_threads);
 
+        sampled_idle_rate_time_.resize(num_threads);
+        sampled_idle_rate_time_total_.resize(num_threads);
+
 #if defined(HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES)
         reset_creation_idle_rate_time_.resize(num_threads);
         reset_creation_idle_rate_time_total_.resize(num_threads);
@@ -374,6 +442,11 @@ namespace hpx { namespace threads { namespace detail
             << "thread_pool::run: " << pool_name_
             << " timestamp_scale: " << timestamp_scale_; //-V128
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        // the configuration is not available when the scheduler is created
+        sched_.Scheduler::init_idle_backoff();
+#endif
+
         try {
             HPX_ASSERT(startup_.get() == nullptr);
             startup_.reset(
@@ -589,6 +662,13 @@ namespace hpx { namespace threads { namespace detail
             }
         }
 
+#if defined(HPX_HAVE_THREAD_STACK_CACHE)
+        // carve the stacks of the HPX threads run by this OS thread from
+        // slabs bound to its NUMA domain
+        coroutines::detail::posix::stack_cache_helper stack_cache(
+            topology.get_numa_node_number(get_pu_num(num_thread), ec));
+#endif
+
         // manage the number of this thread in its TSS
         init_tss_helper<Scheduler> tss_helper(*this, num_thread);
 
@@ -1212,6 +1292,39 @@ namespace hpx { namespace threads { namespace detail
         return std::int64_t(10000. * percent);   // 0.01 percent
     }
 
+    template <typename Scheduler>
+    std::int64_t thread_pool<Scheduler>::sample_active_idle_rate()
+    {
+        std::size_t const active = (std::min)(
+            sched_.Scheduler::get_active_thread_count(), tfunc_times_.size());
+
+        std::uint64_t exec_total = 0;
+        std::uint64_t tfunc_total = 0;
+        for (std::size_t i = 0; i != active; ++i)
+        {
+            std::uint64_t exec_time = exec_times_[i];
+            std::uint64_t tfunc_time = tfunc_times_[i];
+
+            // the timers of a worker are restarted when it runs for the
+            // first time
+            if (exec_time >= sampled_idle_rate_time_[i] &&
+                tfunc_time >= sampled_idle_rate_time_total_[i])
+            {
+                exec_total += exec_time - sampled_idle_rate_time_[i];
+                tfunc_total += tfunc_time - sampled_idle_rate_time_total_[i];
+            }
+
+            sampled_idle_rate_time_[i] = exec_time;
+            sampled_idle_rate_time_total_[i] = tfunc_time;
+        }
+
+        if (tfunc_total == 0 || tfunc_total < exec_total)
+            return 10000LL;
+
+        double const percent = 1. - (double(exec_total) / double(tfunc_total));
+        return std::int64_t(10000. * percent);   // 0.01 percent
+    }
+
     template <typename Scheduler>
     std::int64_t thread_pool<Scheduler>::avg_idle_rate(
         std::size_t num_thread, bool reset)
@@ -1348,6 +1461,43 @@ namespace hpx { namespace threads { namespace detail
     }
 #endif
 
+    template <typename Scheduler>
+    std::int64_t thread_pool<Scheduler>::
+        get_num_deadline_misses(std::size_t num, bool reset)
+    {
+        return sched_.Scheduler::get_num_deadline_misses(num, reset);
+    }
+
+#ifdef HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF
+    template <typename Scheduler>
+    std::int64_t thread_pool<Scheduler>::
+        get_idle_backoff_count(std::size_t num, bool reset)
+    {
+        return sched_.Scheduler::get_idle_backoff_count(num, reset);
+    }
+
+    template <typename Scheduler>
+    std::int64_t thread_pool<Scheduler>::
+        get_idle_park_count(std::size_t num, bool reset)
+    {
+        return sched_.Scheduler::get_idle_park_count(num, reset);
+    }
+
+    template <typename Scheduler>
+    std::int64_t thread_pool<Scheduler>::
+        get_idle_wakeup_latency(std::size_t num, bool reset)
+    {
+        return sched_.Scheduler::get_idle_wakeup_latency(num, reset);
+    }
+
+    template <typename Scheduler>
+    std::int64_t thread_pool<Scheduler>::
+        get_idle_backoff_time(std::size_t num, bool reset)
+    {
+        return sched_.Scheduler::get_idle_backoff_time(num, reset);
+    }
+#endif
+
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
     template <typename Scheduler>
     std::int64_t thread_pool<Scheduler>::
@@ -1429,6 +1579,11 @@ template class HPX_EXPORT hpx::threads::detail::thread_pool<
     hpx::threads::policies::abp_fifo_priority_queue_scheduler>;
 #endif
 
+#if defined(HPX_HAVE_CHASE_LEV_SCHEDULER)
+template class HPX_EXPORT hpx::threads::detail::thread_pool<
+    hpx::threads::policies::chase_lev_priority_queue_scheduler>;
+#endif
+
 #if defined(HPX_HAVE_HIERARCHY_SCHEDULER)
 #include <hpx/runtime/threads/policies/hierarchy_scheduler.hpp>
 template class HPX_EXPORT hpx::threads::detail::thread_pool<
@@ -1441,3 +1596,9 @@ template class HPX_EXPORT hpx::threads::detail::thread_pool<
     hpx::threads::policies::periodic_priority_queue_scheduler<> >;
 #endif
 
+#if defined(HPX_HAVE_DEADLINE_SCHEDULER)
+#include <hpx/runtime/threads/policies/deadline_queue_scheduler.hpp>
+template class HPX_EXPORT hpx::threads::detail::thread_pool<
+    hpx::threads::policies::deadline_queue_scheduler<> >;
+#endif
+
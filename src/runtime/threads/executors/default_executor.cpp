@@ -9,7 +9,10 @@
 #include <hpx/throw_exception.hpp>
 #include <hpx/runtime/threads/thread_enums.hpp>
 #include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/runtime/threads/thread_init_data.hpp>
 #include <hpx/util/assert.hpp>
+#include <hpx/util/bind.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
 #include <hpx/util/steady_clock.hpp>
 #include <hpx/util/thread_description.hpp>
 #include <hpx/util/unique_function.hpp>
@@ -24,16 +27,57 @@ namespace hpx { namespace threads { namespace executors { namespace detail
     default_executor::default_executor()
       : stacksize_(thread_stacksize_default),
         priority_(thread_priority_default),
-        os_thread_(std::size_t(-1))
+        os_thread_(std::size_t(-1)),
+        rel_deadline_(0)
     {}
 
     default_executor::default_executor(thread_priority priority,
         thread_stacksize stacksize, std::size_t os_thread)
       : stacksize_(stacksize),
         priority_(priority),
-        os_thread_(os_thread)
+        os_thread_(os_thread),
+        rel_deadline_(0)
     {}
 
+    default_executor::default_executor(
+        util::steady_duration const& rel_deadline, thread_priority priority,
+        thread_stacksize stacksize, std::size_t os_thread)
+      : stacksize_(stacksize),
+        priority_(priority),
+        os_thread_(os_thread),
+        rel_deadline_(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            rel_deadline.value()).count())
+    {}
+
+    // Create a new thread, its deadline (if any) is calculated relative to
+    // the given start time.
+    thread_id_type default_executor::register_thread(closure_type&& f,
+        util::thread_description const& desc,
+        threads::thread_state_enum initial_state, bool run_now,
+        threads::thread_stacksize stacksize, std::uint64_t start_time,
+        error_code& ec)
+    {
+        if (stacksize == threads::thread_stacksize_default)
+            stacksize = stacksize_;
+
+        if (rel_deadline_ == 0)
+        {
+            return register_thread_nullary(std::move(f), desc, initial_state,
+                run_now, priority_, os_thread_, stacksize, ec);
+        }
+
+        util::thread_description d = desc ? desc :
+            util::thread_description(f, "default_executor::add");
+
+        threads::thread_init_data data(
+            util::bind(util::one_shot(&applier::detail::thread_function_nullary),
+                std::move(f)),
+            d, 0, priority_, os_thread_, threads::get_stack_size(stacksize),
+            nullptr, start_time + rel_deadline_);
+
+        return register_thread_plain(data, initial_state, run_now, ec);
+    }
+
     // Schedule the specified function for execution in this executor.
     // Depending on the subclass implementation, this may block in some
     // situations.
@@ -42,11 +86,8 @@ namespace hpx { namespace threads { namespace executors { namespace detail
         threads::thread_state_enum initial_state,
         bool run_now, threads::thread_stacksize stacksize, error_code& ec)
     {
-        if (stacksize == threads::thread_stacksize_default)
-            stacksize = stacksize_;
-
-        register_thread_nullary(std::move(f), desc, initial_state, run_now,
-            priority_, os_thread_, stacksize, ec);
+        register_thread(std::move(f), desc, initial_state, run_now,
+            stacksize, util::high_resolution_clock::now(), ec);
     }
 
     // Schedule given function for execution in this executor no sooner
@@ -57,13 +98,18 @@ namespace hpx { namespace threads { namespace executors { namespace detail
         closure_type&& f, util::thread_description const& description,
         threads::thread_stacksize stacksize, error_code& ec)
     {
-        if (stacksize == threads::thread_stacksize_default)
-            stacksize = stacksize_;
+        // the deadline is relative to the time the thread will be scheduled
+        std::uint64_t start_time = util::high_resolution_clock::now();
+        util::steady_clock::time_point now = util::steady_clock::now();
+        if (abs_time > now)
+        {
+            start_time += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                abs_time - now).count();
+        }
 
         // create new thread
-        thread_id_type id = register_thread_nullary(
-            std::move(f), description, suspended, false,
-            priority_, os_thread_, stacksize, ec);
+        thread_id_type id = register_thread(std::move(f), description,
+            suspended, false, stacksize, start_time, ec);
         if (ec) return;
 
         HPX_ASSERT(invalid_thread_id != id);    // would throw otherwise
@@ -151,6 +151,7 @@ namespace hpx { namespace threads
         socket_affinity_masks_.reserve(num_of_pus_);
         numa_node_affinity_masks_.reserve(num_of_pus_);
         core_affinity_masks_.reserve(num_of_pus_);
+        cache_affinity_masks_.reserve(num_of_pus_);
         thread_affinity_masks_.reserve(num_of_pus_);
 
         for (std::size_t i = 0; i < num_of_pus_; ++i)
@@ -168,6 +169,11 @@ namespace hpx { namespace threads
             core_affinity_masks_.push_back(init_core_affinity_mask(i));
         }
 
+        for (std::size_t i = 0; i < num_of_pus_; ++i)
+        {
+            cache_affinity_masks_.push_back(init_cache_affinity_mask(i));
+        }
+
         for (std::size_t i = 0; i < num_of_pus_; ++i)
         {
             thread_affinity_masks_.push_back(init_thread_affinity_mask(i));
@@ -323,6 +329,30 @@ namespace hpx { namespace threads
         return empty_mask;
     }
 
+    mask_cref_type hwloc_topology::get_cache_affinity_mask(
+        std::size_t num_thread
+      , bool numa_sensitive
+      , error_code& ec
+        ) const
+    {
+        std::size_t num_pu = num_thread % num_of_pus_;
+
+        if (num_pu < cache_affinity_masks_.size())
+        {
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return cache_affinity_masks_[num_pu];
+        }
+
+        HPX_THROWS_IF(ec, bad_parameter
+          , "hpx::threads::hwloc_topology::get_cache_affinity_mask"
+          , boost::str(boost::format(
+                "thread number %1% is out of range")
+                % num_thread));
+        return empty_mask;
+    }
+
     mask_cref_type hwloc_topology::get_thread_affinity_mask(
         std::size_t num_thread
       , bool numa_sensitive
@@ -918,6 +948,47 @@ namespace hpx { namespace threads
         return default_mask;
     } // }}}
 
+    mask_type hwloc_topology::init_cache_affinity_mask(
+        std::size_t num_thread
+        ) const
+    { // {{{
+        std::size_t num_pu = (num_thread + pu_offset) % num_of_pus_;
+
+        hwloc_obj_t cache_obj = nullptr;
+
+        {
+            std::unique_lock<hpx::util::spinlock> lk(topo_mtx);
+            hwloc_obj_t obj = hwloc_get_obj_by_type(topo, HWLOC_OBJ_PU,
+                static_cast<unsigned>(num_pu));
+
+            // find the outermost cache object below the socket level
+            while (obj != nullptr && obj->type != HWLOC_OBJ_SOCKET &&
+                obj->type != HWLOC_OBJ_MACHINE)
+            {
+#if HWLOC_API_VERSION >= 0x00020000
+                if (hwloc_obj_type_is_cache(obj->type))
+#else
+                if (obj->type == HWLOC_OBJ_CACHE)
+#endif
+                {
+                    cache_obj = obj;
+                }
+                obj = obj->parent;
+            }
+        }
+
+        if (cache_obj)
+        {
+            mask_type cache_affinity_mask = mask_type();
+            resize(cache_affinity_mask, get_number_of_pus());
+
+            extract_node_mask(cache_obj, cache_affinity_mask);
+            return cache_affinity_mask;
+        }
+
+        return get_core_affinity_mask(num_thread, false);
+    } // }}}
+
     mask_type hwloc_topology::init_thread_affinity_mask(
         std::size_t num_thread
         ) const
@@ -1105,6 +1176,21 @@ namespace hpx { namespace threads
     {
         hwloc_free(topo, addr, len);
     }
+
+    /// Bind the given memory area to the given NUMA domain
+    bool hwloc_topology::set_area_membind_nodeset(void const* addr,
+        std::size_t len, std::size_t numa_node) const
+    {
+        std::unique_lock<hpx::util::spinlock> lk(topo_mtx);
+
+        hwloc_obj_t node_obj = hwloc_get_obj_by_type(topo,
+            HWLOC_OBJ_NODE, static_cast<unsigned>(numa_node));
+        if (node_obj == nullptr)
+            return false;
+
+        return hwloc_set_area_membind_nodeset(topo, addr, len,
+            node_obj->nodeset, HWLOC_MEMBIND_BIND, 0) != -1;
+    }
 }}
 
 #endif
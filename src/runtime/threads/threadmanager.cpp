@@ -11,6 +11,7 @@
 #include <hpx/performance_counters/counters.hpp>
 #include <hpx/performance_counters/counter_creators.hpp>
 #include <hpx/performance_counters/manage_counter_type.hpp>
+#include <hpx/runtime/get_config_entry.hpp>
 #include <hpx/runtime/threads/topology.hpp>
 #include <hpx/runtime/threads/threadmanager_impl.hpp>
 #include <hpx/runtime/threads/thread_data.hpp>
@@ -26,6 +27,7 @@
 #include <hpx/util/logging.hpp>
 #include <hpx/util/hardware/timestamp.hpp>
 #include <hpx/util/runtime_configuration.hpp>
+#include <hpx/util/safe_lexical_cast.hpp>
 
 #include <boost/format.hpp>
 
@@ -126,6 +128,7 @@ namespace hpx { namespace threads
             "medium",
             "large",
             "huge",
+            "nostack",
         };
     }
 
@@ -143,8 +146,10 @@ namespace hpx { namespace threads
             size = thread_stacksize_large;
         else if (rtcfg.get_stack_size(thread_stacksize_huge) == size)
             size = thread_stacksize_huge;
+        else if (rtcfg.get_stack_size(thread_stacksize_nostack) == size)
+            size = thread_stacksize_nostack;
 
-        if (size < thread_stacksize_small || size > thread_stacksize_huge)
+        if (size < thread_stacksize_small || size > thread_stacksize_nostack)
             return "custom";
 
         return strings::stack_size_names[size-1];
@@ -167,6 +172,11 @@ namespace hpx { namespace threads
                 policies::do_background_work | policies::reduce_thread_priority |
                 policies::delay_exit)),
         notifier_(notifier)
+#ifdef HPX_HAVE_THREAD_IDLE_RATES
+      , elasticity_min_threads_(1),
+        elasticity_shrink_idle_rate_(9000),
+        elasticity_grow_idle_rate_(2000)
+#endif
     {}
 
     template <typename SchedulingPolicy>
@@ -237,6 +247,15 @@ namespace hpx { namespace threads
         pool_.create_thread(data, id, initial_state, run_now, ec);
     }
 
+    template <typename SchedulingPolicy>
+    void threadmanager_impl<SchedulingPolicy>::
+        register_thread_bulk(std::vector<thread_init_data>& data,
+            thread_state_enum initial_state, error_code& ec)
+    {
+        util::block_profiler_wrapper<register_thread_tag> bp(thread_logger_);
+        pool_.create_threads(data, initial_state, ec);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename SchedulingPolicy>
     void threadmanager_impl<SchedulingPolicy>::register_work(
@@ -780,6 +799,53 @@ namespace hpx { namespace threads
                   static_cast<std::size_t>(paths.instanceindex_), _1),
               "allocator", HPX_COROUTINE_NUM_ALL_HEAPS
             },
+            // /threads{locality#%d/total}/count/deadline-misses
+            // /threads{locality#%d/worker-thread%d}/count/deadline-misses
+            { "count/deadline-misses",
+              util::bind(&spt::get_num_deadline_misses, &pool_,
+                  std::size_t(-1), _1),
+              util::bind(&spt::get_num_deadline_misses, &pool_,
+                  static_cast<std::size_t>(paths.instanceindex_), _1),
+              "worker-thread", shepherd_count
+            },
+#ifdef HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF
+            // /threads{locality#%d/total}/count/idle-backoffs
+            // /threads{locality#%d/worker-thread%d}/count/idle-backoffs
+            { "count/idle-backoffs",
+              util::bind(&spt::get_idle_backoff_count, &pool_,
+                  std::size_t(-1), _1),
+              util::bind(&spt::get_idle_backoff_count, &pool_,
+                  static_cast<std::size_t>(paths.instanceindex_), _1),
+              "worker-thread", shepherd_count
+            },
+            // /threads{locality#%d/total}/count/idle-parks
+            // /threads{locality#%d/worker-thread%d}/count/idle-parks
+            { "count/idle-parks",
+              util::bind(&spt::get_idle_park_count, &pool_,
+                  std::size_t(-1), _1),
+              util::bind(&spt::get_idle_park_count, &pool_,
+                  static_cast<std::size_t>(paths.instanceindex_), _1),
+              "worker-thread", shepherd_count
+            },
+            // /threads{locality#%d/total}/time/idle-wakeup-latency
+            // /threads{locality#%d/worker-thread%d}/time/idle-wakeup-latency
+            { "time/idle-wakeup-latency",
+              util::bind(&spt::get_idle_wakeup_latency, &pool_,
+                  std::size_t(-1), _1),
+              util::bind(&spt::get_idle_wakeup_latency, &pool_,
+                  static_cast<std::size_t>(paths.instanceindex_), _1),
+              "worker-thread", shepherd_count
+            },
+            // /threads{locality#%d/total}/time/idle-backoff
+            // /threads{locality#%d/worker-thread%d}/time/idle-backoff
+            { "time/idle-backoff",
+              util::bind(&spt::get_idle_backoff_time, &pool_,
+                  std::size_t(-1), _1),
+              util::bind(&spt::get_idle_backoff_time, &pool_,
+                  static_cast<std::size_t>(paths.instanceindex_), _1),
+              "worker-thread", shepherd_count
+            },
+#endif
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
             // /threads{locality#%d/total}/count/pending-misses
             // /threads{locality#%d/worker-thread%d}/count/pending-misses
@@ -1043,6 +1109,47 @@ namespace hpx { namespace threads
               &locality_allocator_counter_discoverer,
               ""
             },
+            { "/threads/count/deadline-misses", performance_counters::counter_raw,
+              "returns the number of HPX-threads which terminated after their "
+              "deadline on the referenced worker-thread on the referenced "
+              "locality (only reported by the deadline scheduler)",
+              HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+              &performance_counters::locality_thread_counter_discoverer,
+              ""
+            },
+#ifdef HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF
+            { "/threads/count/idle-backoffs", performance_counters::counter_raw,
+              "returns the number of times the referenced worker-thread on "
+              "the referenced locality went to sleep for a backoff period "
+              "because it did not find any work",
+              HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+              &performance_counters::locality_thread_counter_discoverer,
+              ""
+            },
+            { "/threads/count/idle-parks", performance_counters::counter_raw,
+              "returns the number of times the referenced worker-thread on "
+              "the referenced locality was parked after exceeding its maximum "
+              "backoff period",
+              HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+              &performance_counters::locality_thread_counter_discoverer,
+              ""
+            },
+            { "/threads/time/idle-wakeup-latency",
+              performance_counters::counter_raw,
+              "returns the average time between new work being scheduled and "
+              "a sleeping worker-thread on the referenced locality resuming "
+              "execution", HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+              &performance_counters::locality_thread_counter_discoverer,
+              "ns"
+            },
+            { "/threads/time/idle-backoff", performance_counters::counter_raw,
+              "returns the current sleep threshold (backoff period or park "
+              "timeout) of the referenced worker-thread on the referenced "
+              "locality", HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+              &performance_counters::locality_thread_counter_discoverer,
+              "ns"
+            },
+#endif
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
             { "/threads/count/pending-misses", performance_counters::counter_raw,
               "returns the number of times that the referenced worker-thread "
@@ -1120,6 +1227,82 @@ namespace hpx { namespace threads
         return true;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename SchedulingPolicy>
+    void threadmanager_impl<SchedulingPolicy>::
+        set_active_os_thread_count(std::size_t count, error_code& ec)
+    {
+        std::lock_guard<mutex_type> lk(mtx_);
+        pool_.set_active_os_thread_count(count, ec);
+    }
+
+    template <typename SchedulingPolicy>
+    void threadmanager_impl<SchedulingPolicy>::start_elasticity_policy()
+    {
+        if (get_config_entry("hpx.elasticity.enabled", "0") != "1")
+            return;
+
+#ifdef HPX_HAVE_THREAD_IDLE_RATES
+        if (!pool_.supports_retiring_workers())
+        {
+            LTM_(warning) << "start_elasticity_policy: the scheduler does "
+                "not support changing the number of active OS threads";
+            return;
+        }
+
+        std::int64_t interval = util::safe_lexical_cast<std::int64_t>(
+            get_config_entry("hpx.elasticity.interval", "100"), 100);
+        elasticity_min_threads_ = util::safe_lexical_cast<std::size_t>(
+            get_config_entry("hpx.elasticity.min_threads", "1"), 1);
+        elasticity_shrink_idle_rate_ = 100 *
+            util::safe_lexical_cast<std::int64_t>(
+                get_config_entry("hpx.elasticity.shrink_idle_rate", "90"), 90);
+        elasticity_grow_idle_rate_ = 100 *
+            util::safe_lexical_cast<std::int64_t>(
+                get_config_entry("hpx.elasticity.grow_idle_rate", "20"), 20);
+
+        if (elasticity_min_threads_ == 0)
+            elasticity_min_threads_ = 1;
+
+        // start a fresh measurement
+        pool_.sample_active_idle_rate();
+
+        elasticity_timer_.reset(new util::interval_timer(
+            util::bind(&threadmanager_impl::adapt_active_os_thread_count, this),
+            interval * 1000, "threadmanager_impl::elasticity_policy", true));
+        elasticity_timer_->start(false);
+#else
+        LTM_(warning) << "start_elasticity_policy: the elasticity policy "
+            "requires HPX_WITH_THREAD_IDLE_RATES to be enabled";
+#endif
+    }
+
+#ifdef HPX_HAVE_THREAD_IDLE_RATES
+    // Retire one OS thread whenever the active OS threads are mostly idle,
+    // reactivate one whenever they are mostly busy.
+    template <typename SchedulingPolicy>
+    bool threadmanager_impl<SchedulingPolicy>::adapt_active_os_thread_count()
+    {
+        std::lock_guard<mutex_type> lk(mtx_);
+
+        std::int64_t idle_rate = pool_.sample_active_idle_rate();
+        std::size_t active = pool_.get_active_os_thread_count();
+
+        error_code ec(lightweight);
+        if (idle_rate > elasticity_shrink_idle_rate_ &&
+            active > elasticity_min_threads_)
+        {
+            pool_.set_active_os_thread_count(active - 1, ec);
+        }
+        else if (idle_rate < elasticity_grow_idle_rate_ &&
+            active < pool_.get_os_thread_count())
+        {
+            pool_.set_active_os_thread_count(active + 1, ec);
+        }
+        return true;
+    }
+#endif
+
     template <typename SchedulingPolicy>
     void threadmanager_impl<SchedulingPolicy>::
         stop (bool blocking)
@@ -1275,6 +1458,11 @@ template class HPX_EXPORT hpx::threads::threadmanager_impl<
     hpx::threads::policies::abp_fifo_priority_queue_scheduler>;
 #endif
 
+#if defined(HPX_HAVE_CHASE_LEV_SCHEDULER)
+template class HPX_EXPORT hpx::threads::threadmanager_impl<
+    hpx::threads::policies::chase_lev_priority_queue_scheduler>;
+#endif
+
 #if defined(HPX_HAVE_HIERARCHY_SCHEDULER)
 #include <hpx/runtime/threads/policies/hierarchy_scheduler.hpp>
 template class HPX_EXPORT hpx::threads::threadmanager_impl<
@@ -1287,3 +1475,9 @@ template class HPX_EXPORT hpx::threads::threadmanager_impl<
     hpx::threads::policies::periodic_priority_queue_scheduler<> >;
 #endif
 
+#if defined(HPX_HAVE_DEADLINE_SCHEDULER)
+#include <hpx/runtime/threads/policies/deadline_queue_scheduler.hpp>
+template class HPX_EXPORT hpx::threads::threadmanager_impl<
+    hpx::threads::policies::deadline_queue_scheduler<> >;
+#endif
+
@@ -258,6 +258,9 @@ namespace hpx {
 
         parcel_handler_.enable_alternative_parcelports();
 
+        // adapt the number of active worker threads to the load, if enabled
+        thread_manager_->start_elasticity_policy();
+
         // reset all counters right before running main, if requested
         if (get_config_entry("hpx.print_counter.startup", "0") == "1")
         {
@@ -835,6 +838,11 @@ template class HPX_EXPORT hpx::runtime_impl<
     hpx::threads::policies::abp_fifo_priority_queue_scheduler>;
 #endif
 
+#if defined(HPX_HAVE_CHASE_LEV_SCHEDULER)
+template class HPX_EXPORT hpx::runtime_impl<
+    hpx::threads::policies::chase_lev_priority_queue_scheduler>;
+#endif
+
 #if defined(HPX_HAVE_HIERARCHY_SCHEDULER)
 #include <hpx/runtime/threads/policies/hierarchy_scheduler.hpp>
 template class HPX_EXPORT hpx::runtime_impl<
@@ -847,3 +855,9 @@ template class HPX_EXPORT hpx::runtime_impl<
     hpx::threads::policies::periodic_priority_queue_scheduler<> >;
 #endif
 
+#if defined(HPX_HAVE_DEADLINE_SCHEDULER)
+#include <hpx/runtime/threads/policies/deadline_queue_scheduler.hpp>
+template class HPX_EXPORT hpx::runtime_impl<
+    hpx::threads::policies::deadline_queue_scheduler<> >;
+#endif
+
@@ -277,6 +277,28 @@ namespace hpx { namespace util
             return cfgmap.get_value<std::size_t>("hpx.numa_sensitive", default_);
         }
 
+        bool handle_hierarchical_stealing(util::manage_config& cfgmap,
+            boost::program_options::variables_map& vm, bool default_)
+        {
+            if (vm.count("hpx:hierarchical-stealing") != 0)
+                return true;
+
+            // use either cfgmap value or default
+            return cfgmap.get_value<int>("hpx.hierarchical_stealing",
+                default_ ? 1 : 0) != 0;
+        }
+
+        std::size_t handle_max_steal_attempts(util::manage_config& cfgmap,
+            boost::program_options::variables_map& vm, std::size_t default_)
+        {
+            if (vm.count("hpx:hierarchical-stealing") != 0)
+                return vm["hpx:hierarchical-stealing"].as<std::size_t>();
+
+            // use either cfgmap value or default
+            return cfgmap.get_value<std::size_t>("hpx.max_steal_attempts",
+                default_);
+        }
+
         ///////////////////////////////////////////////////////////////////////
         std::size_t handle_num_threads(util::manage_config& cfgmap,
             boost::program_options::variables_map& vm,
@@ -697,6 +719,15 @@ namespace hpx { namespace util
             affinity_bind_.empty() ? 0 : 1);
         ini_config += "hpx.numa_sensitive=" + std::to_string(numa_sensitive_);
 
+        hierarchical_stealing_ =
+            detail::handle_hierarchical_stealing(cfgmap, vm, false);
+        ini_config += std::string("hpx.hierarchical_stealing=") +
+            (hierarchical_stealing_ ? "1" : "0");
+
+        max_steal_attempts_ = detail::handle_max_steal_attempts(cfgmap, vm, 0);
+        ini_config += "hpx.max_steal_attempts=" +
+            std::to_string(max_steal_attempts_);
+
         // default affinity mode is now 'balanced' (only if no pu-step or
         // pu-offset is given)
         if (pu_step_ == 1 && pu_offset_ == std::size_t(-1) && affinity_bind_.empty())
@@ -452,7 +452,8 @@ namespace hpx { namespace util
                 ("hpx:queuing", value<std::string>(),
                   "the queue scheduling policy to use, options are "
                   "'local', 'local-priority', 'abp-priority', "
-                  "'hierarchy', 'static', 'static-priority', and "
+                  "'chase-lev-priority', 'deadline', 'hierarchy', 'static', "
+                  "'static-priority', and "
                   "'periodic-priority' (default: 'local-priority'; "
                   "all option values can be abbreviated)")
                 ("hpx:hierarchy-arity", value<std::size_t>(),
@@ -462,12 +463,22 @@ namespace hpx { namespace util
                   "the number of operating system threads maintaining a high "
                   "priority queue (default: number of OS threads), valid for "
                   "--hpx:queuing=local-priority,--hpx:queuing=static-priority, "
+                  "--hpx:queuing=chase-lev-priority, --hpx:queuing=deadline, "
                   " and --hpx:queuing=abp-priority only)")
                 ("hpx:numa-sensitive", value<std::size_t>()->implicit_value(0),
                   "makes the local-priority scheduler NUMA sensitive ("
                   "allowed values: 0 - no NUMA sensitivity, 1 - allow only for "
                   "boundary cores to steal across NUMA domains, 2 - "
                   "no cross boundary stealing is allowed (default value: 0)")
+                ("hpx:hierarchical-stealing",
+                  value<std::size_t>()->implicit_value(0),
+                  "makes the priority schedulers steal from the closest "
+                  "queues first (hyperthread siblings, shared caches, NUMA "
+                  "domain, everything else), the optional value limits the "
+                  "number of failed steal attempts per scheduling cycle "
+                  "(default value: 0, i.e. no limit), valid for "
+                  "--hpx:queuing=local-priority and "
+                  "--hpx:queuing=chase-lev-priority only")
             ;
 
             options_description config_options("HPX configuration options");
@@ -18,6 +18,10 @@
 #include <hpx/util/safe_lexical_cast.hpp>
 #include <hpx/version.hpp>
 
+#if defined(__linux) || defined(linux) || defined(__linux__) || defined(__FreeBSD__)
+#include <hpx/runtime/threads/coroutines/detail/posix_utility.hpp>
+#endif
+
 #include <boost/detail/endian.hpp>
 #include <boost/preprocessor/stringize.hpp>
 #include <boost/spirit/include/qi_parse.hpp>
@@ -186,6 +190,8 @@ namespace hpx { namespace util
             "pu_step = 1",
             "pu_offset = 0",
             "numa_sensitive = 0",
+            "hierarchical_stealing = 0",
+            "max_steal_attempts = 0",
             "max_background_threads = ${MAX_BACKGROUND_THREADS:$[hpx.os_threads]}",
 
             // connect back to the given latch if specified
@@ -203,8 +209,28 @@ namespace hpx { namespace util
                 BOOST_PP_STRINGIZE(HPX_HUGE_STACK_SIZE) "}",
 #if defined(__linux) || defined(linux) || defined(__linux__) || defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
+            "use_stack_cache = ${HPX_USE_STACK_CACHE:0}",
+            "use_huge_pages = ${HPX_USE_HUGE_PAGES:0}",
+            "slab_size = ${HPX_STACK_SLAB_SIZE:32}",
 #endif
 
+            // idle policy of the worker threads, all times are in
+            // microseconds
+            "[hpx.idle_backoff]",
+            "enabled = ${HPX_IDLE_BACKOFF:1}",
+            "min_time = ${HPX_IDLE_BACKOFF_MIN_TIME:10}",
+            "max_time = ${HPX_IDLE_BACKOFF_MAX_TIME:1000}",
+            "park_timeout = ${HPX_IDLE_PARK_TIMEOUT:10000}",
+
+            // adapt the number of active worker threads to the measured
+            // idle-rate (in percent), the interval is in milliseconds
+            "[hpx.elasticity]",
+            "enabled = ${HPX_ELASTICITY:0}",
+            "interval = ${HPX_ELASTICITY_INTERVAL:100}",
+            "min_threads = ${HPX_ELASTICITY_MIN_THREADS:1}",
+            "shrink_idle_rate = ${HPX_ELASTICITY_SHRINK_IDLE_RATE:90}",
+            "grow_idle_rate = ${HPX_ELASTICITY_GROW_IDLE_RATE:20}",
+
             "[hpx.threadpools]",
             "io_pool_size = ${HPX_NUM_IO_POOL_SIZE:"
                 BOOST_PP_STRINGIZE(HPX_NUM_IO_POOL_SIZE) "}",
@@ -259,6 +285,10 @@ namespace hpx { namespace util
             "dedicated_server = 0",
             "local_cache_size = ${HPX_AGAS_LOCAL_CACHE_SIZE:"
                 BOOST_PP_STRINGIZE(HPX_AGAS_LOCAL_CACHE_SIZE) "}",
+            "local_cache_shards = ${HPX_AGAS_LOCAL_CACHE_SHARDS:16}",
+            "primary_namespace_partitions = "
+                "${HPX_AGAS_PRIMARY_NAMESPACE_PARTITIONS:64}",
+            "local_cache_prefetch = ${HPX_AGAS_LOCAL_CACHE_PREFETCH:0}",
             "use_range_caching = ${HPX_AGAS_USE_RANGE_CACHING:1}",
             "use_caching = ${HPX_AGAS_USE_CACHING:1}",
 
@@ -467,6 +497,14 @@ namespace hpx { namespace util
         threads::coroutines::detail::posix::use_guard_pages =
             init_use_stack_guard_pages();
 #endif
+#if defined(HPX_HAVE_THREAD_STACK_CACHE)
+        threads::coroutines::detail::posix::use_stack_cache =
+            init_use_stack_cache();
+        threads::coroutines::detail::posix::use_huge_pages =
+            init_use_huge_pages();
+        threads::coroutines::detail::posix::stack_cache_slab_size =
+            init_stack_slab_size();
+#endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
         if (enable_lock_detection())
             util::enable_lock_detection();
@@ -528,6 +566,14 @@ namespace hpx { namespace util
         threads::coroutines::detail::posix::use_guard_pages =
             init_use_stack_guard_pages();
 #endif
+#if defined(HPX_HAVE_THREAD_STACK_CACHE)
+        threads::coroutines::detail::posix::use_stack_cache =
+            init_use_stack_cache();
+        threads::coroutines::detail::posix::use_huge_pages =
+            init_use_huge_pages();
+        threads::coroutines::detail::posix::stack_cache_slab_size =
+            init_stack_slab_size();
+#endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
         if (enable_lock_detection())
             util::enable_lock_detection();
@@ -660,6 +706,53 @@ namespace hpx { namespace util
         return cache_size;
     }
 
+    std::size_t runtime_configuration::get_agas_local_cache_shards() const
+    {
+        std::size_t num_shards = 16;
+
+        if (has_section("hpx.agas")) {
+            util::section const* sec = get_section("hpx.agas");
+            if (nullptr != sec) {
+                num_shards = hpx::util::get_entry_as<std::size_t>(
+                    *sec, "local_cache_shards", num_shards);
+            }
+        }
+
+        if (num_shards == 0)
+            num_shards = 1;      // limit lower bound
+        return num_shards;
+    }
+
+    std::size_t runtime_configuration::get_agas_primary_namespace_partitions()
+        const
+    {
+        std::size_t num_partitions = 64;
+
+        if (has_section("hpx.agas")) {
+            util::section const* sec = get_section("hpx.agas");
+            if (nullptr != sec) {
+                num_partitions = hpx::util::get_entry_as<std::size_t>(
+                    *sec, "primary_namespace_partitions", num_partitions);
+            }
+        }
+
+        if (num_partitions == 0)
+            num_partitions = 1;      // limit lower bound
+        return num_partitions;
+    }
+
+    std::size_t runtime_configuration::get_agas_local_cache_prefetch() const
+    {
+        if (has_section("hpx.agas")) {
+            util::section const* sec = get_section("hpx.agas");
+            if (nullptr != sec) {
+                return hpx::util::get_entry_as<std::size_t>(
+                    *sec, "local_cache_prefetch", 0);
+            }
+        }
+        return 0;
+    }
+
     bool runtime_configuration::get_agas_caching_mode() const
     {
         if (has_section("hpx.agas")) {
@@ -918,6 +1011,42 @@ namespace hpx { namespace util
         }
         return true;    // default is true
     }
+
+    bool runtime_configuration::init_use_stack_cache() const
+    {
+        if (has_section("hpx")) {
+            util::section const* sec = get_section("hpx.stacks");
+            if (nullptr != sec) {
+                return hpx::util::get_entry_as<int>(
+                    *sec, "use_stack_cache", "0") != 0;
+            }
+        }
+        return false;    // default is false
+    }
+
+    bool runtime_configuration::init_use_huge_pages() const
+    {
+        if (has_section("hpx")) {
+            util::section const* sec = get_section("hpx.stacks");
+            if (nullptr != sec) {
+                return hpx::util::get_entry_as<int>(
+                    *sec, "use_huge_pages", "0") != 0;
+            }
+        }
+        return false;    // default is false
+    }
+
+    std::size_t runtime_configuration::init_stack_slab_size() const
+    {
+        if (has_section("hpx")) {
+            util::section const* sec = get_section("hpx.stacks");
+            if (nullptr != sec) {
+                return hpx::util::get_entry_as<std::size_t>(
+                    *sec, "slab_size", "32");
+            }
+        }
+        return 32;
+    }
 #endif
 
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
@@ -1011,6 +1140,9 @@ namespace hpx { namespace util
         case threads::thread_stacksize_huge:
             return huge_stacksize;
 
+        case threads::thread_stacksize_nostack:
+            return 0;   // stackless threads don't own a stack
+
         default:
         case threads::thread_stacksize_small:
             break;
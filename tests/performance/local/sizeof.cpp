@@ -26,6 +26,11 @@ using hpx::flush;
     (boost::format(fmter) % BOOST_PP_STRINGIZE(type) % sizeof(type))    \
     /**/
 
+#define HPX_ALIGNOF(type)                                               \
+    (boost::format(fmter) % "alignof(" BOOST_PP_STRINGIZE(type) ")"     \
+        % alignof(type))                                                \
+    /**/
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(
     variables_map&
@@ -38,6 +43,10 @@ int hpx_main(
              << HPX_SIZEOF(hpx::naming::id_type)
              << HPX_SIZEOF(hpx::naming::address)
              << HPX_SIZEOF(hpx::threads::thread_data)
+             << HPX_ALIGNOF(hpx::threads::thread_data)
+#if defined(HPX_THREAD_DATA_HAVE_COLD_DATA)
+             << HPX_SIZEOF(hpx::threads::detail::thread_data_cold)
+#endif
              << flush;
     }
 
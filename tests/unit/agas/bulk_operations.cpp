@@ -0,0 +1,200 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/runtime/agas/addressing_service.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server
+  : hpx::components::managed_component_base<test_server>
+{
+};
+
+typedef hpx::components::managed_component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server);
+
+struct test_client
+  : hpx::components::client_base<test_client, test_server>
+{
+    typedef hpx::components::client_base<test_client, test_server>
+        base_type;
+
+    test_client() {}
+    test_client(hpx::shared_future<hpx::id_type> const& id) : base_type(id) {}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void test_resolve_bulk()
+{
+    hpx::agas::addressing_service& agas = hpx::naming::get_agas_client();
+
+    // create objects on all localities, interleaving their ids
+    std::vector<test_client> clients;
+    std::vector<hpx::naming::gid_type> ids;
+    std::vector<hpx::id_type> localities;
+    for (int i = 0; i != 4; ++i)
+    {
+        for (hpx::id_type const& id : hpx::find_all_localities())
+        {
+            clients.push_back(test_client::create(id));
+            ids.push_back(hpx::naming::detail::get_stripped_gid(
+                clients.back().get_id().get_gid()));
+            localities.push_back(id);
+        }
+    }
+
+    // resolve the ids once with an empty cache, and once from the cache
+    for (int i = 0; i != 2; ++i)
+    {
+        if (i == 0)
+            agas.clear_cache();
+
+        std::vector<hpx::naming::address> addrs =
+            agas.resolve_bulk(ids).get();
+        HPX_TEST_EQ(addrs.size(), ids.size());
+
+        for (std::size_t j = 0; j != ids.size(); ++j)
+        {
+            HPX_TEST(addrs[j] == agas.resolve_async(ids[j]).get());
+            HPX_TEST(addrs[j].locality_ == localities[j].get_gid());
+        }
+    }
+}
+
+void test_bind_unbind_bulk()
+{
+    hpx::agas::addressing_service& agas = hpx::naming::get_agas_client();
+
+    std::size_t const count = 16;
+
+    hpx::naming::gid_type lower, upper;
+    HPX_TEST(agas.get_id_range(count, lower, upper));
+
+    hpx::components::component_type type =
+        hpx::components::get_component_type<server_type>();
+
+    std::vector<hpx::naming::gid_type> ids;
+    std::vector<hpx::naming::address> addrs;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        ids.push_back(lower + i);
+        addrs.push_back(hpx::naming::address(hpx::get_locality(), type,
+            0x1000 + i));
+    }
+
+    std::vector<bool> bound =
+        agas.bind_bulk(ids, addrs, hpx::get_locality()).get();
+    HPX_TEST_EQ(bound.size(), count);
+    for (std::size_t i = 0; i != count; ++i)
+        HPX_TEST(bound[i]);
+
+    std::vector<hpx::naming::address> resolved = agas.resolve_bulk(ids).get();
+    HPX_TEST_EQ(resolved.size(), count);
+    for (std::size_t i = 0; i != count; ++i)
+        HPX_TEST(resolved[i] == addrs[i]);
+
+    // binding the ids again updates the existing bindings
+    for (std::size_t i = 0; i != count; ++i)
+        addrs[i].address_ = 0x2000 + i;
+
+    bound = agas.bind_bulk(ids, addrs, hpx::get_locality()).get();
+    HPX_TEST_EQ(bound.size(), count);
+    for (std::size_t i = 0; i != count; ++i)
+        HPX_TEST(!bound[i]);
+
+    resolved = agas.resolve_bulk(ids).get();
+    HPX_TEST_EQ(resolved.size(), count);
+    for (std::size_t i = 0; i != count; ++i)
+        HPX_TEST(resolved[i] == addrs[i]);
+
+    std::vector<hpx::naming::address> unbound = agas.unbind_bulk(ids).get();
+    HPX_TEST_EQ(unbound.size(), count);
+    for (std::size_t i = 0; i != count; ++i)
+        HPX_TEST(unbound[i] == addrs[i]);
+
+    // the ids are neither known to AGAS nor cached anymore
+    bool caught_exception = false;
+    try {
+        agas.resolve_bulk(ids).get();
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const&) {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+// a failing request doesn't prevent the other requests from being handled
+void test_bind_bulk_failure()
+{
+    hpx::agas::addressing_service& agas = hpx::naming::get_agas_client();
+
+    std::size_t const count = 8;
+
+    hpx::naming::gid_type lower, upper;
+    HPX_TEST(agas.get_id_range(count, lower, upper));
+
+    hpx::components::component_type type =
+        hpx::components::get_component_type<server_type>();
+
+    std::vector<hpx::naming::gid_type> ids;
+    std::vector<hpx::naming::address> addrs;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        ids.push_back(lower + i);
+        addrs.push_back(hpx::naming::address(hpx::get_locality(), type,
+            0x1000 + i));
+    }
+
+    // binding an id to an invalid component type fails
+    std::size_t const invalid = count / 2;
+    addrs[invalid].type_ = hpx::components::component_invalid;
+
+    bool caught_exception = false;
+    try {
+        agas.bind_bulk(ids, addrs, hpx::get_locality()).get();
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const&) {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    ids.erase(ids.begin() + invalid);
+    addrs.erase(addrs.begin() + invalid);
+
+    std::vector<hpx::naming::address> resolved = agas.resolve_bulk(ids).get();
+    HPX_TEST_EQ(resolved.size(), ids.size());
+    for (std::size_t i = 0; i != ids.size(); ++i)
+        HPX_TEST(resolved[i] == addrs[i]);
+
+    std::vector<hpx::naming::address> unbound = agas.unbind_bulk(ids).get();
+    HPX_TEST_EQ(unbound.size(), ids.size());
+    for (std::size_t i = 0; i != ids.size(); ++i)
+        HPX_TEST(unbound[i] == addrs[i]);
+}
+
+int hpx_main()
+{
+    test_resolve_bulk();
+    test_bind_unbind_bulk();
+    test_bind_bulk_failure();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
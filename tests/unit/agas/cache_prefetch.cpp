@@ -0,0 +1,131 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/runtime/agas/addressing_service.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server
+  : hpx::components::component_base<test_server>
+{
+};
+
+typedef hpx::components::component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server);
+
+std::size_t const prefetch = 8;
+
+///////////////////////////////////////////////////////////////////////////////
+void test(hpx::id_type there)
+{
+    hpx::agas::addressing_service& agas = hpx::naming::get_agas_client();
+
+    std::vector<hpx::id_type> objects;
+    std::vector<hpx::naming::gid_type> ids;
+    for (std::size_t i = 0; i != 2 * prefetch; ++i)
+    {
+        objects.push_back(hpx::new_<test_server>(there).get());
+        ids.push_back(hpx::naming::detail::get_stripped_gid(
+            objects.back().get_gid()));
+    }
+
+    agas.clear_cache();
+    hpx::naming::address addr = agas.resolve_async(ids[0]).get();
+    HPX_TEST(addr.locality_ == there.get_gid());
+
+    // all objects following the first one closely enough should have been
+    // cached as well
+    for (std::size_t i = 1; i != ids.size(); ++i)
+    {
+        if (ids[i] < ids[0] || ids[0] + prefetch < ids[i])
+            continue;
+
+        hpx::agas::gva g;
+        hpx::naming::gid_type idbase;
+        HPX_TEST(agas.get_cache_entry(ids[i], g, idbase));
+        HPX_TEST(g.prefix == there.get_gid());
+    }
+
+    // objects not close to the first one should not have been cached
+    for (std::size_t i = 1; i != ids.size(); ++i)
+    {
+        if (!(ids[0] + prefetch < ids[i]))
+            continue;
+
+        hpx::agas::gva g;
+        hpx::naming::gid_type idbase;
+        HPX_TEST(!agas.get_cache_entry(ids[i], g, idbase));
+    }
+}
+
+// a neighbour which is being migrated is neither waited for nor cached
+void test_migrating_neighbour(hpx::id_type there)
+{
+    hpx::agas::addressing_service& agas = hpx::naming::get_agas_client();
+
+    std::vector<hpx::id_type> objects;
+    std::vector<hpx::naming::gid_type> ids;
+    for (std::size_t i = 0; i != prefetch; ++i)
+    {
+        objects.push_back(hpx::new_<test_server>(there).get());
+        ids.push_back(hpx::naming::detail::get_stripped_gid(
+            objects.back().get_gid()));
+    }
+
+    // find a neighbour of the first object which gets prefetched
+    std::size_t neighbour = 0;
+    for (std::size_t i = 1; i != ids.size(); ++i)
+    {
+        if (ids[0] < ids[i] && !(ids[0] + prefetch < ids[i]))
+        {
+            neighbour = i;
+            break;
+        }
+    }
+    if (neighbour == 0)
+        return;
+
+    agas.begin_migration_async(objects[neighbour]).get();
+
+    agas.clear_cache();
+    hpx::naming::address addr = agas.resolve_async(ids[0]).get();
+    HPX_TEST(addr.locality_ == there.get_gid());
+
+    hpx::agas::gva g;
+    hpx::naming::gid_type idbase;
+    HPX_TEST(!agas.get_cache_entry(ids[neighbour], g, idbase));
+
+    HPX_TEST(agas.end_migration_async(objects[neighbour]).get());
+}
+
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_all_localities())
+    {
+        test(id);
+        test_migrating_neighbour(id);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.agas.local_cache_prefetch!=" + std::to_string(prefetch)
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
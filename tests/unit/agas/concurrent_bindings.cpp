@@ -0,0 +1,143 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test binds, resolves, and unbinds ranges of ids of different sizes
+// from many threads at the same time, while adjusting their credits. The
+// ranges fall into the same partitions of the primary namespace tables or
+// span several of their blocks.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/runtime/agas/addressing_service.hpp>
+#include <hpx/runtime/agas/primary_namespace.hpp>
+#include <hpx/runtime/agas/server/primary_namespace.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server
+  : hpx::components::managed_component_base<test_server>
+{
+};
+
+typedef hpx::components::managed_component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server);
+
+std::size_t const num_tasks = 16;
+std::size_t const num_iterations = 50;
+
+// single ids, ranges within one block, and ranges spanning several blocks
+std::uint64_t const counts[] = { 1, 2, 100, 300, 70000 };
+
+std::uint64_t const offset = 8;
+
+///////////////////////////////////////////////////////////////////////////////
+// the credits are only moved around, the objects are not released
+void adjust_credits(hpx::naming::gid_type const& id)
+{
+    typedef hpx::agas::server::primary_namespace primary_ns_server;
+    typedef hpx::util::tuple<
+            std::int64_t, hpx::naming::gid_type, hpx::naming::gid_type
+        > request_type;
+
+    hpx::id_type const service(
+        hpx::agas::primary_namespace::get_service_instance(
+            hpx::get_locality()),
+        hpx::id_type::unmanaged);
+
+    HPX_TEST_EQ(primary_ns_server::increment_credit_action()(
+        service, std::int64_t(2), id, id), std::int64_t(0));
+
+    std::vector<request_type> requests(1,
+        hpx::util::make_tuple(std::int64_t(-2), id, id));
+    std::vector<std::int64_t> credits =
+        primary_ns_server::decrement_credit_action()(service, requests);
+    HPX_TEST_EQ(credits.size(), std::size_t(1));
+}
+
+bool check_resolve(hpx::naming::gid_type const& lower, std::uint64_t i,
+    hpx::naming::address const& base)
+{
+    hpx::agas::addressing_service& agas = hpx::naming::get_agas_client();
+
+    hpx::naming::address addr;
+    if (!agas.resolve_full_local(lower + i, addr))
+        return false;
+
+    return addr.locality_ == base.locality_ && addr.type_ == base.type_ &&
+        addr.address_ == base.address_ + i * offset;
+}
+
+void bind_resolve_unbind(std::size_t task)
+{
+    hpx::agas::addressing_service& agas = hpx::naming::get_agas_client();
+
+    hpx::components::component_type type =
+        hpx::components::get_component_type<server_type>();
+
+    for (std::size_t i = 0; i != num_iterations; ++i)
+    {
+        std::uint64_t const count =
+            counts[(task + i) % (sizeof(counts) / sizeof(counts[0]))];
+
+        hpx::naming::gid_type lower, upper;
+        HPX_TEST(agas.get_id_range(count, lower, upper));
+
+        hpx::naming::gid_type const id =
+            hpx::naming::detail::get_stripped_gid(lower);
+        hpx::naming::address const base(hpx::get_locality(), type,
+            0x100000 * (task + 1) + i * 0x1000);
+
+        HPX_TEST(agas.bind_range_local(id, count, base, offset));
+
+        HPX_TEST(check_resolve(id, 0, base));
+        HPX_TEST(check_resolve(id, count / 2, base));
+        HPX_TEST(check_resolve(id, count - 1, base));
+
+        // rebinding an existing range updates its address
+        hpx::naming::address const moved(hpx::get_locality(), type,
+            base.address_ + 0x800);
+        HPX_TEST(!agas.bind_range_local(id, count, moved, offset));
+        HPX_TEST(check_resolve(id, count - 1, moved));
+
+        adjust_credits(id);
+        adjust_credits(id + (count - 1));
+
+        hpx::naming::address addr;
+        HPX_TEST(agas.unbind_range_local(id, count, addr));
+        HPX_TEST_EQ(addr.address_, moved.address_);
+
+        hpx::error_code ec(hpx::lightweight);
+        HPX_TEST(!agas.resolve_full_local(id, addr, ec));
+        HPX_TEST(!agas.resolve_full_local(id + (count - 1), addr, ec));
+    }
+}
+
+int hpx_main()
+{
+    std::vector<hpx::future<void> > tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+        tasks.push_back(hpx::async(&bind_resolve_unbind, i));
+    hpx::wait_all(tasks);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // use few partitions to have the tasks run into each other
+    std::vector<std::string> const cfg = {
+        "hpx.agas.primary_namespace_partitions=4"
+    };
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
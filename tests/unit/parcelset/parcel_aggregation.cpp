@@ -0,0 +1,94 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that the parcel aggregation combines the parcels of a
+// burst of actions sent to the same locality into fewer messages, and that
+// all of the aggregated parcels are delivered.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+std::size_t const num_parcels = 1000;
+
+///////////////////////////////////////////////////////////////////////////////
+boost::atomic<std::size_t> received_count(0);
+
+void ping()
+{
+    ++received_count;
+}
+HPX_PLAIN_ACTION(ping);
+
+std::size_t received()
+{
+    return received_count.load();
+}
+HPX_PLAIN_ACTION(received);
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t query_counter(std::string const& name)
+{
+    hpx::performance_counters::performance_counter c(
+        "/" + name + "{locality#" + std::to_string(hpx::get_locality_id()) +
+        "/total}/count/aggregated");
+    return c.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+void test_aggregation(hpx::id_type const& dest)
+{
+    std::int64_t parcels_before = query_counter("parcels");
+    std::int64_t messages_before = query_counter("messages");
+
+    std::vector<hpx::future<void> > futures;
+    futures.reserve(num_parcels);
+    for (std::size_t i = 0; i != num_parcels; ++i)
+        futures.push_back(hpx::async(ping_action(), dest));
+    hpx::wait_all(futures);
+
+    HPX_TEST_EQ(received_action()(dest), num_parcels);
+
+    std::int64_t parcels = query_counter("parcels") - parcels_before;
+    std::int64_t messages = query_counter("messages") - messages_before;
+
+    // all parcels went through the aggregation, most of them were sent
+    // together with others
+    HPX_TEST(parcels >= std::int64_t(num_parcels));
+    HPX_TEST(messages > 0);
+    HPX_TEST(2 * messages < parcels);
+}
+
+int hpx_main()
+{
+    for (hpx::id_type const& dest : hpx::find_remote_localities())
+        test_aggregation(dest);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // wait long enough for the batches to fill up, the background work of the
+    // scheduler must not flush them early
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.aggregation=1",
+        "hpx.parcel.aggregation_max_parcels=64",
+        "hpx.parcel.aggregation_interval=10000",
+        "hpx.parcel.aggregation_background_flush=0"
+    };
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
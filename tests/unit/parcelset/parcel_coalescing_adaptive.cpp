@@ -0,0 +1,142 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that the adaptive coalescing message handler grows the
+// batches of coalesced parcels under dense traffic, shrinks them again if the
+// traffic drops, and sends parcels of sparse traffic right away.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/parcel_coalescing.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void ping() {}
+
+HPX_DECLARE_PLAIN_ACTION(ping, ping_action);
+HPX_ACTION_USES_MESSAGE_COALESCING(ping_action);
+HPX_PLAIN_ACTION(ping, ping_action);
+
+///////////////////////////////////////////////////////////////////////////////
+// coalescing interval in microseconds
+std::size_t const interval = 10000;
+
+struct coalescing_counts
+{
+    std::int64_t parcels_;
+    std::int64_t messages_;
+};
+
+coalescing_counts get_counts()
+{
+    std::string const instance = "/coalescing{locality#" +
+        std::to_string(hpx::get_locality_id()) + "/total}/count/";
+
+    hpx::performance_counters::performance_counter parcels(
+        instance + "parcels@ping_action");
+    hpx::performance_counters::performance_counter messages(
+        instance + "messages@ping_action");
+
+    coalescing_counts result = {
+        parcels.get_value<std::int64_t>(hpx::launch::sync),
+        messages.get_value<std::int64_t>(hpx::launch::sync)
+    };
+    return result;
+}
+
+// average number of parcels per message sent between the two samples
+double parcels_per_message(coalescing_counts const& before,
+    coalescing_counts const& after)
+{
+    std::int64_t messages = after.messages_ - before.messages_;
+    HPX_TEST(messages > 0);
+    return double(after.parcels_ - before.parcels_) / double(messages);
+}
+
+// send the given number of parcels, waiting for the given time in between
+void send(hpx::id_type const& dest, std::size_t count,
+    std::chrono::microseconds delay)
+{
+    std::vector<hpx::future<void> > futures;
+    futures.reserve(count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        futures.push_back(hpx::async(ping_action(), dest));
+        if (delay.count() != 0)
+            hpx::this_thread::sleep_for(delay);
+    }
+    hpx::wait_all(futures);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_adaptive_coalescing(hpx::id_type const& dest)
+{
+    // parcels arriving faster than the interval, but not fast enough to fill
+    // a batch let the batches shrink, measure after they had time to adapt
+    std::chrono::microseconds const moderate(interval / 5);
+    send(dest, 100, moderate);
+
+    coalescing_counts before = get_counts();
+    send(dest, 100, moderate);
+    double const moderate_before = parcels_per_message(before, get_counts());
+
+    // a burst of parcels lets the batches grow
+    before = get_counts();
+    send(dest, 10000, std::chrono::microseconds(0));
+    double const dense = parcels_per_message(before, get_counts());
+    HPX_TEST(dense > moderate_before);
+
+    // the batches shrink again if the traffic drops
+    send(dest, 100, moderate);
+
+    before = get_counts();
+    send(dest, 100, moderate);
+    double const moderate_after = parcels_per_message(before, get_counts());
+    HPX_TEST(moderate_after < dense);
+
+    // parcels of sparse traffic are sent right away
+    hpx::this_thread::sleep_for(std::chrono::microseconds(3 * interval));
+
+    before = get_counts();
+    send(dest, 20, std::chrono::microseconds(3 * interval));
+    coalescing_counts after = get_counts();
+    HPX_TEST_EQ(after.parcels_ - before.parcels_, std::int64_t(20));
+    HPX_TEST_EQ(after.messages_ - before.messages_, std::int64_t(20));
+}
+
+int hpx_main()
+{
+    for (hpx::id_type const& dest : hpx::find_remote_localities())
+    {
+        test_adaptive_coalescing(dest);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // the batches may be flushed only if they are full or the interval
+    // expired
+    std::vector<std::string> const cfg = {
+        "hpx.plugins.coalescing_message_handler.num_messages=100",
+        "hpx.plugins.coalescing_message_handler.interval=" +
+            std::to_string(interval),
+        "hpx.plugins.coalescing_message_handler.allow_background_flush=0",
+        "hpx.plugins.coalescing_message_handler.adaptive=1"
+    };
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
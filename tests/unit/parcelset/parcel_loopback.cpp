@@ -0,0 +1,107 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that parcels destined for the locality they are sent
+// from are run without being handed to a parcelport.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/runtime/parcelset/put_parcel.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const num_parcels = 100;
+
+boost::atomic<std::size_t> ping_count(0);
+boost::atomic<std::size_t> ping_sum(0);
+
+void ping(std::size_t i)
+{
+    ping_sum += i;
+    ++ping_count;
+}
+HPX_PLAIN_ACTION(ping);
+
+boost::atomic<std::size_t> write_handler_called(0);
+
+void write_handler(boost::system::error_code const& ec,
+    hpx::parcelset::parcel const&)
+{
+    HPX_TEST(!ec);
+    ++write_handler_called;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t get_count(std::string const& name)
+{
+    hpx::performance_counters::performance_counter c(
+        "/parcels{locality#" + std::to_string(hpx::get_locality_id()) +
+        "/total}/count/" + name);
+    return c.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+void test_loopback()
+{
+    std::int64_t loopback_before = get_count("loopback");
+    std::int64_t sent_before = get_count("tcp/sent");
+
+    // the address of the destination is resolved by the parcel handler
+    for (std::size_t i = 0; i != num_parcels; ++i)
+    {
+        hpx::parcelset::put_parcel_cb(&write_handler, hpx::find_here(),
+            hpx::naming::address(), ping_action(), i);
+    }
+
+    // all actions run, and all parcels are reported as sent
+    while (ping_count.load() != num_parcels ||
+        write_handler_called.load() != num_parcels)
+    {
+        hpx::this_thread::yield();
+    }
+    HPX_TEST_EQ(ping_sum.load(), num_parcels * (num_parcels - 1) / 2);
+
+    // the parcels were short-circuited instead of being sent over the network
+    HPX_TEST(get_count("loopback") - loopback_before >=
+        std::int64_t(num_parcels));
+    HPX_TEST_EQ(get_count("tcp/sent"), sent_before);
+}
+
+// parcels for other localities are still sent over the network
+void test_remote(hpx::id_type const& dest)
+{
+    std::int64_t sent_before = get_count("tcp/sent");
+
+    hpx::async<ping_action>(dest, std::size_t(0)).get();
+
+    HPX_TEST(get_count("tcp/sent") > sent_before);
+}
+
+int hpx_main()
+{
+    test_loopback();
+
+    for (hpx::id_type const& dest : hpx::find_remote_localities())
+    {
+        test_remote(dest);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,142 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that parcels of critical priority actions bypass the
+// bulk traffic to the same destination if the priority lanes are enabled, and
+// that the parcels waiting in the priority lane are included in the length of
+// the outgoing parcel queue.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+std::size_t const num_parcels = 100;
+std::size_t const parcel_size = 1024 * 1024;
+
+///////////////////////////////////////////////////////////////////////////////
+boost::atomic<std::size_t> bulk_count(0);
+
+void bulk(std::vector<char> const&)
+{
+    ++bulk_count;
+}
+HPX_PLAIN_ACTION(bulk);
+
+// returns the number of bulk parcels which were received before this one
+std::size_t probe()
+{
+    return bulk_count.load();
+}
+HPX_DEFINE_PLAIN_ACTION(probe, probe_action);
+HPX_ACTION_HAS_CRITICAL_PRIORITY(probe_action);
+HPX_REGISTER_ACTION(probe_action);
+
+void critical_bulk(std::vector<char> const&)
+{
+}
+HPX_DEFINE_PLAIN_ACTION(critical_bulk, critical_bulk_action);
+HPX_ACTION_HAS_CRITICAL_PRIORITY(critical_bulk_action);
+HPX_REGISTER_ACTION(critical_bulk_action);
+
+void reset()
+{
+    bulk_count = 0;
+}
+HPX_PLAIN_ACTION(reset);
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t pending_parcels()
+{
+    hpx::performance_counters::performance_counter c(
+        "/parcelqueue{locality#" + std::to_string(hpx::get_locality_id()) +
+        "/total}/length/send");
+    return c.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+// a critical parcel sent after a burst of large parcels overtakes them
+void test_lane_ordering(hpx::id_type const& dest)
+{
+    reset_action()(dest);
+
+    std::vector<char> data(parcel_size);
+
+    std::vector<hpx::future<void> > futures;
+    futures.reserve(num_parcels);
+    for (std::size_t i = 0; i != num_parcels; ++i)
+        futures.push_back(hpx::async(bulk_action(), dest, data));
+
+    // the burst is still pending when the probe is sent, without the
+    // priority lanes the probe would have to wait for most of it
+    std::size_t completed = 0;
+    for (hpx::future<void> const& f : futures)
+    {
+        if (f.is_ready())
+            ++completed;
+    }
+    HPX_TEST(completed < num_parcels / 2);
+
+    std::size_t received_before = hpx::async(probe_action(), dest).get();
+    HPX_TEST(received_before < num_parcels / 2);
+
+    hpx::wait_all(futures);
+    HPX_TEST_EQ(probe_action()(dest), num_parcels);
+}
+
+// the parcels waiting in the priority lane show up in the queue length
+void test_pending_count(hpx::id_type const& dest)
+{
+    std::vector<char> data(parcel_size);
+
+    std::vector<hpx::future<void> > futures;
+    futures.reserve(num_parcels);
+    for (std::size_t i = 0; i != num_parcels; ++i)
+        futures.push_back(hpx::async(critical_bulk_action(), dest, data));
+
+    // the priority lane uses a single connection per destination, most of
+    // the parcels have to wait for it
+    std::int64_t max_pending = 0;
+    hpx::future<void> all = hpx::when_all(futures);
+    while (!all.is_ready())
+    {
+        std::int64_t pending = pending_parcels();
+        if (pending > max_pending)
+            max_pending = pending;
+        hpx::this_thread::yield();
+    }
+    all.get();
+
+    HPX_TEST(max_pending > 0);
+}
+
+int hpx_main()
+{
+    for (hpx::id_type const& dest : hpx::find_remote_localities())
+    {
+        test_lane_ordering(dest);
+        test_pending_count(dest);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.priority_lanes=1"
+    };
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,136 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that large batches of parcels striped across several
+// connections to the same destination are delivered completely, that the
+// write handlers of all parcels are called, and that the send bandwidth
+// reported for the destination covers the data sent.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const num_parcels = 200;
+std::size_t const parcel_size = 64 * 1024;
+
+std::size_t receive(std::vector<char> const& data)
+{
+    std::size_t sum = 0;
+    for (char c : data)
+        sum += static_cast<unsigned char>(c);
+    return sum;
+}
+HPX_PLAIN_ACTION(receive);
+
+///////////////////////////////////////////////////////////////////////////////
+boost::atomic<std::size_t> write_handler_called(0);
+boost::atomic<std::size_t> write_handler_failed(0);
+
+void write_handler(boost::system::error_code const& ec,
+    hpx::parcelset::parcel const&)
+{
+    if (ec)
+        ++write_handler_failed;
+    ++write_handler_called;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t get_sent_bandwidth(std::string const& params, bool reset = false)
+{
+    hpx::performance_counters::performance_counter c(
+        "/data{locality#" + std::to_string(hpx::get_locality_id()) +
+        "/total}/bandwidth/tcp/sent" + params);
+    return c.get_value<std::int64_t>(hpx::launch::sync, reset);
+}
+
+void test_send_pipeline(hpx::id_type const& dest)
+{
+    std::string const dest_param =
+        "@" + std::to_string(hpx::naming::get_locality_id_from_id(dest));
+
+    write_handler_called.store(0);
+    write_handler_failed.store(0);
+
+    std::vector<std::vector<char> > data(num_parcels);
+    std::vector<std::size_t> expected(num_parcels);
+    for (std::size_t i = 0; i != num_parcels; ++i)
+    {
+        data[i].resize(parcel_size, static_cast<char>(i));
+        expected[i] = receive(data[i]);
+    }
+
+    // the bandwidth is measured from here on
+    std::int64_t start = hpx::util::high_resolution_clock::now();
+    get_sent_bandwidth(dest_param, true);
+
+    // send all parcels at once to let them queue up behind each other
+    std::vector<hpx::future<std::size_t> > futures;
+    futures.reserve(num_parcels);
+    for (std::size_t i = 0; i != num_parcels; ++i)
+    {
+        futures.push_back(
+            hpx::async_cb<receive_action>(dest, &write_handler, data[i]));
+    }
+    hpx::wait_all(futures);
+
+    // every parcel was delivered intact
+    for (std::size_t i = 0; i != num_parcels; ++i)
+        HPX_TEST_EQ(futures[i].get(), expected[i]);
+
+    // every write handler was called, without an error
+    while (write_handler_called.load() != num_parcels)
+        hpx::this_thread::yield();
+    HPX_TEST_EQ(write_handler_failed.load(), std::size_t(0));
+
+    // the data was written while messages were in flight, which can't have
+    // been longer than the time passed since the bandwidth was reset
+    std::int64_t bandwidth = get_sent_bandwidth(dest_param);
+    std::int64_t elapsed = hpx::util::high_resolution_clock::now() - start;
+
+    double const payload = double(num_parcels * parcel_size);
+    HPX_TEST(bandwidth > 0);
+    HPX_TEST(double(bandwidth) * double(elapsed) / 1e9 >= payload);
+
+    // nothing is sent to this locality itself
+    std::string const here_param = "@" + std::to_string(hpx::get_locality_id());
+    HPX_TEST_EQ(get_sent_bandwidth(here_param), std::int64_t(0));
+}
+
+int hpx_main()
+{
+    for (hpx::id_type const& dest : hpx::find_remote_localities())
+    {
+        test_send_pipeline(dest);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // stripe batches of at least two parcels across up to four connections
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.tcp.max_connections_per_locality=4",
+        "hpx.parcel.tcp.send_pipeline_depth=4",
+        "hpx.parcel.tcp.send_pipeline_threshold=" +
+            std::to_string(2 * parcel_size)
+    };
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
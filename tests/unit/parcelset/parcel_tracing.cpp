@@ -0,0 +1,190 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that the parcel trace records the stages of the parcels
+// on the sending and on the receiving locality, and that the trace is written
+// as well formed JSON.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/runtime/parcelset/detail/parcel_tracer.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using hpx::parcelset::detail::parcel_tracer;
+
+std::size_t const num_parcels = 100;
+
+///////////////////////////////////////////////////////////////////////////////
+void ping()
+{
+}
+HPX_PLAIN_ACTION(ping);
+
+std::string get_trace()
+{
+    std::ostringstream os;
+    parcel_tracer::instance().dump(os);
+    return os.str();
+}
+HPX_PLAIN_ACTION(get_trace);
+
+void clear_trace()
+{
+    parcel_tracer::instance().clear();
+}
+HPX_PLAIN_ACTION(clear_trace);
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t count_events(std::string const& trace, char const* stage)
+{
+    std::string const name = std::string("{\"name\":\"") + stage + "\"";
+
+    std::size_t count = 0;
+    for (std::string::size_type pos = trace.find(name);
+         pos != std::string::npos; pos = trace.find(name, pos + 1))
+    {
+        ++count;
+    }
+    return count;
+}
+
+// the braces and brackets outside of strings have to match
+bool is_well_formed(std::string const& trace)
+{
+    std::vector<char> nesting;
+    bool in_string = false;
+    for (std::size_t i = 0; i != trace.size(); ++i)
+    {
+        char c = trace[i];
+        if (in_string)
+        {
+            if (c == '\\')
+                ++i;
+            else if (c == '"')
+                in_string = false;
+            continue;
+        }
+
+        switch (c)
+        {
+        case '"':
+            in_string = true;
+            break;
+
+        case '{': case '[':
+            nesting.push_back(c);
+            break;
+
+        case '}': case ']':
+            if (nesting.empty() || nesting.back() != (c == '}' ? '{' : '['))
+                return false;
+            nesting.pop_back();
+            break;
+
+        default:
+            break;
+        }
+    }
+    return !in_string && nesting.empty();
+}
+
+bool starts_with(std::string const& str, std::string const& prefix)
+{
+    return str.compare(0, prefix.size(), prefix) == 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_trace(hpx::id_type const& dest)
+{
+    clear_trace();
+    clear_trace_action()(dest);
+
+    std::vector<hpx::future<void> > futures;
+    futures.reserve(num_parcels);
+    for (std::size_t i = 0; i != num_parcels; ++i)
+        futures.push_back(hpx::async(ping_action(), dest));
+    hpx::wait_all(futures);
+
+    std::string const prefix = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+    // the sending side of the parcels is recorded here
+    std::string local = get_trace();
+    HPX_TEST(starts_with(local, prefix));
+    HPX_TEST(is_well_formed(local));
+    HPX_TEST(count_events(local, "enqueue") >= num_parcels);
+    HPX_TEST(count_events(local, "encode") >= num_parcels);
+    HPX_TEST(count_events(local, "send") >= num_parcels);
+    HPX_TEST(local.find("ping_action") != std::string::npos);
+
+    // the receiving side of the parcels is recorded by the destination
+    std::string remote = get_trace_action()(dest);
+    HPX_TEST(starts_with(remote, prefix));
+    HPX_TEST(is_well_formed(remote));
+    HPX_TEST(count_events(remote, "receive") >= num_parcels);
+    HPX_TEST(count_events(remote, "decode") >= num_parcels);
+    HPX_TEST(count_events(remote, "schedule") >= num_parcels);
+    HPX_TEST(remote.find("ping_action") != std::string::npos);
+}
+
+void test_dump_file()
+{
+    std::string const filename = parcel_tracer::get_trace_filename(
+        "parcel_tracing_test.json", hpx::get_locality_id());
+
+    hpx::parcelset::dump_parcel_trace(filename);
+
+    std::ifstream in(filename.c_str());
+    HPX_TEST(in.is_open());
+
+    std::string trace((std::istreambuf_iterator<char>(in)),
+        std::istreambuf_iterator<char>());
+    HPX_TEST_EQ(trace, get_trace());
+
+    in.close();
+    std::remove(filename.c_str());
+}
+
+void test_trace_filename()
+{
+    HPX_TEST_EQ(parcel_tracer::get_trace_filename("trace.json", 1),
+        std::string("trace.1.json"));
+    HPX_TEST_EQ(parcel_tracer::get_trace_filename("trace", 2),
+        std::string("trace.2"));
+    HPX_TEST_EQ(parcel_tracer::get_trace_filename("out.d/trace", 0),
+        std::string("out.d/trace.0"));
+    HPX_TEST_EQ(parcel_tracer::get_trace_filename("out/.trace", 3),
+        std::string("out/.trace.3"));
+}
+
+int hpx_main()
+{
+    for (hpx::id_type const& dest : hpx::find_remote_localities())
+        test_trace(dest);
+
+    test_dump_file();
+    test_trace_filename();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.tracing=1"
+    };
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
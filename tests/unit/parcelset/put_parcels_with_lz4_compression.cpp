@@ -0,0 +1,197 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies the adaptive compression of the LZ4 serialization
+// filter: small messages and messages which don't compress well are sent
+// uncompressed, and the compression of an action is suspended after several
+// incompressible messages until it is probed again.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/compression_registration.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// the settings of the filter used by this test
+std::size_t const min_size = 4096;
+std::size_t const probe_interval = 8;
+
+// number of consecutive incompressible messages suspending the compression
+std::size_t const max_incompressible = 3;
+
+std::size_t const small_size = 1024;
+std::size_t const large_size = 64 * 1024;
+
+std::size_t checksum(std::vector<char> const& data)
+{
+    std::size_t sum = 0;
+    for (char c : data)
+        sum = sum * 31 + static_cast<unsigned char>(c);
+    return sum;
+}
+
+// every scenario uses its own action, as the filter keeps its statistics
+// per action
+HPX_DECLARE_PLAIN_ACTION(checksum, small_action);
+HPX_ACTION_USES_LZ4_COMPRESSION(small_action);
+HPX_PLAIN_ACTION(checksum, small_action);
+
+HPX_DECLARE_PLAIN_ACTION(checksum, compressible_action);
+HPX_ACTION_USES_LZ4_COMPRESSION(compressible_action);
+HPX_PLAIN_ACTION(checksum, compressible_action);
+
+HPX_DECLARE_PLAIN_ACTION(checksum, incompressible_action);
+HPX_ACTION_USES_LZ4_COMPRESSION(incompressible_action);
+HPX_PLAIN_ACTION(checksum, incompressible_action);
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<char> compressible_data(std::size_t size)
+{
+    return std::vector<char>(size, 'x');
+}
+
+std::vector<char> incompressible_data(std::size_t size)
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 255);
+
+    std::vector<char> data(size);
+    for (char& c : data)
+        c = static_cast<char>(dist(gen));
+    return data;
+}
+
+struct lz4_counts
+{
+    std::int64_t bytes_saved_;
+    std::int64_t compressed_;
+    std::int64_t uncompressed_;
+};
+
+lz4_counts get_counts()
+{
+    std::string const instance = "/compression{locality#" +
+        std::to_string(hpx::get_locality_id()) + "/total}/count/";
+
+    hpx::performance_counters::performance_counter bytes_saved(
+        instance + "bytes-saved");
+    hpx::performance_counters::performance_counter compressed(
+        instance + "compressed-messages");
+    hpx::performance_counters::performance_counter uncompressed(
+        instance + "uncompressed-messages");
+
+    lz4_counts result = {
+        bytes_saved.get_value<std::int64_t>(hpx::launch::sync),
+        compressed.get_value<std::int64_t>(hpx::launch::sync),
+        uncompressed.get_value<std::int64_t>(hpx::launch::sync)
+    };
+    return result;
+}
+
+// send the data the given number of times, one message at a time, and
+// return by how much the counters changed
+template <typename Action>
+lz4_counts send(hpx::id_type const& dest, std::vector<char> const& data,
+    std::size_t count)
+{
+    lz4_counts before = get_counts();
+
+    std::size_t const expected = checksum(data);
+    for (std::size_t i = 0; i != count; ++i)
+        HPX_TEST_EQ(hpx::async<Action>(dest, data).get(), expected);
+
+    lz4_counts after = get_counts();
+    lz4_counts result = {
+        after.bytes_saved_ - before.bytes_saved_,
+        after.compressed_ - before.compressed_,
+        after.uncompressed_ - before.uncompressed_
+    };
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// messages smaller than min_size are sent uncompressed
+void test_min_size(hpx::id_type const& dest)
+{
+    lz4_counts d = send<small_action>(dest, compressible_data(small_size), 4);
+    HPX_TEST_EQ(d.compressed_, std::int64_t(0));
+    HPX_TEST_EQ(d.uncompressed_, std::int64_t(4));
+    HPX_TEST_EQ(d.bytes_saved_, std::int64_t(0));
+}
+
+// compressible messages are sent compressed, the saved bytes are counted
+void test_compressible(hpx::id_type const& dest)
+{
+    lz4_counts d = send<compressible_action>(
+        dest, compressible_data(large_size), 4);
+    HPX_TEST_EQ(d.compressed_, std::int64_t(4));
+    HPX_TEST_EQ(d.uncompressed_, std::int64_t(0));
+    HPX_TEST(d.bytes_saved_ >= std::int64_t(4 * large_size / 2));
+}
+
+// messages exceeding max_ratio are stored uncompressed, after
+// max_incompressible of those the compression is suspended for
+// probe_interval messages
+void test_incompressible(hpx::id_type const& dest)
+{
+    std::vector<char> const data = incompressible_data(large_size);
+
+    lz4_counts d = send<incompressible_action>(dest, data, max_incompressible);
+    HPX_TEST_EQ(d.compressed_, std::int64_t(0));
+    HPX_TEST_EQ(d.uncompressed_, std::int64_t(max_incompressible));
+    HPX_TEST_EQ(d.bytes_saved_, std::int64_t(0));
+
+    // the suspended messages don't pass through the filter at all
+    d = send<incompressible_action>(dest, data, probe_interval);
+    HPX_TEST_EQ(d.compressed_, std::int64_t(0));
+    HPX_TEST_EQ(d.uncompressed_, std::int64_t(0));
+
+    // the next message probes the data again
+    d = send<incompressible_action>(dest, data, 1);
+    HPX_TEST_EQ(d.compressed_, std::int64_t(0));
+    HPX_TEST_EQ(d.uncompressed_, std::int64_t(1));
+
+    // a single miss does not suspend the compression, compressible data is
+    // compressed again
+    d = send<incompressible_action>(dest, compressible_data(large_size), 1);
+    HPX_TEST_EQ(d.compressed_, std::int64_t(1));
+    HPX_TEST_EQ(d.uncompressed_, std::int64_t(0));
+    HPX_TEST(d.bytes_saved_ > 0);
+}
+
+int hpx_main()
+{
+    for (hpx::id_type const& dest : hpx::find_remote_localities())
+    {
+        test_min_size(dest);
+        test_compressible(dest);
+        test_incompressible(dest);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.plugins.lz4_serialization_filter.adaptive=1",
+        "hpx.plugins.lz4_serialization_filter.min_size=" +
+            std::to_string(min_size),
+        "hpx.plugins.lz4_serialization_filter.max_ratio=90",
+        "hpx.plugins.lz4_serialization_filter.probe_interval=" +
+            std::to_string(probe_interval)
+    };
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
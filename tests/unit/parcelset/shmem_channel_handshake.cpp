@@ -0,0 +1,116 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies the handshake between the senders and the receiver of a
+// shared memory segment of the shared memory parcelport: the segment has to
+// be initialized before it can be used, every channel can be claimed by one
+// sender only, and the receiver is told which channels have new data.
+
+#include <hpx/config.hpp>
+#include <hpx/plugins/parcelport/shmem/ring_buffer.hpp>
+#include <hpx/plugins/parcelport/shmem/shared_memory.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+namespace shmem = hpx::parcelset::policies::shmem;
+
+std::size_t const num_channels = 4;
+std::size_t const ring_size = 4096;
+
+std::string segment_name()
+{
+    return "/hpx.shmem.test." + std::to_string(::getpid());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_handshake()
+{
+    std::string const name = segment_name();
+
+    // the receiving side creates and initializes the segment
+    shmem::shared_memory receiver_segment;
+    receiver_segment.create(name,
+        shmem::segment_size(num_channels, ring_size));
+    HPX_TEST(!!receiver_segment);
+
+    shmem::segment_header const* hdr =
+        static_cast<shmem::segment_header const*>(receiver_segment.data());
+    HPX_TEST(hdr->magic_ != shmem::segment_header::magic);
+
+    shmem::init_segment(receiver_segment.data(), num_channels, ring_size);
+
+    // the sending side maps the same segment and sees it initialized
+    shmem::shared_memory sender_segment;
+    sender_segment.open(name);
+    HPX_TEST(!!sender_segment);
+    HPX_TEST_EQ(sender_segment.size(), receiver_segment.size());
+
+    hdr = static_cast<shmem::segment_header const*>(sender_segment.data());
+    HPX_TEST(hdr->magic_ == shmem::segment_header::magic);
+    HPX_TEST_EQ(hdr->num_channels_, std::uint64_t(num_channels));
+    HPX_TEST_EQ(hdr->ring_size_, std::uint64_t(ring_size));
+
+    // every channel can be claimed exactly once
+    std::vector<std::size_t> channels;
+    for (std::size_t i = 0; i != num_channels; ++i)
+        channels.push_back(shmem::claim_channel(sender_segment.data()));
+    for (std::size_t i = 0; i != num_channels; ++i)
+        HPX_TEST_EQ(channels[i], i);
+
+    HPX_TEST_EQ(shmem::claim_channel(sender_segment.data()), std::size_t(-1));
+
+    // a released channel can be claimed again
+    shmem::release_channel(
+        shmem::get_channel(sender_segment.data(), ring_size, 2));
+    HPX_TEST_EQ(shmem::claim_channel(sender_segment.data()), std::size_t(2));
+    HPX_TEST_EQ(shmem::claim_channel(sender_segment.data()), std::size_t(-1));
+
+    // data written through one mapping is seen through the other, the
+    // receiver is told about the channels with new data only
+    HPX_TEST_EQ(shmem::take_ready_channels(receiver_segment.data()),
+        std::uint64_t(0));
+
+    shmem::ring_buffer out(
+        shmem::get_channel(sender_segment.data(), ring_size, 1), ring_size);
+    char const msg[] = "hello";
+    HPX_TEST_EQ(out.write_some(msg, sizeof(msg)), sizeof(msg));
+    shmem::notify_channel(sender_segment.data(), 1);
+    shmem::notify_channel(sender_segment.data(), 3);
+
+    HPX_TEST_EQ(shmem::take_ready_channels(receiver_segment.data()),
+        std::uint64_t((1 << 1) | (1 << 3)));
+    HPX_TEST_EQ(shmem::take_ready_channels(receiver_segment.data()),
+        std::uint64_t(0));
+
+    shmem::ring_buffer in(
+        shmem::get_channel(receiver_segment.data(), ring_size, 1), ring_size);
+    char result[sizeof(msg)] = { 0 };
+    HPX_TEST_EQ(in.read_some(result, sizeof(result)), sizeof(msg));
+    HPX_TEST_EQ(std::string(result), std::string(msg));
+    HPX_TEST(in.empty());
+
+    // the name is gone once the receiver has closed the segment, the
+    // existing mapping stays valid
+    receiver_segment.close();
+
+    hpx::error_code ec(hpx::lightweight);
+    shmem::shared_memory late_segment;
+    late_segment.open(name, ec);
+    HPX_TEST(ec);
+    HPX_TEST(!late_segment);
+
+    HPX_TEST(hdr->magic_ == shmem::segment_header::magic);
+}
+
+int main()
+{
+    test_handshake();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,153 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that the ring buffers of the shared memory parcelport
+// keep the data in order if it wraps around the end of the ring and if it is
+// written and read in pieces of arbitrary size.
+
+#include <hpx/config.hpp>
+#include <hpx/plugins/parcelport/shmem/ring_buffer.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+using hpx::parcelset::policies::shmem::channel_header;
+using hpx::parcelset::policies::shmem::ring_buffer;
+
+std::size_t const ring_size = 4096;
+
+///////////////////////////////////////////////////////////////////////////////
+struct channel
+{
+    channel()
+      : data_(sizeof(channel_header) + ring_size)
+      , ring_(new (data_.data()) channel_header(), ring_size)
+    {}
+
+    std::vector<char> data_;
+    ring_buffer ring_;
+};
+
+char pattern(std::size_t i)
+{
+    return static_cast<char>((i * 7) % 251);
+}
+
+std::vector<char> make_data(std::size_t offset, std::size_t size)
+{
+    std::vector<char> data(size);
+    for (std::size_t i = 0; i != size; ++i)
+        data[i] = pattern(offset + i);
+    return data;
+}
+
+bool check_data(std::vector<char> const& data, std::size_t offset,
+    std::size_t size)
+{
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        if (data[i] != pattern(offset + i))
+            return false;
+    }
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_wraparound()
+{
+    channel c;
+    HPX_TEST(c.ring_.empty());
+
+    // move the head and tail close to the end of the ring
+    std::vector<char> data = make_data(0, 3000);
+    HPX_TEST_EQ(c.ring_.write_some(data.data(), data.size()), std::size_t(3000));
+    HPX_TEST(!c.ring_.empty());
+
+    std::vector<char> result(3000);
+    HPX_TEST_EQ(c.ring_.read_some(result.data(), result.size()),
+        std::size_t(3000));
+    HPX_TEST(check_data(result, 0, 3000));
+    HPX_TEST(c.ring_.empty());
+    HPX_TEST_EQ(c.ring_.consumed(), std::uint64_t(3000));
+
+    // this write wraps around the end of the ring
+    data = make_data(3000, 2000);
+    HPX_TEST_EQ(c.ring_.write_some(data.data(), data.size()), std::size_t(2000));
+
+    result.assign(2000, 0);
+    HPX_TEST_EQ(c.ring_.read_some(result.data(), result.size()),
+        std::size_t(2000));
+    HPX_TEST(check_data(result, 3000, 2000));
+    HPX_TEST(c.ring_.empty());
+}
+
+void test_full_ring()
+{
+    channel c;
+
+    // only as much as fits into the ring is written
+    std::vector<char> data = make_data(0, 2 * ring_size);
+    HPX_TEST_EQ(c.ring_.write_some(data.data(), data.size()), ring_size);
+    HPX_TEST_EQ(c.ring_.write_some(data.data() + ring_size, ring_size),
+        std::size_t(0));
+
+    // reading makes room for exactly as many bytes
+    std::vector<char> result(ring_size);
+    HPX_TEST_EQ(c.ring_.read_some(result.data(), 100), std::size_t(100));
+    HPX_TEST_EQ(c.ring_.write_some(data.data() + ring_size, ring_size),
+        std::size_t(100));
+
+    HPX_TEST_EQ(c.ring_.read_some(result.data() + 100, ring_size - 100),
+        ring_size - 100);
+    HPX_TEST(check_data(result, 0, ring_size));
+
+    result.assign(ring_size, 0);
+    HPX_TEST_EQ(c.ring_.read_some(result.data(), ring_size), std::size_t(100));
+    HPX_TEST(check_data(result, ring_size, 100));
+    HPX_TEST(c.ring_.empty());
+
+    // nothing is read from an empty ring
+    HPX_TEST_EQ(c.ring_.read_some(result.data(), ring_size), std::size_t(0));
+}
+
+// write and read in pieces of varying size which don't match each other,
+// leaving the ring partially filled most of the time
+void test_partial_reads()
+{
+    channel c;
+
+    std::size_t const total = 64 * ring_size + 17;
+    std::vector<char> data = make_data(0, total);
+    std::vector<char> result(total);
+
+    std::size_t written = 0, read = 0;
+    for (std::size_t i = 0; read != total; ++i)
+    {
+        std::size_t write_size = (std::min)((i * 37) % 1500 + 1, total - written);
+        written += c.ring_.write_some(data.data() + written, write_size);
+
+        std::size_t read_size = (std::min)((i * 53) % 1100 + 1, total - read);
+        std::size_t n = c.ring_.read_some(result.data() + read, read_size);
+        HPX_TEST(n <= read_size);
+        HPX_TEST(read + n <= written);
+        read += n;
+
+        HPX_TEST_EQ(c.ring_.consumed(), std::uint64_t(read));
+        HPX_TEST_EQ(c.ring_.empty(), read == written);
+    }
+
+    HPX_TEST(check_data(result, 0, total));
+}
+
+int main()
+{
+    test_wraparound();
+    test_full_ring();
+    test_partial_reads();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,88 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test sends zero-copy chunks which are larger than the ring buffers of
+// the shared memory parcelport through it. The chunks are split across many
+// reads and wrap around the end of the ring, they have to arrive intact.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/runtime/serialization/serialize_buffer.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+typedef hpx::serialization::serialize_buffer<char> buffer_type;
+
+buffer_type bounce(buffer_type const& receive_buffer)
+{
+    return receive_buffer;
+}
+HPX_PLAIN_ACTION(bounce);
+
+HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(
+    buffer_type, serialization_buffer_char);
+HPX_REGISTER_BASE_LCO_WITH_VALUE(
+    buffer_type, serialization_buffer_char);
+
+///////////////////////////////////////////////////////////////////////////////
+void test_streamed_chunks(hpx::id_type const& dest, std::size_t size)
+{
+    std::vector<char> send_buffer(size);
+    for (std::size_t i = 0; i != size; ++i)
+        send_buffer[i] = static_cast<char>((i * 7) % 251);
+
+    // have several messages in flight to shift the chunk boundaries across
+    // the end of the ring
+    std::vector<hpx::future<buffer_type> > recv_buffers;
+    recv_buffers.reserve(10);
+
+    bounce_action act;
+    for (std::size_t j = 0; j != 10; ++j)
+    {
+        recv_buffers.push_back(hpx::async(act, dest,
+            buffer_type(send_buffer.data(), size - j, buffer_type::reference)));
+    }
+    hpx::wait_all(recv_buffers);
+
+    for (std::size_t j = 0; j != 10; ++j)
+    {
+        buffer_type b = recv_buffers[j].get();
+        HPX_TEST_EQ(b.size(), size - j);
+        HPX_TEST(0 == std::memcmp(b.data(), send_buffer.data(), size - j));
+    }
+}
+
+int hpx_main()
+{
+    for (hpx::id_type const& dest : hpx::find_remote_localities())
+    {
+        test_streamed_chunks(dest, 300);
+        test_streamed_chunks(dest, 4000);
+        test_streamed_chunks(dest, 4107);
+        test_streamed_chunks(dest, 9000);
+        test_streamed_chunks(dest, 100000);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // use the smallest ring and stream all chunks through it
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.shmem.ring_size=4096",
+        "hpx.parcel.shmem.bulk_threshold=0"
+    };
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
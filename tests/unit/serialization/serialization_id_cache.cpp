@@ -0,0 +1,136 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that the serialization id of an action type is looked
+// up only once, that all localities agree on it, and that actions sent using
+// the cached ids still arrive intact.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/runtime/actions/transfer_action.hpp>
+#include <hpx/runtime/serialization/detail/polymorphic_id_factory.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using hpx::serialization::detail::id_registry;
+using hpx::serialization::detail::polymorphic_id_factory;
+
+///////////////////////////////////////////////////////////////////////////////
+std::string echo(std::string const& s)
+{
+    return s;
+}
+HPX_PLAIN_ACTION(echo);
+
+std::vector<std::uint32_t> get_ids();
+HPX_PLAIN_ACTION(get_ids);
+
+std::string bounce(hpx::id_type const& dest, std::string const& s)
+{
+    return hpx::async<echo_action>(dest, s).get();
+}
+HPX_PLAIN_ACTION(bounce);
+
+// the ids this locality serializes the test actions with
+std::vector<std::uint32_t> get_ids()
+{
+    hpx::actions::transfer_action<echo_action> echo_act;
+    hpx::actions::transfer_action<get_ids_action> get_ids_act;
+    hpx::actions::transfer_action<bounce_action> bounce_act;
+
+    std::vector<std::uint32_t> result = {
+        echo_act.hpx_serialization_get_id(),
+        get_ids_act.hpx_serialization_get_id(),
+        bounce_act.hpx_serialization_get_id()
+    };
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the cached id is the one registered for the name of the action type
+void test_registered_id()
+{
+    hpx::actions::transfer_action<echo_action> echo_act;
+    hpx::actions::base_action& action = echo_act;
+
+    std::uint32_t id = action.hpx_serialization_get_id();
+    HPX_TEST(id != id_registry::invalid_id);
+    HPX_TEST_EQ(id,
+        polymorphic_id_factory::get_id(action.hpx_serialization_get_name()));
+    HPX_TEST_EQ(action.hpx_serialization_get_id(), id);
+
+    // different types are serialized with different ids
+    std::vector<std::uint32_t> ids = get_ids();
+    HPX_TEST_NEQ(ids[0], ids[1]);
+    HPX_TEST_NEQ(ids[0], ids[2]);
+    HPX_TEST_NEQ(ids[1], ids[2]);
+}
+
+// the name of a type is looked up only once
+struct cache_tag {};
+
+std::string echo_name;
+std::size_t get_name_called = 0;
+
+std::string get_echo_name()
+{
+    ++get_name_called;
+    return echo_name;
+}
+
+void test_lookup_once()
+{
+    hpx::actions::transfer_action<echo_action> echo_act;
+    echo_name = echo_act.hpx_serialization_get_name();
+
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        HPX_TEST_EQ(
+            polymorphic_id_factory::get_cached_id<cache_tag>(&get_echo_name),
+            echo_act.hpx_serialization_get_id());
+    }
+    HPX_TEST_EQ(get_name_called, std::size_t(1));
+}
+
+// all localities serialize the actions with the same ids, and the actions
+// round-trip between them
+void test_remote(hpx::id_type const& dest)
+{
+    HPX_TEST(hpx::async<get_ids_action>(dest).get() == get_ids());
+
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        std::string const s = "parcel #" + std::to_string(i);
+        HPX_TEST_EQ(hpx::async<echo_action>(dest, s).get(), s);
+        HPX_TEST_EQ(
+            hpx::async<bounce_action>(dest, hpx::find_here(), s).get(), s);
+    }
+}
+
+int hpx_main()
+{
+    test_registered_id();
+    test_lookup_once();
+
+    for (hpx::id_type const& dest : hpx::find_remote_localities())
+    {
+        test_remote(dest);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -11,8 +11,10 @@
 #include <hpx/util/lightweight_test.hpp>
 #include <hpx/runtime/serialization/serialize_buffer.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
+#include <utility>
 #include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -128,6 +130,90 @@ void test_initialization_from_vector(std::size_t max_size)
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Hands the received zero-copy chunks over to the deserialized objects, just
+// like the parcelports do
+struct received_chunks_owner : hpx::serialization::chunk_owner
+{
+    std::shared_ptr<char> adopt(void const* data, std::size_t size)
+    {
+        for (std::vector<char>& c : chunks_)
+        {
+            if (c.data() == data && c.size() == size)
+            {
+                std::shared_ptr<std::vector<char> > holder =
+                    std::make_shared<std::vector<char> >(std::move(c));
+                return std::shared_ptr<char>(holder, holder->data());
+            }
+        }
+        return std::shared_ptr<char>();
+    }
+
+    std::vector<std::vector<char> > chunks_;
+};
+
+template <typename T>
+void test_adopt_received_chunk(std::size_t size)
+{
+    typedef hpx::serialization::serialize_buffer<T> buffer_type;
+
+    std::vector<T> send_vec(size);
+    for (std::size_t i = 0; i != size; ++i)
+        send_vec[i] = T(i);
+
+    buffer_type send_buffer(send_vec.data(), size, buffer_type::reference);
+
+    std::vector<char> out_buffer;
+    std::vector<hpx::serialization::serialization_chunk> out_chunks;
+    std::size_t arg_size = 0;
+    {
+        hpx::serialization::output_archive archive(out_buffer, 0, &out_chunks);
+        archive << send_buffer;
+        arg_size = archive.bytes_written();
+    }
+
+    // 'receive' the zero-copy chunks into separate buffers
+    received_chunks_owner owner;
+    owner.chunks_.reserve(out_chunks.size());
+
+    std::vector<hpx::serialization::serialization_chunk> in_chunks;
+    for (hpx::serialization::serialization_chunk const& c : out_chunks)
+    {
+        if (c.type_ == hpx::serialization::chunk_type_pointer)
+        {
+            char const* data = static_cast<char const*>(c.data_.cpos_);
+            owner.chunks_.push_back(std::vector<char>(data, data + c.size_));
+            in_chunks.push_back(hpx::serialization::create_pointer_chunk(
+                owner.chunks_.back().data(), c.size_));
+        }
+        else
+        {
+            in_chunks.push_back(c);
+        }
+    }
+
+    void const* received =
+        owner.chunks_.empty() ? nullptr : owner.chunks_.front().data();
+
+    buffer_type recv_buffer;
+    {
+        hpx::serialization::input_archive archive(
+            out_buffer, arg_size, &in_chunks, &owner);
+        archive >> recv_buffer;
+    }
+
+    HPX_TEST_EQ(recv_buffer.size(), size);
+    HPX_TEST(std::equal(send_vec.begin(), send_vec.end(), recv_buffer.data()));
+
+    // large buffers refer to the received data without copying it
+    if (size * sizeof(T) >= HPX_ZERO_COPY_SERIALIZATION_THRESHOLD)
+    {
+        HPX_TEST_EQ(owner.chunks_.size(), std::size_t(1));
+        HPX_TEST(static_cast<void const*>(recv_buffer.data()) == received);
+        HPX_TEST(owner.chunks_.front().empty());
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(int argc, char* argv[])
 {
@@ -153,6 +239,13 @@ int hpx_main(int argc, char* argv[])
         test_fixed_size_initialization_for_persistent_buffers<double>(size);
     }
 
+    for (std::size_t size = 1; size <= max_size; size *= 2)
+    {
+        test_adopt_received_chunk<char>(size);
+        test_adopt_received_chunk<int>(size);
+        test_adopt_received_chunk<double>(size);
+    }
+
     return hpx::finalize();
 }
 
@@ -0,0 +1,163 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/threadmanager.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/runtime/threads/policies/local_priority_queue_scheduler.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#define NUM_THREADS 1000
+
+///////////////////////////////////////////////////////////////////////////////
+// expose the victim selection of the priority scheduler
+struct test_scheduler
+  : hpx::threads::policies::fifo_priority_queue_scheduler
+{
+    typedef hpx::threads::policies::fifo_priority_queue_scheduler base_type;
+
+    test_scheduler(std::size_t num_queues, std::size_t max_steal_attempts)
+      : base_type(init_parameter_type(num_queues, num_queues,
+            max_thread_count, 0, "test_scheduler", true, max_steal_attempts),
+            false)
+    {
+        this->init(hpx::threads::policies::init_affinity_data(),
+            this->topology_);
+        for (std::size_t i = 0; i != num_queues; ++i)
+            this->init_victims(i);
+    }
+
+    // return the victims in the order they are visited, stop after the
+    // victim with the index 'stop_at'
+    std::vector<std::size_t> victims(std::size_t num_thread,
+        std::size_t stop_at = std::size_t(-1))
+    {
+        std::vector<std::size_t> result;
+        this->for_each_victim(num_thread,
+            [&](std::size_t idx) -> bool
+            {
+                result.push_back(idx);
+                return idx == stop_at;
+            });
+        return result;
+    }
+
+    std::size_t numa_node(std::size_t num_thread)
+    {
+        return this->topology_.get_numa_node_number(
+            this->get_pu_num(num_thread));
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// every other queue is a victim exactly once, the queues in the same NUMA
+// domain are visited first
+void test_victim_order(std::size_t num_queues)
+{
+    test_scheduler sched(num_queues, 0);
+
+    for (std::size_t i = 0; i != num_queues; ++i)
+    {
+        std::vector<std::size_t> victims = sched.victims(i);
+        HPX_TEST_EQ(victims.size(), num_queues - 1);
+
+        std::vector<std::size_t> seen(num_queues, 0);
+        bool left_numa_domain = false;
+        for (std::size_t idx : victims)
+        {
+            HPX_TEST_NEQ(idx, i);
+            HPX_TEST(idx < num_queues);
+            if (idx < num_queues)
+                ++seen[idx];
+
+            if (sched.numa_node(idx) != sched.numa_node(i))
+                left_numa_domain = true;
+            else
+                HPX_TEST(!left_numa_domain);
+        }
+
+        for (std::size_t idx = 0; idx != num_queues; ++idx)
+            HPX_TEST_EQ(seen[idx], idx == i ? 0u : 1u);
+    }
+}
+
+// no more than max_steal_attempts victims are visited per scheduling cycle,
+// and visiting stops on success
+void test_max_steal_attempts(std::size_t num_queues)
+{
+    std::size_t const max_attempts = 2;
+    test_scheduler sched(num_queues, max_attempts);
+
+    for (std::size_t i = 0; i != num_queues; ++i)
+    {
+        std::vector<std::size_t> victims = sched.victims(i);
+        HPX_TEST_EQ(victims.size(), (std::min)(max_attempts, num_queues - 1));
+
+        if (!victims.empty())
+        {
+            std::vector<std::size_t> stopped =
+                sched.victims(i, victims.front());
+            HPX_TEST_EQ(stopped.size(), 1u);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// all work is run while the workers steal hierarchically
+void test_run_work()
+{
+    boost::atomic<std::size_t> count(0);
+
+    hpx::lcos::local::latch l(NUM_THREADS + 1);
+    for (std::size_t i = 0; i != NUM_THREADS; ++i)
+    {
+        hpx::threads::register_thread_nullary(
+            [&]()
+            {
+                ++count;
+                l.count_down(1);
+            },
+            "test_run_work");
+    }
+
+    l.count_down_and_wait();
+    HPX_TEST_EQ(count.load(), std::size_t(NUM_THREADS));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    // the command line options end up in the configuration
+    HPX_TEST_EQ(hpx::get_config_entry("hpx.hierarchical_stealing", "0"),
+        std::string("1"));
+    HPX_TEST_EQ(hpx::get_config_entry("hpx.max_steal_attempts", "0"),
+        std::string("2"));
+
+    test_run_work();
+
+    std::size_t num_queues = hpx::get_os_thread_count();
+    test_victim_order(num_queues);
+    test_max_steal_attempts(num_queues);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // steal hierarchically, giving up after two failed attempts
+    std::vector<char*> args(argv, argv + argc);
+    char hierarchical_stealing[] = "--hpx:hierarchical-stealing=2";
+    args.push_back(hierarchical_stealing);
+
+    HPX_TEST_EQ_MSG(hpx::init(static_cast<int>(args.size()), args.data()), 0,
+        "HPX main exited with non-zero status");
+    return hpx::util::report_errors();
+}
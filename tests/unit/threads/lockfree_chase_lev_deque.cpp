@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/config.hpp>
+#include <hpx/util/lockfree/chase_lev_deque.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/program_options.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <boost/detail/lightweight_test.hpp>
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+typedef boost::lockfree::chase_lev_deque<std::uint64_t> deque_type;
+
+std::uint64_t threads = 4;
+std::uint64_t items = 500000;
+
+boost::atomic<std::uint64_t> popped(0);
+boost::atomic<std::uint64_t> stolen(0);
+boost::atomic<bool> done(false);
+
+std::vector<boost::atomic<std::uint64_t>*> seen;
+
+void record(std::uint64_t item)
+{
+    BOOST_TEST(item < items);
+    if (item < items)
+        ++(*seen[item]);
+}
+
+// the owner pushes all items and pops some of them again from the bottom
+void owner_thread(deque_type& d)
+{
+    for (std::uint64_t i = 0; i != items; ++i)
+    {
+        d.push_bottom(i);
+
+        if (i % 3 == 0)
+        {
+            std::uint64_t r = 0;
+            if (d.pop_bottom(r))
+            {
+                record(r);
+                ++popped;
+            }
+        }
+    }
+
+    std::uint64_t r = 0;
+    while (d.pop_bottom(r))
+    {
+        record(r);
+        ++popped;
+    }
+
+    done = true;
+}
+
+// all other threads steal from the top
+void thief_thread(deque_type& d)
+{
+    std::uint64_t r = 0;
+    while (!done.load() || !d.empty())
+    {
+        if (d.steal_top(r))
+        {
+            record(r);
+            ++stolen;
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    using boost::program_options::variables_map;
+    using boost::program_options::options_description;
+    using boost::program_options::value;
+    using boost::program_options::store;
+    using boost::program_options::command_line_parser;
+    using boost::program_options::notify;
+
+    variables_map vm;
+
+    options_description
+        desc_cmdline("Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_cmdline.add_options()
+        ("help,h", "print out program usage (this message)")
+        ("threads,t", value<std::uint64_t>(&threads)->default_value(4),
+         "the number of worker threads accessing the deque")
+        ("items,i", value<std::uint64_t>(&items)->default_value(500000),
+         "the number of items to push onto the deque")
+    ;
+
+    store(
+        command_line_parser(argc,
+            argv).options(desc_cmdline).allow_unregistered().run(), vm);
+
+    notify(vm);
+
+    // print help screen
+    if (vm.count("help"))
+    {
+        std::cout << desc_cmdline;
+        return boost::report_errors();
+    }
+
+    // single threaded: LIFO for the owner, FIFO for thieves
+    {
+        deque_type d;
+        BOOST_TEST(d.empty());
+
+        for (std::uint64_t i = 0; i != 100; ++i)
+            d.push_bottom(i);
+        BOOST_TEST(!d.empty());
+
+        std::uint64_t r = 0;
+        BOOST_TEST(d.pop_bottom(r));
+        BOOST_TEST_EQ(r, 99u);
+        BOOST_TEST(d.steal_top(r));
+        BOOST_TEST_EQ(r, 0u);
+
+        std::uint64_t count = 0;
+        while (d.pop_bottom(r))
+            ++count;
+        BOOST_TEST_EQ(count, 98u);
+        BOOST_TEST(d.empty());
+        BOOST_TEST(!d.steal_top(r));
+    }
+
+    // concurrent: every item has to be retrieved exactly once
+    {
+        seen.resize(items);
+        for (std::uint64_t i = 0; i != items; ++i)
+            seen[i] = new boost::atomic<std::uint64_t>(0);
+
+        deque_type d;
+
+        boost::thread_group tg;
+        for (std::uint64_t i = 1; i < threads; ++i)
+            tg.create_thread([&d]() { thief_thread(d); });
+        owner_thread(d);
+        tg.join_all();
+
+        BOOST_TEST_EQ(popped + stolen, items);
+        for (std::uint64_t i = 0; i != items; ++i)
+        {
+            BOOST_TEST_EQ(seen[i]->load(), 1u);
+            delete seen[i];
+        }
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,143 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/threadmanager.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/parallel_executors.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/range/irange.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#define NUM_BULK_THREADS 1000
+
+///////////////////////////////////////////////////////////////////////////////
+void test_register_thread_nullary_bulk()
+{
+    boost::atomic<std::size_t> count(0);
+
+    hpx::lcos::local::latch l(NUM_BULK_THREADS + 1);
+
+    std::vector<hpx::util::unique_function_nonser<void()> > funcs;
+    funcs.reserve(NUM_BULK_THREADS);
+    for (std::size_t i = 0; i != NUM_BULK_THREADS; ++i)
+    {
+        funcs.push_back(
+            [&count, &l]()
+            {
+                ++count;
+                l.count_down(1);
+            });
+    }
+
+    hpx::threads::register_thread_nullary_bulk(std::move(funcs),
+        "test_register_thread_nullary_bulk");
+
+    l.count_down_and_wait();
+    HPX_TEST_EQ(count.load(), std::size_t(NUM_BULK_THREADS));
+}
+
+// Launch more threads than the thread queues are allowed to hold at any time
+// (by default 1000 each). All of them have to be alive at the same time, which
+// requires the threads which were staged by the bulk launch to be created
+// later.
+void test_register_thread_nullary_bulk_staged()
+{
+    std::size_t const num_threads =
+        5 * NUM_BULK_THREADS * hpx::get_os_thread_count();
+
+    boost::atomic<std::size_t> count(0);
+
+    hpx::lcos::local::latch l(num_threads + 1);
+
+    std::vector<hpx::util::unique_function_nonser<void()> > funcs;
+    funcs.reserve(num_threads);
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        funcs.push_back(
+            [&count, &l]()
+            {
+                ++count;
+                l.count_down_and_wait();
+            });
+    }
+
+    hpx::threads::register_thread_nullary_bulk(std::move(funcs),
+        "test_register_thread_nullary_bulk_staged");
+
+    l.count_down_and_wait();
+    HPX_TEST_EQ(count.load(), num_threads);
+}
+
+// Launch all threads with an explicit placement on the last OS thread
+void test_register_thread_nullary_bulk_placed()
+{
+    std::size_t const os_thread = hpx::get_os_thread_count() - 1;
+
+    boost::atomic<std::size_t> count(0);
+
+    hpx::lcos::local::latch l(NUM_BULK_THREADS + 1);
+
+    std::vector<hpx::util::unique_function_nonser<void()> > funcs;
+    funcs.reserve(NUM_BULK_THREADS);
+    for (std::size_t i = 0; i != NUM_BULK_THREADS; ++i)
+    {
+        funcs.push_back(
+            [&count, &l]()
+            {
+                ++count;
+                l.count_down(1);
+            });
+    }
+
+    hpx::threads::register_thread_nullary_bulk(std::move(funcs),
+        "test_register_thread_nullary_bulk_placed", hpx::threads::pending,
+        hpx::threads::thread_priority_normal, os_thread);
+
+    l.count_down_and_wait();
+    HPX_TEST_EQ(count.load(), std::size_t(NUM_BULK_THREADS));
+}
+
+std::size_t square(std::size_t i)
+{
+    return i * i;
+}
+
+void test_bulk_async_execute()
+{
+    hpx::parallel::parallel_executor exec;
+
+    std::vector<hpx::future<std::size_t> > results =
+        exec.bulk_async_execute(&square, boost::irange(0, NUM_BULK_THREADS));
+
+    HPX_TEST_EQ(results.size(), std::size_t(NUM_BULK_THREADS));
+    for (std::size_t i = 0; i != results.size(); ++i)
+        HPX_TEST_EQ(results[i].get(), i * i);
+}
+
+int hpx_main()
+{
+    test_register_thread_nullary_bulk();
+    test_register_thread_nullary_bulk_staged();
+    test_register_thread_nullary_bulk_placed();
+    test_bulk_async_execute();
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
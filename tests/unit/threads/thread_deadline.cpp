@@ -0,0 +1,129 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that the deadline scheduler executes threads in the
+// order of their deadlines and that it reports missed deadlines.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/thread_executors.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/bind.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#define NUM_THREADS 100
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::lcos::local::spinlock mtx;
+std::vector<std::size_t> order;
+
+hpx::threads::thread_result_type record(std::size_t i,
+    hpx::lcos::local::latch& l)
+{
+    {
+        std::lock_guard<hpx::lcos::local::spinlock> lk(mtx);
+        order.push_back(i);
+    }
+    l.count_down(1);
+    return hpx::threads::thread_result_type(hpx::threads::terminated, nullptr);
+}
+
+void test_deadline_order()
+{
+    order.clear();
+    hpx::lcos::local::latch l(NUM_THREADS + 2);
+
+    // none of the threads can run before this thread suspends as there is
+    // just one worker thread
+    std::uint64_t base = hpx::util::high_resolution_clock::now() +
+        std::uint64_t(1000000000);
+
+    // a thread without a deadline runs after all threads with a deadline
+    {
+        hpx::threads::thread_init_data data(
+            hpx::util::bind(&record, std::size_t(-1), std::ref(l)),
+            "test_deadline_order");
+        hpx::threads::register_thread_plain(data);
+    }
+
+    // create threads with decreasing deadlines
+    for (std::size_t i = 0; i != NUM_THREADS; ++i)
+    {
+        hpx::threads::thread_init_data data(
+            hpx::util::bind(&record, i, std::ref(l)),
+            "test_deadline_order");
+        data.deadline = base + (NUM_THREADS - i) * 1000;
+        hpx::threads::register_thread_plain(data);
+    }
+
+    l.count_down_and_wait();
+
+    HPX_TEST_EQ(order.size(), std::size_t(NUM_THREADS + 1));
+    for (std::size_t i = 0; i != NUM_THREADS; ++i)
+        HPX_TEST_EQ(order[i], NUM_THREADS - i - 1);
+    HPX_TEST_EQ(order.back(), std::size_t(-1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_deadline_misses()
+{
+    using hpx::performance_counters::performance_counter;
+
+    performance_counter misses(
+        "/threads{locality#0/total}/count/deadline-misses");
+    std::int64_t before = misses.get_value<std::int64_t>(hpx::launch::sync);
+
+    // a deadline of 1ms can't be met by a thread sleeping for 10ms
+    hpx::threads::executors::default_executor exec(
+        std::chrono::milliseconds(1));
+    hpx::async(exec,
+        []()
+        {
+            hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }).get();
+
+    // threads without a deadline never miss it
+    hpx::async(
+        []()
+        {
+            hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }).get();
+
+    // the counter is updated after the thread has terminated
+    std::int64_t after = before;
+    for (int i = 0; i != 100 && after == before; ++i)
+    {
+        hpx::this_thread::yield();
+        after = misses.get_value<std::int64_t>(hpx::launch::sync);
+    }
+    HPX_TEST_EQ(after - before, std::int64_t(1));
+}
+
+int hpx_main()
+{
+    test_deadline_order();
+    test_deadline_misses();
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.scheduler=deadline",
+        "hpx.os_threads=1"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
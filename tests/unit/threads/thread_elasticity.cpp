@@ -0,0 +1,225 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/threadmanager.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#define NUM_THREADS 1000
+
+///////////////////////////////////////////////////////////////////////////////
+// work which is not explicitly placed is never run by retired workers
+void test_unplaced_work(std::size_t num_active)
+{
+    boost::atomic<std::size_t> count(0);
+    boost::atomic<std::size_t> misplaced(0);
+
+    hpx::lcos::local::latch l(NUM_THREADS + 1);
+    for (std::size_t i = 0; i != NUM_THREADS; ++i)
+    {
+        hpx::threads::register_thread_nullary(
+            [&]()
+            {
+                if (hpx::get_worker_thread_num() >= num_active)
+                    ++misplaced;
+                ++count;
+                l.count_down(1);
+            },
+            "test_unplaced_work");
+    }
+
+    l.count_down_and_wait();
+
+    HPX_TEST_EQ(count.load(), std::size_t(NUM_THREADS));
+    HPX_TEST_EQ(misplaced.load(), std::size_t(0));
+}
+
+// work explicitly placed on retired workers is run by the active ones
+void test_explicit_placement(std::size_t num_active)
+{
+    std::size_t const num_os_threads = hpx::get_os_thread_count();
+
+    boost::atomic<std::size_t> count(0);
+    boost::atomic<std::size_t> misplaced(0);
+
+    hpx::lcos::local::latch l(NUM_THREADS + 1);
+    for (std::size_t i = 0; i != NUM_THREADS; ++i)
+    {
+        hpx::threads::register_thread_nullary(
+            [&]()
+            {
+                if (hpx::get_worker_thread_num() >= num_active)
+                    ++misplaced;
+                ++count;
+                l.count_down(1);
+            },
+            "test_explicit_placement", hpx::threads::pending, true,
+            hpx::threads::thread_priority_normal, i % num_os_threads);
+    }
+
+    l.count_down_and_wait();
+
+    HPX_TEST_EQ(count.load(), std::size_t(NUM_THREADS));
+    HPX_TEST_EQ(misplaced.load(), std::size_t(0));
+}
+
+// threads resumed after some of the workers were retired are run by the
+// active workers
+void test_resumed_threads(std::size_t num_active)
+{
+    boost::atomic<std::size_t> misplaced(0);
+
+    hpx::lcos::local::latch l(NUM_THREADS + 1);
+    std::vector<hpx::threads::thread_id_type> ids;
+    ids.reserve(NUM_THREADS);
+    for (std::size_t i = 0; i != NUM_THREADS; ++i)
+    {
+        ids.push_back(hpx::threads::register_thread_nullary(
+            [&]()
+            {
+                if (hpx::get_worker_thread_num() >= num_active)
+                    ++misplaced;
+                l.count_down(1);
+            },
+            "test_resumed_threads", hpx::threads::suspended));
+    }
+
+    for (hpx::threads::thread_id_type const& id : ids)
+        hpx::threads::set_thread_state(id, hpx::threads::pending);
+
+    l.count_down_and_wait();
+
+    HPX_TEST_EQ(misplaced.load(), std::size_t(0));
+}
+
+// the work queued on a worker at the time it is retired is run by the active
+// workers
+void test_queued_work()
+{
+    hpx::threads::threadmanager_base& tm = hpx::get_runtime().get_thread_manager();
+    std::size_t const num_os_threads = hpx::get_os_thread_count();
+    if (num_os_threads < 2)
+        return;
+
+    std::size_t const last = num_os_threads - 1;
+
+    // keep the last worker busy while work is queued on it
+    boost::atomic<bool> started(false);
+    boost::atomic<bool> release(false);
+    boost::atomic<std::size_t> blocked_worker(std::size_t(-1));
+
+    hpx::lcos::local::latch l(NUM_THREADS + 2);
+    hpx::threads::register_thread_nullary(
+        [&]()
+        {
+            blocked_worker = hpx::get_worker_thread_num();
+            started = true;
+            while (!release.load())
+                ;
+            l.count_down(1);
+        },
+        "test_queued_work", hpx::threads::pending, true,
+        hpx::threads::thread_priority_normal, last);
+
+    while (!started.load())
+        hpx::this_thread::yield();
+
+    boost::atomic<bool> retired(false);
+    boost::atomic<std::size_t> misplaced(0);
+    boost::atomic<std::size_t> count(0);
+
+    for (std::size_t i = 0; i != NUM_THREADS; ++i)
+    {
+        hpx::threads::register_thread_nullary(
+            [&]()
+            {
+                if (retired.load() && hpx::get_worker_thread_num() == last)
+                    ++misplaced;
+                ++count;
+                l.count_down(1);
+            },
+            "test_queued_work", hpx::threads::pending, true,
+            hpx::threads::thread_priority_normal, last);
+    }
+
+    tm.set_active_os_thread_count(last);
+    retired = true;
+    release = true;
+
+    l.count_down_and_wait();
+
+    HPX_TEST_EQ(count.load(), std::size_t(NUM_THREADS));
+    if (blocked_worker.load() == last)
+        HPX_TEST_EQ(misplaced.load(), std::size_t(0));
+
+    tm.set_active_os_thread_count(num_os_threads);
+    HPX_TEST_EQ(tm.get_active_os_thread_count(), num_os_threads);
+}
+
+void test_retired_workers(std::size_t num_active)
+{
+    hpx::threads::threadmanager_base& tm = hpx::get_runtime().get_thread_manager();
+    std::size_t const num_os_threads = hpx::get_os_thread_count();
+
+    tm.set_active_os_thread_count(num_active);
+    HPX_TEST_EQ(tm.get_active_os_thread_count(), num_active);
+
+    test_unplaced_work(num_active);
+    test_explicit_placement(num_active);
+    test_resumed_threads(num_active);
+
+    tm.set_active_os_thread_count(num_os_threads);
+    HPX_TEST_EQ(tm.get_active_os_thread_count(), num_os_threads);
+}
+
+void test_invalid_count()
+{
+    hpx::threads::threadmanager_base& tm = hpx::get_runtime().get_thread_manager();
+    std::size_t const num_os_threads = hpx::get_os_thread_count();
+
+    {
+        hpx::error_code ec(hpx::lightweight);
+        tm.set_active_os_thread_count(0, ec);
+        HPX_TEST(ec);
+    }
+
+    {
+        hpx::error_code ec(hpx::lightweight);
+        tm.set_active_os_thread_count(num_os_threads + 1, ec);
+        HPX_TEST(ec);
+    }
+
+    HPX_TEST_EQ(tm.get_active_os_thread_count(), num_os_threads);
+}
+
+int hpx_main()
+{
+    std::size_t const num_os_threads = hpx::get_os_thread_count();
+    for (std::size_t i = num_os_threads; i != 0; --i)
+        test_retired_workers(i);
+
+    test_queued_work();
+    test_invalid_count();
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,127 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that idle worker threads back off (and get parked), that
+// they are woken up by new work, and that the idle counters can be queried
+// while the worker threads are going to sleep and waking up.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using hpx::performance_counters::performance_counter;
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t query_counter(char const* name, bool reset = false)
+{
+    performance_counter c(
+        std::string("/threads{locality#0/total}/") + name);
+    return c.get_value<std::int64_t>(hpx::launch::sync, reset);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_idle_backoff()
+{
+    query_counter("count/idle-backoffs", true);
+    query_counter("count/idle-parks", true);
+
+    // let all worker threads run out of work for much longer than the
+    // maximum backoff period
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    HPX_TEST(query_counter("count/idle-backoffs") != 0);
+    HPX_TEST(query_counter("count/idle-parks") != 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_idle_wakeup()
+{
+    std::size_t const num_threads = 100 * hpx::get_os_thread_count();
+
+    for (int i = 0; i != 10; ++i)
+    {
+        // give the worker threads time to park
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+        boost::atomic<std::size_t> count(0);
+
+        std::vector<hpx::future<void> > futures;
+        futures.reserve(num_threads);
+        for (std::size_t j = 0; j != num_threads; ++j)
+        {
+            futures.push_back(hpx::async([&count]() { ++count; }));
+        }
+        hpx::wait_all(futures);
+
+        HPX_TEST_EQ(count.load(), num_threads);
+    }
+
+    HPX_TEST(query_counter("time/idle-wakeup-latency") >= 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// read (and reset) the idle counters while worker threads go to sleep and wake
+// up concurrently
+void test_concurrent_counters()
+{
+    boost::atomic<bool> done(false);
+
+    hpx::future<void> reader = hpx::async(
+        [&done]()
+        {
+            while (!done.load())
+            {
+                HPX_TEST(query_counter("count/idle-backoffs", true) >= 0);
+                HPX_TEST(query_counter("count/idle-parks", true) >= 0);
+                HPX_TEST(query_counter("time/idle-backoff") >= 0);
+                hpx::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+        });
+
+    for (int i = 0; i != 100; ++i)
+    {
+        hpx::this_thread::sleep_for(std::chrono::microseconds(500));
+
+        std::vector<hpx::future<void> > futures;
+        for (std::size_t j = 0; j != hpx::get_os_thread_count(); ++j)
+            futures.push_back(hpx::async([]() {}));
+        hpx::wait_all(futures);
+    }
+
+    done = true;
+    reader.get();
+}
+
+int hpx_main()
+{
+    test_idle_backoff();
+    test_idle_wakeup();
+    test_concurrent_counters();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all",
+        "hpx.idle_backoff.enabled=1",
+        "hpx.idle_backoff.min_time=10",
+        "hpx.idle_backoff.max_time=1000"
+    };
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,150 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that threads can be created, recycled and destroyed
+// concurrently while other threads query and enumerate the threads known to
+// the thread queues.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/threadmanager.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#define NUM_SPAWNED_THREADS 10000
+#define NUM_SUSPENDED_THREADS 100
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_spawn_and_query()
+{
+    std::size_t const num_spawners = hpx::get_os_thread_count();
+
+    boost::atomic<std::size_t> count(0);
+    boost::atomic<bool> done(false);
+
+    // keep querying the thread queues while threads come and go
+    hpx::future<void> query = hpx::async(
+        [&done]()
+        {
+            while (!done.load())
+            {
+                HPX_TEST(hpx::threads::get_thread_count() >= 0);
+                HPX_TEST(hpx::threads::get_thread_count(
+                    hpx::threads::suspended) >= 0);
+
+                std::size_t active = 0;
+                hpx::threads::enumerate_threads(
+                    [&active](hpx::threads::thread_id_type const& id) -> bool
+                    {
+                        HPX_TEST(id);
+                        ++active;
+                        return true;
+                    },
+                    hpx::threads::active);
+                HPX_TEST(active != 0);      // this thread is active
+
+                hpx::this_thread::yield();
+            }
+        });
+
+    std::vector<hpx::future<void> > spawners;
+    spawners.reserve(num_spawners);
+    for (std::size_t i = 0; i != num_spawners; ++i)
+    {
+        spawners.push_back(hpx::async(
+            [&count]()
+            {
+                std::vector<hpx::future<void> > futures;
+                futures.reserve(NUM_SPAWNED_THREADS);
+                for (std::size_t j = 0; j != NUM_SPAWNED_THREADS; ++j)
+                {
+                    futures.push_back(hpx::async([&count]() { ++count; }));
+                }
+                hpx::wait_all(futures);
+            }));
+    }
+
+    hpx::wait_all(spawners);
+
+    done = true;
+    query.get();
+
+    HPX_TEST_EQ(count.load(), num_spawners * NUM_SPAWNED_THREADS);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_enumerate_suspended()
+{
+    hpx::lcos::local::promise<void> p;
+    hpx::shared_future<void> f = p.get_future().share();
+
+    boost::atomic<std::size_t> started(0);
+
+    std::vector<hpx::future<void> > waiting;
+    waiting.reserve(NUM_SUSPENDED_THREADS);
+    for (std::size_t i = 0; i != NUM_SUSPENDED_THREADS; ++i)
+    {
+        waiting.push_back(hpx::async(
+            [f, &started]()
+            {
+                ++started;
+                f.get();
+            }));
+    }
+
+    while (started.load() != NUM_SUSPENDED_THREADS)
+        hpx::this_thread::yield();
+
+    // all of the threads above eventually suspend on the shared future
+    std::int64_t suspended = 0;
+    do {
+        hpx::this_thread::yield();
+        suspended = 0;
+        hpx::threads::enumerate_threads(
+            [&suspended](hpx::threads::thread_id_type const&) -> bool
+            {
+                ++suspended;
+                return true;
+            },
+            hpx::threads::suspended);
+    } while (suspended < NUM_SUSPENDED_THREADS);
+
+    HPX_TEST(hpx::threads::get_thread_count(hpx::threads::suspended) >=
+        NUM_SUSPENDED_THREADS);
+
+    // stopping the enumeration early is honored
+    std::size_t visited = 0;
+    HPX_TEST(!hpx::threads::enumerate_threads(
+        [&visited](hpx::threads::thread_id_type const&) -> bool
+        {
+            return ++visited != 10;
+        },
+        hpx::threads::suspended));
+    HPX_TEST_EQ(visited, std::size_t(10));
+
+    p.set_value();
+    hpx::wait_all(waiting);
+}
+
+int hpx_main()
+{
+    test_concurrent_spawn_and_query();
+    test_enumerate_suspended();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
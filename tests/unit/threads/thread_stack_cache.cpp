@@ -0,0 +1,119 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that the stacks carved from the cached stack slabs are
+// usable, and that stacks can be recycled, handed over between worker threads,
+// and returned to the system while many threads of different stack sizes come
+// and go.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/threadmanager.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/runtime/threads/thread_data.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#define NUM_THREADS 2000
+
+///////////////////////////////////////////////////////////////////////////////
+void touch_stack(boost::atomic<std::size_t>& count)
+{
+    HPX_TEST(hpx::threads::get_self_ptr());
+
+    // use most of the smallest stack there is
+    char array[HPX_SMALL_STACK_SIZE - HPX_THREADS_STACK_OVERHEAD];
+    std::memset(array, '\xff', sizeof(array));
+    HPX_TEST_EQ(array[sizeof(array) - 1], '\xff');
+
+    ++count;
+}
+
+void test_stack_cache(hpx::threads::thread_stacksize stacksize)
+{
+    boost::atomic<std::size_t> count(0);
+
+    hpx::lcos::local::promise<void> p;
+    hpx::shared_future<void> f = p.get_future().share();
+
+    // keep all of the threads alive at the same time to force new slabs to be
+    // created, and release them at once to have their stacks recycled
+    hpx::threads::executors::default_executor exec(stacksize);
+
+    std::vector<hpx::future<void> > futures;
+    futures.reserve(NUM_THREADS);
+    for (std::size_t i = 0; i != NUM_THREADS; ++i)
+    {
+        futures.push_back(hpx::async(exec,
+            [&count, f]()
+            {
+                f.get();
+                touch_stack(count);
+            }));
+    }
+
+    p.set_value();
+    hpx::wait_all(futures);
+
+    HPX_TEST_EQ(count.load(), std::size_t(NUM_THREADS));
+}
+
+// threads are created on one worker thread but destroyed on others
+void test_stack_cache_handover()
+{
+    boost::atomic<std::size_t> count(0);
+
+    std::vector<hpx::future<void> > spawners;
+    for (std::size_t i = 0; i != hpx::get_os_thread_count(); ++i)
+    {
+        spawners.push_back(hpx::async(
+            [&count]()
+            {
+                std::vector<hpx::future<void> > futures;
+                futures.reserve(NUM_THREADS);
+                for (std::size_t j = 0; j != NUM_THREADS; ++j)
+                {
+                    futures.push_back(hpx::async(
+                        [&count]() { touch_stack(count); }));
+                }
+                hpx::wait_all(futures);
+            }));
+    }
+    hpx::wait_all(spawners);
+
+    HPX_TEST_EQ(count.load(), hpx::get_os_thread_count() * NUM_THREADS);
+}
+
+int hpx_main()
+{
+    // run the tests repeatedly to cycle stacks through the caches
+    for (int i = 0; i != 3; ++i)
+    {
+        test_stack_cache(hpx::threads::thread_stacksize_small);
+        test_stack_cache(hpx::threads::thread_stacksize_medium);
+        test_stack_cache_handover();
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // use small slabs to have many of them being created and released
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all",
+        "hpx.stacks.use_stack_cache=1",
+        "hpx.stacks.slab_size=4"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
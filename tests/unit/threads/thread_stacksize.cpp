@@ -88,6 +88,31 @@ HPX_DECLARE_ACTION(test_huge_stacksize, test_huge_stacksize_action)
 HPX_ACTION_USES_HUGE_STACK(test_huge_stacksize_action)
 HPX_PLAIN_ACTION(test_huge_stacksize, test_huge_stacksize_action)
 
+///////////////////////////////////////////////////////////////////////////////
+void test_nostack()
+{
+    HPX_TEST(hpx::threads::get_self_ptr());
+    // verify that no stack has been allocated
+    HPX_TEST_EQ(hpx::threads::get_ctx_ptr()->get_stacksize(),
+        hpx::get_runtime().get_config().get_stack_size(
+            hpx::threads::thread_stacksize_nostack));
+    HPX_TEST_EQ(hpx::threads::get_ctx_ptr()->get_stacksize(), 0);
+
+    // stackless threads are not allowed to suspend
+    bool caught_exception = false;
+    try {
+        hpx::this_thread::yield();
+    }
+    catch (hpx::exception const& e) {
+        HPX_TEST_EQ(e.get_error(), hpx::invalid_status);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+HPX_DECLARE_ACTION(test_nostack, test_nostack_action)
+HPX_ACTION_USES_NO_STACK(test_nostack_action)
+HPX_PLAIN_ACTION(test_nostack, test_nostack_action)
+
 ///////////////////////////////////////////////////////////////////////////////
 int main()
 {
@@ -115,6 +140,11 @@ int main()
             test_huge_stacksize_action test_action;
             test_action(id);
         }
+
+        {
+            test_nostack_action test_action;
+            test_action(id);
+        }
     }
 
     return hpx::util::report_errors();
@@ -0,0 +1,203 @@
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/util/cache/clock_cache.hpp>
+#include <hpx/util/cache/statistics/local_statistics.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <string>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+struct data
+{
+    data(char const* const k, char const* const v)
+      : key(k), value(v)
+    {}
+
+    char const* const key;
+    char const* const value;
+};
+
+data cache_entries[] =
+{
+    data ("white", "255,255,255"),
+    data ("yellow", "255,255,0"),
+    data ("green", "0,255,0"),
+    data ("blue", "0,0,255"),
+    data ("magenta", "255,0,255"),
+    data ("black", "0,0,0"),
+    data (nullptr, nullptr)
+};
+
+typedef hpx::util::cache::clock_cache<
+        std::string, std::string,
+        hpx::util::cache::statistics::local_statistics
+    > cache_type;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_clock_insert()
+{
+    cache_type c(3);
+
+    HPX_TEST(3 == c.capacity());
+
+    // insert all items into the cache
+    for (data* d = &cache_entries[0]; d->key != nullptr; ++d) {
+        HPX_TEST(c.insert(d->key, d->value));
+        HPX_TEST(3 >= c.size());
+    }
+
+    // there should be 3 items in the cache
+    HPX_TEST(3 == c.size());
+    HPX_TEST(3 == c.get_statistics().evictions(false));
+
+    // inserting an existing item fails
+    HPX_TEST(!c.insert("black", "0,0,0"));
+    HPX_TEST(3 == c.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_clock_insert_with_touch()
+{
+    cache_type c(3);
+
+    // insert 3 items into the cache
+    int i = 0;
+    data* d = &cache_entries[0];
+
+    for (/**/; i < 3 && d->key != nullptr; ++d, ++i) {
+        HPX_TEST(c.insert(d->key, d->value));
+    }
+
+    HPX_TEST(3 == c.size());
+
+    // now touch the first item, this gives it a second chance
+    std::string white;
+    HPX_TEST(c.get_entry("white", white));
+    HPX_TEST(white == "255,255,255");
+
+    // add two more items
+    for (i = 0; i < 2 && d->key != nullptr; ++d, ++i) {
+        HPX_TEST(c.insert(d->key, d->value));
+        HPX_TEST(3 == c.size());
+    }
+
+    // there should be 3 items in the cache, and white should be there as well
+    HPX_TEST(3 == c.size());
+    HPX_TEST(c.holds_key("white"));
+    HPX_TEST(!c.holds_key("yellow"));
+    HPX_TEST(!c.holds_key("green"));
+
+    HPX_TEST(1 == c.get_statistics().hits(false));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_clock_clear()
+{
+    cache_type c(3);
+
+    for (data* d = &cache_entries[0]; d->key != nullptr; ++d) {
+        HPX_TEST(c.insert(d->key, d->value));
+    }
+
+    HPX_TEST(3 == c.clear());
+
+    // there should be no items in the cache
+    HPX_TEST(0 == c.size());
+
+    // the cache is usable after being cleared
+    HPX_TEST(c.insert("white", "255,255,255"));
+    HPX_TEST(1 == c.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_clock_erase_one()
+{
+    cache_type c(3);
+
+    for (data* d = &cache_entries[0]; d->key != nullptr; ++d) {
+        HPX_TEST(c.insert(d->key, d->value));
+    }
+
+    std::string blue;
+    HPX_TEST(c.get_entry("blue", blue));
+
+    HPX_TEST(1 == c.erase(
+        [](std::pair<std::string, std::string> const& e)
+        {
+            return e.first == "blue";
+        }));
+
+    // there should be 2 items in the cache
+    HPX_TEST(!c.get_entry("blue", blue));
+    HPX_TEST(2 == c.size());
+
+    // the freed slot is reused without evicting anything
+    HPX_TEST(c.insert("blue", "0,0,255"));
+    HPX_TEST(3 == c.size());
+    HPX_TEST(c.holds_key("magenta"));
+    HPX_TEST(c.holds_key("black"));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_clock_update()
+{
+    cache_type c(4);    // this time we can hold 4 items
+
+    int i = 0;
+    data* d = &cache_entries[0];
+
+    for (/**/; i < 3 && d->key != nullptr; ++d, ++i) {
+        HPX_TEST(c.insert(d->key, d->value));
+    }
+
+    HPX_TEST(3 == c.size());
+
+    // now update some items
+    c.update("black", "255,0,0");     // isn't in the cache
+    HPX_TEST(4 == c.size());
+
+    c.update("yellow", "255,0,0");
+    HPX_TEST(4 == c.size());
+
+    std::string yellow;
+    HPX_TEST(c.get_entry("yellow", yellow));
+    HPX_TEST(yellow == "255,0,0");
+
+    // a rejected conditional update leaves the entry alone
+    HPX_TEST(!c.update_if("yellow", "0,0,0",
+        [](std::string const&, std::string const&) { return true; }));
+    HPX_TEST(c.get_entry("yellow", yellow));
+    HPX_TEST(yellow == "255,0,0");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_clock_reserve()
+{
+    cache_type c(4);
+
+    for (data* d = &cache_entries[0]; d->key != nullptr; ++d) {
+        HPX_TEST(c.insert(d->key, d->value));
+    }
+    HPX_TEST(4 == c.size());
+
+    // shrinking the cache evicts entries
+    c.reserve(2);
+    HPX_TEST(2 == c.capacity());
+    HPX_TEST(2 == c.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_clock_insert();
+    test_clock_insert_with_touch();
+    test_clock_clear();
+    test_clock_erase_one();
+    test_clock_update();
+    test_clock_reserve();
+
+    return hpx::util::report_errors();
+}